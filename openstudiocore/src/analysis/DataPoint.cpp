@@ -40,6 +40,9 @@
 #include "../utilities/core/Finder.hpp"
 #include "../utilities/core/Json.hpp"
 #include "../utilities/core/UnzipFile.hpp"
+#include "../utilities/data/AttributeBinary.hpp"
+
+#include <boost/filesystem/fstream.hpp>
 
 namespace openstudio {
 namespace analysis {
@@ -666,6 +669,102 @@ namespace detail {
     return openstudio::toJSON(json);
   }
 
+  bool DataPoint_Impl::saveResultsBinary(const openstudio::path& p,
+                                         bool overwrite) const
+  {
+    if (boost::filesystem::exists(p) && !overwrite) {
+      LOG(Error,"Binary results file " << toString(p) << " already exists and overwrite is false.");
+      return false;
+    }
+
+    boost::filesystem::ofstream ofs(p,std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!ofs) {
+      LOG(Error,"Could not open file " << toString(p) << " for writing.");
+      return false;
+    }
+
+    // header record, followed by one record per output attribute
+    AttributeVector header;
+    header.push_back(Attribute("uuid",toString(uuid())));
+    header.push_back(Attribute("complete",complete()));
+    header.push_back(Attribute("failed",failed()));
+    header.push_back(createAttributeFromVector("ResponseValues",responseValues()));
+    AttributeVector tagAttributes;
+    for (const Tag& tag : tags()) {
+      tagAttributes.push_back(Attribute(tag.uuid(),createUUID(),"tag",boost::none,tag.name(),boost::none));
+    }
+    header.push_back(Attribute("Tags",tagAttributes));
+
+    BinaryAttributeWriter writer(ofs);
+    bool result = writer.write(Attribute("DataPointResults",header));
+    for (const Attribute& attribute : outputAttributes()) {
+      if (!result) {
+        break;
+      }
+      result = writer.write(attribute);
+    }
+    ofs.close();
+    return result && !ofs.fail();
+  }
+
+  bool DataPoint_Impl::updateResultsFromBinary(const openstudio::path& p) {
+    if (complete() || !directory().empty()) {
+      LOG(Info,"Cannot update this DataPoint from binary results because it appears to have results "
+          << "already. Clear the old results before importing new ones.");
+      return false;
+    }
+
+    boost::filesystem::ifstream ifs(p,std::ios_base::in | std::ios_base::binary);
+    if (!ifs) {
+      LOG(Warn,"Cannot update DataPoint because " << toString(p) << " could not be opened.");
+      return false;
+    }
+
+    BinaryAttributeReader reader(ifs);
+    OptionalAttribute header = reader.next();
+    if (!header || (header->name() != "DataPointResults") ||
+        (header->valueType() != AttributeValueType::AttributeVector))
+    {
+      LOG(Warn,"Cannot update DataPoint because " << toString(p) << " does not contain DataPoint results.");
+      return false;
+    }
+
+    OptionalAttribute uuidAttribute = header->findChildByName("uuid");
+    if (!uuidAttribute || (toUUID(uuidAttribute->valueAsString()) != uuid())) {
+      LOG(Warn,"Cannot update DataPoint because the binary results belong to a DataPoint with a different UUID.");
+      return false;
+    }
+
+    OptionalAttribute completeAttribute = header->findChildByName("complete");
+    OptionalAttribute failedAttribute = header->findChildByName("failed");
+    OptionalAttribute responseValuesAttribute = header->findChildByName("ResponseValues");
+    OptionalAttribute tagsAttribute = header->findChildByName("Tags");
+    if (!completeAttribute || !failedAttribute || !responseValuesAttribute || !tagsAttribute) {
+      LOG(Warn,"Cannot update DataPoint because the binary results header in " << toString(p) << " is incomplete.");
+      return false;
+    }
+
+    AttributeVector outputAttributes;
+    while (OptionalAttribute attribute = reader.next()) {
+      outputAttributes.push_back(*attribute);
+    }
+    if (!reader.good()) {
+      LOG(Warn,"Cannot update DataPoint because the binary results in " << toString(p) << " are corrupt.");
+      return false;
+    }
+
+    m_complete = completeAttribute->valueAsBoolean();
+    m_failed = failedAttribute->valueAsBoolean();
+    m_responseValues = getDoubleVectorFromAttribute(*responseValuesAttribute);
+    m_tags.clear();
+    for (const Attribute& tagAttribute : tagsAttribute->valueAsAttributeVector()) {
+      m_tags.push_back(Tag(tagAttribute.uuid(),tagAttribute.valueAsString()));
+    }
+    m_outputAttributes = outputAttributes;
+    onChange(AnalysisObject_Impl::Benign);
+    return true;
+  }
+
   void DataPoint_Impl::setOsmInputData(const FileReference& file) {
     OS_ASSERT(file.fileType() == FileReferenceType::OSM);
     m_osmInputData = file;
@@ -1189,6 +1288,14 @@ std::string DataPoint::toJSON() const {
   return getImpl<detail::DataPoint_Impl>()->toJSON();
 }
 
+bool DataPoint::saveResultsBinary(const openstudio::path& p,bool overwrite) const {
+  return getImpl<detail::DataPoint_Impl>()->saveResultsBinary(p,overwrite);
+}
+
+bool DataPoint::updateResultsFromBinary(const openstudio::path& p) {
+  return getImpl<detail::DataPoint_Impl>()->updateResultsFromBinary(p);
+}
+
 boost::optional<DataPoint> DataPoint::loadJSON(const openstudio::path& p)
 {
   OptionalDataPoint result;
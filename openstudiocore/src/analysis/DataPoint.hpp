@@ -282,6 +282,16 @@ class ANALYSIS_API DataPoint : public AnalysisObject {
 
   static boost::optional<DataPoint> loadJSON(const std::string& json);
 
+  /** Saves this DataPoint's results (complete and failed flags, response values, tags, and
+   *  output attributes) to p in the compact binary attribute format. Much smaller and faster
+   *  to ingest than saveJSON for DataPoints with many output attributes. */
+  bool saveResultsBinary(const openstudio::path& p,bool overwrite=false) const;
+
+  /** Update results from a file written by saveResultsBinary. Output attributes are read one
+   *  at a time. Fails if this DataPoint already has results, or if the file was written by
+   *  a DataPoint with a different uuid. */
+  bool updateResultsFromBinary(const openstudio::path& p);
+
   //@}
  protected:
   /// @cond
@@ -256,6 +256,10 @@ namespace detail {
 
     std::string toJSON() const;
 
+    bool saveResultsBinary(const openstudio::path& p,bool overwrite=false) const;
+
+    bool updateResultsFromBinary(const openstudio::path& p);
+
     //@}
     /** @name Protected in or Absent from Public Class */
     //@{
@@ -174,9 +174,10 @@ namespace detail {
   }
 
   void OptimizationProblem_Impl::updateDataPoint(DataPoint& dataPoint,
-                                                 const runmanager::Job& completedJob) const
+                                                 const runmanager::Job& completedJob,
+                                                 const std::vector<runmanager::Job>& sharedPrefixJobs) const
   {
-    Problem_Impl::updateDataPoint(dataPoint,completedJob);
+    Problem_Impl::updateDataPoint(dataPoint,completedJob,sharedPrefixJobs);
     DoubleVector objectiveFunctionValues;
     for (const Function& objectiveFunction : objectives()) {
       objectiveFunctionValues.push_back(objectiveFunction.getValue(dataPoint));
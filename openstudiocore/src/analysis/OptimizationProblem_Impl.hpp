@@ -100,7 +100,8 @@ namespace detail {
         const openstudio::path& dakotaParametersFile) const;
 
     virtual void updateDataPoint(DataPoint& dataPoint,
-                                 const runmanager::Job& completedJob) const;
+                                 const runmanager::Job& completedJob,
+                                 const std::vector<runmanager::Job>& sharedPrefixJobs) const;
 
     /** Returns the DAKOTA results file string corresponding to dataPoint, if dataPoint completed
      *  successfully. Returns boost::none otherwise. */
@@ -1398,11 +1398,26 @@ namespace detail {
       const DataPoint& dataPoint,
       const openstudio::path& rubyIncludeDirectory) const
   {
+    return createWorkflow(dataPoint,rubyIncludeDirectory,0,int(m_workflow.size()));
+  }
+
+  runmanager::Workflow Problem_Impl::createWorkflow(const DataPoint& dataPoint,
+                                                    const openstudio::path& rubyIncludeDirectory,
+                                                    int beginStep,
+                                                    int endStep) const
+  {
+    if ((beginStep < 0) || (endStep > int(m_workflow.size())) || (beginStep > endStep)) {
+      LOG_AND_THROW("Invalid workflow step range [" << beginStep << "," << endStep << ") for "
+                    << "Problem '" << name() << "', which has " << m_workflow.size()
+                    << " WorkflowSteps.");
+    }
+
     // record the index of the report request measure if we find it
     boost::optional<unsigned> reportRequestMeasureIndex;
     boost::optional<runmanager::WorkItem> reportRequestMeasureWorkItem;
 
     std::vector<runmanager::WorkItem> result; // converted to Workflow at end
+    std::vector<int> resultSteps;             // index of the WorkflowStep that generated each item
     std::vector<QVariant> values = dataPoint.variableValues();
     if (int(values.size()) != numVariables()) {
       LOG_AND_THROW("DataPoint is invalid. Has wrong number of variable values. Was expecting "
@@ -1410,8 +1425,11 @@ namespace detail {
     }
     OptionalRubyMeasure compoundRubyMeasure;
     OptionalRubyMeasure originalCompoundRubyMeasure;
+    int compoundRubyMeasureStep(0);
     unsigned i = 0;
+    int stepIndex = -1;
     for (const WorkflowStep& step : workflow()) {
+      ++stepIndex;
 
       if (compoundRubyMeasure) {
 
@@ -1430,6 +1448,7 @@ namespace detail {
 
         // instantiate the compoundRubyMeasure and then deal with the next item
         result.push_back(compoundRubyMeasure->createWorkItem(rubyIncludeDirectory));
+        resultSteps.push_back(compoundRubyMeasureStep);
         compoundRubyMeasure.reset();
         originalCompoundRubyMeasure.reset();
       }
@@ -1451,6 +1470,7 @@ namespace detail {
         }
 
         result.push_back(workItem);
+        resultSteps.push_back(stepIndex);
       }
       else {
         InputVariable variable = step.inputVariable();
@@ -1458,12 +1478,14 @@ namespace detail {
           // start a compound measure
           originalCompoundRubyMeasure = rcv->measure();
           compoundRubyMeasure = originalCompoundRubyMeasure->clone().cast<RubyMeasure>();
+          compoundRubyMeasureStep = stepIndex;
           OSArgument arg = rcv->argument();
           arg.setValue(values[i].toDouble());
           compoundRubyMeasure->addArgument(arg);
         }
         else {
           result.push_back(variable.createWorkItem(values[i],rubyIncludeDirectory));
+          resultSteps.push_back(stepIndex);
         }
         ++i;
       }
@@ -1471,6 +1493,7 @@ namespace detail {
 
     if (compoundRubyMeasure) {
       result.push_back(compoundRubyMeasure->createWorkItem(rubyIncludeDirectory));
+      resultSteps.push_back(compoundRubyMeasureStep);
     }
 
     if (reportRequestMeasureIndex){
@@ -1485,23 +1508,95 @@ namespace detail {
       rjb.addScriptParameter("argumentValue", reportingMeasureArgument);
       result[*reportRequestMeasureIndex] = rjb.toWorkItem();
     }
-    
+
+    // keep the requested steps
+    OS_ASSERT(resultSteps.size() == result.size());
+    std::vector<runmanager::WorkItem> requested;
+    for (unsigned j = 0, n = result.size(); j < n; ++j) {
+      if ((resultSteps[j] >= beginStep) && (resultSteps[j] < endStep)) {
+        requested.push_back(result[j]);
+      }
+    }
+
     // put a bow on it
-    runmanager::Workflow simulationWorkflow(result);
+    runmanager::Workflow simulationWorkflow(requested);
     simulationWorkflow.addParam(runmanager::JobParam("flatoutdir"));
+    if (beginStep > 0) {
+      runmanager::JobParams params;
+      params.append("firstworkflowstep",boost::lexical_cast<std::string>(beginStep));
+      simulationWorkflow.add(params);
+    }
     return simulationWorkflow;
   }
 
+  std::vector<int> Problem_Impl::workflowSplitPoints() const {
+    std::vector<int> result;
+
+    if (OptionalAnalysisObject parent = this->parent()) {
+      if (parent->cast<Analysis>().seed().fileType() != FileReferenceType::OSM) {
+        return result;
+      }
+    }
+
+    for (int i = 0, n = int(m_workflow.size()); i < n; ++i) {
+      const WorkflowStep& step = m_workflow[i];
+      if (step.isWorkItem()) {
+        // only measures may be shared; other jobs produce files that forks would not see
+        runmanager::WorkItem workItem = step.workItem();
+        if (workItem.jobkeyname == "pat-report-request-job") {
+          break; // arguments depend on every measure in the workflow
+        }
+        if ((workItem.type != runmanager::JobType::UserScript) &&
+            (workItem.type != runmanager::JobType::Ruby) &&
+            (workItem.type != runmanager::JobType::Null))
+        {
+          break;
+        }
+      }
+      OptionalFileReferenceType inputFileType = step.inputFileType();
+      OptionalFileReferenceType outputFileType = step.outputFileType();
+      if ((inputFileType && (*inputFileType != FileReferenceType::OSM)) ||
+          (outputFileType && (*outputFileType != FileReferenceType::OSM)))
+      {
+        break;
+      }
+      OptionalWorkflowStep nextStep;
+      if (i + 1 < n) {
+        nextStep = m_workflow[i + 1];
+      }
+      if (!areInCompoundMeasure(step,nextStep)) {
+        result.push_back(i + 1);
+      }
+    }
+
+    return result;
+  }
+
   void Problem_Impl::updateDataPoint(DataPoint& dataPoint,
-                                     const runmanager::Job& completedJob) const
+                                     const runmanager::Job& completedJob,
+                                     const std::vector<runmanager::Job>& sharedPrefixJobs) const
   {
     OS_ASSERT((completedJob.treeStatus() == runmanager::TreeStatusEnum::Finished) ||
                  (completedJob.treeStatus() == runmanager::TreeStatusEnum::Failed));
 
     dataPoint.markComplete();
 
-    // Log warnings and errors
+    // a forked job tree only ran the steps after its shared prefixes, which ran them first
     openstudio::runmanager::JobErrors jobErrors = completedJob.treeErrors();
+    runmanager::Files allFiles;
+    if (!sharedPrefixJobs.empty()) {
+      openstudio::runmanager::JobErrors prefixErrors = sharedPrefixJobs[0].treeErrors();
+      for (unsigned i = 1, n = sharedPrefixJobs.size(); i < n; ++i) {
+        prefixErrors = prefixErrors + sharedPrefixJobs[i].treeErrors();
+      }
+      jobErrors = prefixErrors + jobErrors;
+      for (const runmanager::Job& sharedPrefixJob : sharedPrefixJobs) {
+        allFiles.append(sharedPrefixJob.treeAllFiles());
+      }
+    }
+    allFiles.append(completedJob.treeAllFiles());
+
+    // Log warnings and errors
 
     typedef std::pair<runmanager::ErrorType, std::string> Err;
 
@@ -1524,8 +1619,6 @@ namespace detail {
       return;
     }
 
-    runmanager::Files allFiles = completedJob.treeAllFiles();
-
     // Add input files
     try {
       openstudio::path osmInputDataPath = allFiles.getLastByExtension("osm").fullPath;
@@ -1589,10 +1682,34 @@ namespace detail {
       if (currentJob->hasMergedJobs()) {
         numMergedJobs = currentJob->mergedJobResults().size();
       }
+      // job tree may have been forked from a shared workflow prefix
+      int firstStep(0);
+      runmanager::JobParams topJobParams = topJob->jobParams();
+      if (topJobParams.has("firstworkflowstep") &&
+          !topJobParams.get("firstworkflowstep").children.empty())
+      {
+        firstStep = boost::lexical_cast<int>(topJobParams.get("firstworkflowstep").children[0].value);
+      }
+      int stepIndex(0);
       for (WorkflowStepVector::const_iterator it = workflow.begin(), itEnd = workflow.end();
-           it != itEnd; ++it)
+           it != itEnd; ++it, ++stepIndex)
       {
         WorkflowStep currentStep = *it;
+        if (stepIndex < firstStep) {
+          // run in a shared prefix job tree, not in dataPoint's
+          if (!optimize) {
+            if (currentStep.isWorkItem()) {
+              result.push_back(WorkflowStepJob(currentStep));
+            }
+            else if (OptionalMeasureGroup mg = currentStep.inputVariable().optionalCast<MeasureGroup>()) {
+              result.push_back(WorkflowStepJob(currentStep,mg->getMeasure(dataPoint)));
+            }
+            else {
+              result.push_back(WorkflowStepJob(currentStep,QVariant(currentStep.inputVariable().getValue(dataPoint))));
+            }
+          }
+          continue;
+        }
         if (currentStep.isInputVariable()) {
           InputVariable var = currentStep.inputVariable();
           // compound measure?
@@ -2595,10 +2712,29 @@ runmanager::Workflow Problem::createWorkflow(
   return getImpl<detail::Problem_Impl>()->createWorkflow(dataPoint,rubyIncludeDirectory);
 }
 
+runmanager::Workflow Problem::createWorkflow(const DataPoint& dataPoint,
+                                             const openstudio::path& rubyIncludeDirectory,
+                                             int beginStep,
+                                             int endStep) const
+{
+  return getImpl<detail::Problem_Impl>()->createWorkflow(dataPoint,rubyIncludeDirectory,beginStep,endStep);
+}
+
+std::vector<int> Problem::workflowSplitPoints() const {
+  return getImpl<detail::Problem_Impl>()->workflowSplitPoints();
+}
+
 void Problem::updateDataPoint(DataPoint& dataPoint,
                               const runmanager::Job& completedJob) const
 {
-  getImpl<detail::Problem_Impl>()->updateDataPoint(dataPoint,completedJob);
+  getImpl<detail::Problem_Impl>()->updateDataPoint(dataPoint,completedJob,std::vector<runmanager::Job>());
+}
+
+void Problem::updateDataPoint(DataPoint& dataPoint,
+                              const runmanager::Job& completedJob,
+                              const std::vector<runmanager::Job>& sharedPrefixJobs) const
+{
+  getImpl<detail::Problem_Impl>()->updateDataPoint(dataPoint,completedJob,sharedPrefixJobs);
 }
 
 std::vector<WorkflowStepJob> Problem::getJobsByWorkflowStep(const DataPoint& dataPoint,
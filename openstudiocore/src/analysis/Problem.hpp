@@ -77,8 +77,9 @@ namespace detail {
  *  WorkflowStepJobs\endlink are constructed by Problem, through the interpretation of 
  *  DataPoint::topLevelJob in the context of the Problem::workflow. */
 struct ANALYSIS_API WorkflowStepJob {
-  boost::optional<runmanager::Job> job; // initialized unless step evaluates to a null job or
-                                        // the preliminary part of a compound measure
+  boost::optional<runmanager::Job> job; // initialized unless step evaluates to a null job, is
+                                        // the preliminary part of a compound measure, or ran
+                                        // in a shared workflow prefix
   WorkflowStep step;
   boost::optional<Measure> measure;
   boost::optional<QVariant> value; // for variables with explicitly set values (all continuous
@@ -368,14 +369,41 @@ class ANALYSIS_API Problem : public AnalysisObject {
       const DataPoint& dataPoint,
       const openstudio::path& rubyIncludeDirectory=openstudio::path()) const;
 
+  /** Returns the portion of createWorkflow(dataPoint,rubyIncludeDirectory) generated by the
+   *  WorkflowSteps in [beginStep,endStep). beginStep and endStep should be 0, workflow().size(),
+   *  or one of workflowSplitPoints(). If beginStep > 0, the Workflow carries a firstworkflowstep
+   *  job parameter so that getJobsByWorkflowStep can line the resulting job tree up with
+   *  workflow(). Throws if the range is invalid. */
+  runmanager::Workflow createWorkflow(const DataPoint& dataPoint,
+                                      const openstudio::path& rubyIncludeDirectory,
+                                      int beginStep,
+                                      int endStep) const;
+
+  /** Returns the indices into workflow() at which the Workflow for a DataPoint may be split, so
+   *  that DataPoints sharing the variable values of all the steps before a split point can share
+   *  the output model of that prefix. The steps before each split point only apply measures to
+   *  the OpenStudio Model, and split points never fall inside a compound measure. Returned
+   *  indices are increasing and greater than zero. */
+  std::vector<int> workflowSplitPoints() const;
+
   /** Updates dataPoint post-simulation. If the completedJob is successful, it is mined for relevant
    *  files and other data, which then becomes accessible through dataPoint. */
   void updateDataPoint(DataPoint& dataPoint,
                        const runmanager::Job& completedJob) const;
 
+  /** As above, for a dataPoint whose job tree was forked from the job trees in sharedPrefixJobs,
+   *  outermost first (see workflowSplitPoints). Their files, warnings and errors are mined as if
+   *  they were part of completedJob, so dataPoint ends up with the same results as if it had run
+   *  its whole workflow on its own. */
+  void updateDataPoint(DataPoint& dataPoint,
+                       const runmanager::Job& completedJob,
+                       const std::vector<runmanager::Job>& sharedPrefixJobs) const;
+
   /** Returns the jobs stored in dataPoint broken down by WorkflowStep. Can be used to extract
    *  errors and warnings on a per-WorkflowStep basis. If optimize, steps that evaluate to null
-   *  jobs are removed from the return vector. */
+   *  jobs are removed from the return vector. If dataPoint's job tree was forked from a shared
+   *  workflow prefix (see workflowSplitPoints), the steps in that prefix are reported without
+   *  jobs (or removed, if optimize). */
   std::vector<WorkflowStepJob> getJobsByWorkflowStep(const DataPoint& dataPoint,
                                                      bool optimize=false) const;
 
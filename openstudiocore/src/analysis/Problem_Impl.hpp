@@ -262,8 +262,18 @@ namespace detail {
         const DataPoint& dataPoint,
         const openstudio::path& rubyIncludeDirectory) const;
 
+    /** Returns the portion of createWorkflow(dataPoint,rubyIncludeDirectory) generated by the
+     *  WorkflowSteps in [beginStep,endStep). */
+    runmanager::Workflow createWorkflow(const DataPoint& dataPoint,
+                                        const openstudio::path& rubyIncludeDirectory,
+                                        int beginStep,
+                                        int endStep) const;
+
+    std::vector<int> workflowSplitPoints() const;
+
     virtual void updateDataPoint(DataPoint& dataPoint,
-                                 const runmanager::Job& completedJob) const;
+                                 const runmanager::Job& completedJob,
+                                 const std::vector<runmanager::Job>& sharedPrefixJobs) const;
 
     /** Returns the jobs stored in dataPoint broken down by WorkflowStep. Can be used to extract
      *  errors and warnings on a per-WorkflowStep basis. If optimize, steps that evaluate to null
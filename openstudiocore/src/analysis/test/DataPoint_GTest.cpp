@@ -106,6 +106,57 @@ TEST_F(AnalysisFixture, DataPoint_JSONSerialization_PostRun_Roundtrip) {
 
 }
 
+TEST_F(AnalysisFixture, DataPoint_BinaryResults_Roundtrip) {
+  // Create analysis
+  Analysis analysis = analysis1(PostRun);
+
+  // Retrieve "simulated" data point
+  ASSERT_FALSE(analysis.dataPoints().empty());
+  DataPoint dataPoint = analysis.dataPoints()[0];
+  ASSERT_TRUE(dataPoint.complete());
+  ASSERT_FALSE(dataPoint.outputAttributes().empty());
+
+  // Save results
+  openstudio::path p = toPath("AnalysisFixtureData/data_point_post_run.osab");
+  EXPECT_TRUE(dataPoint.saveResultsBinary(p,true));
+  EXPECT_FALSE(dataPoint.saveResultsBinary(p,false));
+
+  // Cannot import results on top of existing results
+  EXPECT_FALSE(dataPoint.updateResultsFromBinary(p));
+
+  // Import into a copy without results
+  AnalysisJSONLoadResult loadResult = loadJSON(dataPoint.toJSON());
+  ASSERT_TRUE(loadResult.analysisObject);
+  ASSERT_TRUE(loadResult.analysisObject->optionalCast<DataPoint>());
+  DataPoint copy = loadResult.analysisObject->cast<DataPoint>();
+  copy.clearResults();
+  copy.clearAllDataFromCache();
+  EXPECT_FALSE(copy.complete());
+  EXPECT_TRUE(copy.responseValues().empty());
+
+  EXPECT_TRUE(copy.updateResultsFromBinary(p));
+  EXPECT_EQ(dataPoint.complete(),copy.complete());
+  EXPECT_EQ(dataPoint.failed(),copy.failed());
+  EXPECT_EQ(dataPoint.responseValues(),copy.responseValues());
+  ASSERT_EQ(dataPoint.tags().size(),copy.tags().size());
+  for (unsigned i = 0, n = dataPoint.tags().size(); i < n; ++i) {
+    EXPECT_EQ(dataPoint.tags()[i].name(),copy.tags()[i].name());
+  }
+  AttributeVector attributes = dataPoint.outputAttributes();
+  AttributeVector attributesCopy = copy.outputAttributes();
+  ASSERT_EQ(attributes.size(),attributesCopy.size());
+  for (unsigned i = 0, n = attributes.size(); i < n; ++i) {
+    EXPECT_TRUE(attributes[i] == attributesCopy[i]);
+    EXPECT_EQ(attributes[i].uuid(),attributesCopy[i].uuid());
+  }
+
+  // Results from another data point are rejected
+  Analysis otherAnalysis = analysis1(PreRun);
+  ASSERT_FALSE(otherAnalysis.dataPoints().empty());
+  DataPoint other = otherAnalysis.dataPoints()[0];
+  EXPECT_FALSE(other.updateResultsFromBinary(p));
+}
+
 TEST_F(AnalysisFixture, DataPoint_JSONSerialization_Versioning) {
   openstudio::path dir = resourcesPath() / toPath("analysis/version");
   
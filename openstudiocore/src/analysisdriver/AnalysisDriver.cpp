@@ -22,6 +22,7 @@
 #include "AnalysisRunOptions.hpp"
 #include "CurrentAnalysis.hpp"
 #include "CurrentAnalysis_Impl.hpp"
+#include "WorkflowPrefixTree.hpp"
 
 #include "../analysis/Analysis.hpp"
 #include "../analysis/Problem.hpp"
@@ -260,6 +261,14 @@ namespace detail {
     if (dataPoint.topLevelJob()) {
       it = getCurrentAnalysisByQueuedJob(dataPoint.topLevelJob()->uuid());
     }
+    else {
+      // may be waiting on a shared workflow prefix
+      for (it = m_currentAnalyses.begin(); it != m_currentAnalyses.end(); ++it) {
+        if (it->getImpl()->isQueuedOSDataPoint(dataPoint)) {
+          break;
+        }
+      }
+    }
     if (it == m_currentAnalyses.end()) {
       return;
     }
@@ -367,7 +376,7 @@ namespace detail {
       LOG(Info,"Processing " << job->treeStatus().valueDescription() << " job tree for "
           << toString(dataPoint->directory().stem()) << " from Analysis '" << analysis.name()
           << "'. Parent job uuid is '" << toString(job->uuid()) << "'.");
-      analysis.problem().updateDataPoint(*dataPoint,*job);
+      analysis.problem().updateDataPoint(*dataPoint,*job,getSharedPrefixJobs(*job));
       OS_ASSERT(dataPoint->isComplete());
 
       // create new data points as appropriate
@@ -428,6 +437,74 @@ namespace detail {
     }
   }
 
+  void AnalysisDriver_Impl::sharedPrefixJobTreeStateChanged(const openstudio::UUID& uuid) {
+    LOG(Trace,"Received tree state changed signal from RunManager for shared prefix job "
+        << toString(uuid) << ".");
+    boost::optional<openstudio::runmanager::Job> job = getFinishedOrFailedParentJob(uuid);
+
+    if (job) {
+      job->disconnect(SIGNAL(treeChanged(const openstudio::UUID &)),
+                      this,
+                      SLOT(sharedPrefixJobTreeStateChanged(const openstudio::UUID &)));
+
+      // retrieve analysis
+      auto currentAnalysisIt = getCurrentAnalysisBySharedPrefixJob(job->uuid());
+      if (currentAnalysisIt == m_currentAnalyses.end()) {
+        // can happen if multiple finished or failed signals are emitted by RunManager
+        LOG(Trace,"Shared prefix job uuid '" << toString(job->uuid()) << "' is no longer "
+            << "registered in a CurrentAnalysis.");
+        return;
+      }
+      CurrentAnalysis currentAnalysis = *currentAnalysisIt;
+      Analysis analysis = currentAnalysis.analysis();
+      std::pair<WorkflowPrefix,openstudio::path> registered =
+          currentAnalysis.getImpl()->removeCompletedSharedPrefixJob(job->uuid());
+      const WorkflowPrefix& prefix = registered.first;
+      if (isAnalysisBeingStopped(analysis.uuid())) {
+        return;
+      }
+
+      // fork from the prefix's output model
+      boost::optional<openstudio::path> prefixModel;
+      if (job->treeStatus() == openstudio::runmanager::TreeStatusEnum::Finished) {
+        try {
+          prefixModel = job->treeAllFiles().getLastByExtension("osm").fullPath;
+        }
+        catch (...) {}
+      }
+
+      // the forks' results start with those of this job and the prefixes it was forked from
+      std::vector<openstudio::UUID> sharedPrefixJobs;
+      for (const runmanager::Job& sharedPrefixJob : getSharedPrefixJobs(*job)) {
+        sharedPrefixJobs.push_back(sharedPrefixJob.uuid());
+      }
+
+      if (prefixModel) {
+        LOG(Info,"Shared workflow steps [" << prefix.beginStep << "," << prefix.endStep
+            << ") finished. Forking data points from '" << toString(*prefixModel) << "'.");
+        sharedPrefixJobs.push_back(job->uuid());
+        for (const WorkflowPrefix& child : prefix.children) {
+          queueSharedPrefixJob(currentAnalysis,child,*prefixModel,sharedPrefixJobs);
+        }
+        for (DataPoint dataPoint : prefix.dataPoints) {
+          queueDataPointJob(currentAnalysis,dataPoint,prefix.endStep,*prefixModel,sharedPrefixJobs);
+        }
+      }
+      else {
+        // run the steps again for each data point, so each gets its own errors and results
+        LOG(Warn,"Shared workflow steps [" << prefix.beginStep << "," << prefix.endStep
+            << ") did not produce a model. Running them separately for each data point.");
+        for (DataPoint dataPoint : prefix.allDataPoints()) {
+          queueDataPointJob(currentAnalysis,dataPoint,prefix.beginStep,registered.second,sharedPrefixJobs);
+        }
+      }
+
+      // save analysis to the database to capture the new jobs
+      AnalysisDriver copyOfThis = getAnalysisDriver();
+      saveAnalysis(analysis,copyOfThis);
+    }
+  }
+
   void AnalysisDriver_Impl::dakotaJobComplete(const openstudio::UUID &uuid,
                                               const openstudio::runmanager::JobErrors& jobErrors)
   {
@@ -575,41 +652,25 @@ namespace detail {
     }
 
     {
-      // Prepare to create workflows and queue jobs.
+      // Prepare to queue jobs.
       DataPointVector nextBatch;
       Problem problem = analysis.problem();
-      openstudio::path weatherFile;
-      if (analysis.weatherFile()) {
-        weatherFile = analysis.weatherFile().get().path();
-      }
       openstudio::path workingDirectory = runOptions.workingDirectory();
-      openstudio::path rubyIncludeDirectory = runOptions.rubyIncludeDirectory();
-      std::vector<URLSearchPath> urlSearchPaths = runOptions.urlSearchPaths();
-      bool force = runOptions.force();
+      openstudio::path seedPath = boost::filesystem::complete(analysis.seed().path());
       OptionalInt queueSize = runOptions.queueSize();
 
-      // Loop through DataPoints and queue jobs.
+      // Loop through DataPoints and prepare run directories.
       for (DataPoint& dataPoint : dataPoints) {
 
         if (queueSize && (currentAnalysis->numQueuedJobs() + int(nextBatch.size()) >= *queueSize)) {
           break;
         }
 
-        // create workflow
-        runmanager::Workflow workflow = problem.createWorkflow(dataPoint,rubyIncludeDirectory);
-        openstudio::runmanager::JobParams params;
-        params.append("cleanoutfiles", runOptions.jobCleanUpBehavior().valueName());
-        workflow.add(params);
-        if (boost::optional<runmanager::Tools> tools = runOptions.runManagerTools()) {
-          workflow.add(*tools);
-        }
-
         // get DataPointRecord and determine run directory
         DataPointRecord dataPointRecord =
             database().getObjectRecordByHandle<DataPointRecord>(dataPoint.uuid()).get();
         std::stringstream ss;
         ss << "dataPoint" << dataPointRecord.id();
-        openstudio::path seedPath = boost::filesystem::complete(analysis.seed().path());
         openstudio::path runDir = boost::filesystem::complete(workingDirectory / toPath(ss.str()));
         dataPoint.setDirectory(runDir);
         if (boost::filesystem::exists(runDir)) {
@@ -625,29 +686,36 @@ namespace detail {
         }
         boost::filesystem::create_directory(runDir);
 
-        LOG(Info,"Queuing user or OpenStudioAlgorithm generated '" << ss.str() << "'.");
-
-        runmanager::Job job = workflow.create(runDir,seedPath,weatherFile,urlSearchPaths);
-        runmanager::JobFactory::optimizeJobTree(job);
-
-        std::vector<openstudio::path> dakotaParametersFiles;
-        analysis.setDataPointRunInformation(dataPoint, job, dakotaParametersFiles);
-
         nextBatch.push_back(dataPoint);
+      }
 
-        bool test = job.connect(SIGNAL(treeChanged(const openstudio::UUID &)),this,
-                                SLOT(jobTreeStateChanged(const openstudio::UUID &)));
-        OS_ASSERT(test);
+      // Data points waiting on a shared workflow prefix count as queued.
+      currentAnalysis->getImpl()->addNextBatchOSDataPoints(nextBatch);
 
-        database().runManager().enqueue(job,force);
-        if ((queuePausingBehavior == QueuePausingBehavior::PauseForFirstN) &&
-            (nextBatch.size() == static_cast<size_t>(firstN)))
-        {
+      WorkflowPrefix prefixTree(0,0);
+      if (runOptions.shareWorkflowPrefixes()) {
+        prefixTree = buildWorkflowPrefixTree(problem,nextBatch);
+      }
+      else {
+        prefixTree.dataPoints = nextBatch;
+      }
+
+      // Queue jobs.
+      int numQueued(0);
+      for (DataPoint& dataPoint : prefixTree.dataPoints) {
+        queueDataPointJob(*currentAnalysis,dataPoint,0,seedPath,std::vector<openstudio::UUID>());
+        ++numQueued;
+        if ((queuePausingBehavior == QueuePausingBehavior::PauseForFirstN) && (numQueued == firstN)) {
+          unpauseQueue();
+        }
+      }
+      for (const WorkflowPrefix& prefix : prefixTree.children) {
+        queueSharedPrefixJob(*currentAnalysis,prefix,seedPath,std::vector<openstudio::UUID>());
+        ++numQueued;
+        if ((queuePausingBehavior == QueuePausingBehavior::PauseForFirstN) && (numQueued == firstN)) {
           unpauseQueue();
         }
       }
-
-      currentAnalysis->getImpl()->addNextBatchOSDataPoints(nextBatch);
     }
 
     // Save analysis to the database to capture DataPoint run directories
@@ -664,6 +732,134 @@ namespace detail {
     }
   }
 
+  void AnalysisDriver_Impl::queueDataPointJob(CurrentAnalysis& currentAnalysis,
+                                              DataPoint& dataPoint,
+                                              int beginStep,
+                                              const openstudio::path& seedPath,
+                                              const std::vector<openstudio::UUID>& sharedPrefixJobs)
+  {
+    if (!currentAnalysis.getImpl()->isQueuedOSDataPoint(dataPoint)) {
+      // stopped while waiting on a shared workflow prefix
+      LOG(Debug,"Not queuing " << toString(dataPoint.directory().stem()) << ", which is no "
+          << "longer registered as a queued data point.");
+      return;
+    }
+
+    Analysis analysis = currentAnalysis.analysis();
+    Problem problem = analysis.problem();
+    AnalysisRunOptions runOptions = currentAnalysis.runOptions();
+    openstudio::path weatherFile;
+    if (analysis.weatherFile()) {
+      weatherFile = analysis.weatherFile().get().path();
+    }
+
+    // create workflow
+    runmanager::Workflow workflow = problem.createWorkflow(dataPoint,
+                                                           runOptions.rubyIncludeDirectory(),
+                                                           beginStep,
+                                                           int(problem.workflow().size()));
+    openstudio::runmanager::JobParams params;
+    params.append("cleanoutfiles", runOptions.jobCleanUpBehavior().valueName());
+    appendSharedPrefixJobs(params,sharedPrefixJobs);
+    workflow.add(params);
+    if (boost::optional<runmanager::Tools> tools = runOptions.runManagerTools()) {
+      workflow.add(*tools);
+    }
+
+    if (beginStep == 0) {
+      LOG(Info,"Queuing user or OpenStudioAlgorithm generated '"
+          << toString(dataPoint.directory().stem()) << "'.");
+    }
+    else {
+      LOG(Info,"Queuing user or OpenStudioAlgorithm generated '"
+          << toString(dataPoint.directory().stem()) << "' from workflow step " << beginStep
+          << ", starting from shared model '" << toString(seedPath) << "'.");
+    }
+
+    runmanager::Job job = workflow.create(dataPoint.directory(),
+                                          seedPath,
+                                          weatherFile,
+                                          runOptions.urlSearchPaths());
+    runmanager::JobFactory::optimizeJobTree(job);
+
+    std::vector<openstudio::path> dakotaParametersFiles;
+    analysis.setDataPointRunInformation(dataPoint, job, dakotaParametersFiles);
+
+    bool test = job.connect(SIGNAL(treeChanged(const openstudio::UUID &)),this,
+                            SLOT(jobTreeStateChanged(const openstudio::UUID &)));
+    OS_ASSERT(test);
+
+    database().runManager().enqueue(job,runOptions.force());
+  }
+
+  void AnalysisDriver_Impl::queueSharedPrefixJob(CurrentAnalysis& currentAnalysis,
+                                                 const WorkflowPrefix& prefix,
+                                                 const openstudio::path& seedPath,
+                                                 const std::vector<openstudio::UUID>& sharedPrefixJobs)
+  {
+    Analysis analysis = currentAnalysis.analysis();
+    Problem problem = analysis.problem();
+    AnalysisRunOptions runOptions = currentAnalysis.runOptions();
+    openstudio::path weatherFile;
+    if (analysis.weatherFile()) {
+      weatherFile = analysis.weatherFile().get().path();
+    }
+    DataPointVector dataPoints = prefix.allDataPoints();
+    OS_ASSERT(!dataPoints.empty());
+
+    // all data points below prefix evaluate its steps the same way
+    runmanager::Workflow workflow = problem.createWorkflow(dataPoints[0],
+                                                           runOptions.rubyIncludeDirectory(),
+                                                           prefix.beginStep,
+                                                           prefix.endStep);
+
+    // nothing to share if the prefix only evaluates to null jobs
+    bool hasJobs(false);
+    for (const runmanager::WorkItem& workItem : workflow.toWorkItems()) {
+      if (workItem.type != runmanager::JobType::Null) {
+        hasJobs = true;
+        break;
+      }
+    }
+    if (!hasJobs) {
+      for (WorkflowPrefix child : prefix.children) {
+        child.beginStep = prefix.beginStep;
+        queueSharedPrefixJob(currentAnalysis,child,seedPath,sharedPrefixJobs);
+      }
+      for (DataPoint dataPoint : prefix.dataPoints) {
+        queueDataPointJob(currentAnalysis,dataPoint,prefix.beginStep,seedPath,sharedPrefixJobs);
+      }
+      return;
+    }
+
+    openstudio::runmanager::JobParams params;
+    params.append("cleanoutfiles", runOptions.jobCleanUpBehavior().valueName());
+    appendSharedPrefixJobs(params,sharedPrefixJobs);
+    workflow.add(params);
+    if (boost::optional<runmanager::Tools> tools = runOptions.runManagerTools()) {
+      workflow.add(*tools);
+    }
+
+    openstudio::path runDir = boost::filesystem::complete(
+        runOptions.workingDirectory() / toPath("sharedPrefixes") / toPath(removeBraces(createUUID())));
+    boost::filesystem::create_directories(runDir);
+
+    LOG(Info,"Queuing workflow steps [" << prefix.beginStep << "," << prefix.endStep << ") once "
+        << "for the " << dataPoints.size() << " data points that share them, in '"
+        << toString(runDir) << "'.");
+
+    runmanager::Job job = workflow.create(runDir,seedPath,weatherFile,runOptions.urlSearchPaths());
+    runmanager::JobFactory::optimizeJobTree(job);
+
+    currentAnalysis.getImpl()->addSharedPrefixJob(job.uuid(),prefix,seedPath);
+
+    bool test = job.connect(SIGNAL(treeChanged(const openstudio::UUID &)),this,
+                            SLOT(sharedPrefixJobTreeStateChanged(const openstudio::UUID &)));
+    OS_ASSERT(test);
+
+    database().runManager().enqueue(job,runOptions.force());
+  }
+
   void AnalysisDriver_Impl::startDakotaJob(CurrentAnalysis& currentAnalysis) {
     // Runmanager settings
     runmanager::ConfigOptions rmConfig = database().runManager().getConfigOptions();
@@ -889,6 +1085,19 @@ namespace detail {
     return result;
   }
 
+  std::vector<CurrentAnalysis>::iterator AnalysisDriver_Impl::getCurrentAnalysisBySharedPrefixJob(
+      const openstudio::UUID& sharedPrefixJob)
+  {
+    auto result = m_currentAnalyses.begin();
+    while (result != m_currentAnalyses.end()) {
+      if (result->getImpl()->isSharedPrefixJob(sharedPrefixJob)) {
+        break;
+      }
+      ++result;
+    }
+    return result;
+  }
+
   std::vector<CurrentAnalysis>::iterator AnalysisDriver_Impl::getCurrentAnalysisByDakotaJob(
       const openstudio::UUID& dakotaJob)
   {
@@ -904,6 +1113,38 @@ namespace detail {
     return result;
   }
 
+  void AnalysisDriver_Impl::appendSharedPrefixJobs(runmanager::JobParams& params,
+                                                   const std::vector<openstudio::UUID>& sharedPrefixJobs)
+  {
+    if (sharedPrefixJobs.empty()) {
+      return;
+    }
+    runmanager::JobParam param("sharedprefixjobs");
+    for (const openstudio::UUID& sharedPrefixJob : sharedPrefixJobs) {
+      param.children.push_back(runmanager::JobParam(toString(sharedPrefixJob)));
+    }
+    params.append(param);
+  }
+
+  std::vector<runmanager::Job> AnalysisDriver_Impl::getSharedPrefixJobs(const runmanager::Job& job) const
+  {
+    std::vector<runmanager::Job> result;
+    runmanager::JobParams params = job.jobParams();
+    if (!params.has("sharedprefixjobs")) {
+      return result;
+    }
+    for (const runmanager::JobParam& param : params.get("sharedprefixjobs").children) {
+      try {
+        result.push_back(m_database.runManager().getJob(toUUID(param.value)));
+      }
+      catch (const std::exception& e) {
+        LOG(Warn,"Shared prefix job " << param.value << " of job " << toString(job.uuid())
+            << " not found in RunManager, its results are not available. " << e.what());
+      }
+    }
+    return result;
+  }
+
   boost::optional<openstudio::runmanager::Job> AnalysisDriver_Impl::getFinishedOrFailedParentJob(
         const openstudio::UUID& uuid) const
   {
@@ -28,6 +28,7 @@
 
 #include "../runmanager/lib/FileInfo.hpp"
 #include "../runmanager/lib/JobErrors.hpp"
+#include "../runmanager/lib/JobParam.hpp"
 
 #include <QObject>
 
@@ -44,6 +45,7 @@ namespace analysisdriver {
 
 class AnalysisDriver;
 class AnalysisRunOptions;
+struct WorkflowPrefix;
 
 namespace detail {
 
@@ -126,6 +128,8 @@ namespace detail {
 
     void jobTreeStateChanged(const openstudio::UUID& uuid);
 
+    void sharedPrefixJobTreeStateChanged(const openstudio::UUID& uuid);
+
     void dakotaJobComplete(const openstudio::UUID &uuid,
                            const openstudio::runmanager::JobErrors& jobErrors);
 
@@ -162,6 +166,29 @@ namespace detail {
 
     void queueJobs(std::vector<CurrentAnalysis>::iterator& currentAnalysis);
 
+    /** Creates and enqueues the job tree for the workflow steps of dataPoint starting at
+     *  beginStep, using the model at seedPath. dataPoint's directory must already be set.
+     *  sharedPrefixJobs are the shared prefix job trees that produced seedPath, outermost first. */
+    void queueDataPointJob(CurrentAnalysis& currentAnalysis,
+                           analysis::DataPoint& dataPoint,
+                           int beginStep,
+                           const openstudio::path& seedPath,
+                           const std::vector<openstudio::UUID>& sharedPrefixJobs);
+
+    /** Enqueues the job tree for prefix, starting from the model at seedPath. The data points
+     *  below prefix are queued from its output model once it finishes. */
+    void queueSharedPrefixJob(CurrentAnalysis& currentAnalysis,
+                              const WorkflowPrefix& prefix,
+                              const openstudio::path& seedPath,
+                              const std::vector<openstudio::UUID>& sharedPrefixJobs);
+
+    /** Records sharedPrefixJobs in the job parameters of a forked job tree. */
+    static void appendSharedPrefixJobs(runmanager::JobParams& params,
+                                       const std::vector<openstudio::UUID>& sharedPrefixJobs);
+
+    /** Returns the shared prefix job trees that job was forked from, outermost first. */
+    std::vector<runmanager::Job> getSharedPrefixJobs(const runmanager::Job& job) const;
+
     void startDakotaJob(CurrentAnalysis& currentAnalysis);
 
     void queueDakotaJob(CurrentAnalysis& currentAnalysis,
@@ -172,6 +199,8 @@ namespace detail {
 
     std::vector<CurrentAnalysis>::iterator getCurrentAnalysisByDakotaJob(const openstudio::UUID& dakotaJob);
 
+    std::vector<CurrentAnalysis>::iterator getCurrentAnalysisBySharedPrefixJob(const openstudio::UUID& sharedPrefixJob);
+
     boost::optional<openstudio::runmanager::Job> getFinishedOrFailedParentJob(
         const openstudio::UUID& uuid) const;
 
@@ -32,7 +32,8 @@ AnalysisRunOptions::AnalysisRunOptions(const openstudio::path& workingDirectory,
     m_force(false),
     m_firstN(4),
     m_dakotaExePath(dakotaExePath),
-    m_dakotaFileSave(true)
+    m_dakotaFileSave(true),
+    m_shareWorkflowPrefixes(false)
 {}
 
 openstudio::path AnalysisRunOptions::workingDirectory() const {
@@ -79,6 +80,10 @@ bool AnalysisRunOptions::dakotaFileSave() const {
   return m_dakotaFileSave;
 }
 
+bool AnalysisRunOptions::shareWorkflowPrefixes() const {
+  return m_shareWorkflowPrefixes;
+}
+
 void AnalysisRunOptions::setRubyIncludeDirectory(const openstudio::path& includeDir) {
   m_rubyIncludeDirectory = includeDir;
 }
@@ -137,6 +142,10 @@ void AnalysisRunOptions::setDakotaFileSave(bool value) {
   m_dakotaFileSave = value;
 }
 
+void AnalysisRunOptions::setShareWorkflowPrefixes(bool value) {
+  m_shareWorkflowPrefixes = value;
+}
+
 } // analysisdriver
 } // openstudio
 
@@ -124,6 +124,12 @@ class ANALYSISDRIVER_API AnalysisRunOptions {
    *  be saved. Defaults to true. */
   bool dakotaFileSave() const;
 
+  /** Returns true if data points that share the measure choices at the start of the workflow
+   *  should run those measures once, in a shared job, and fork from the resulting model (see
+   *  analysis::Problem::workflowSplitPoints). Shared prefixes are run in the sharedPrefixes
+   *  folder of workingDirectory(). Defaults to false. */
+  bool shareWorkflowPrefixes() const;
+
   //@}
   /** @name Setters */
   //@{
@@ -156,6 +162,8 @@ class ANALYSISDRIVER_API AnalysisRunOptions {
 
   void setDakotaFileSave(bool value);
 
+  void setShareWorkflowPrefixes(bool value);
+
   //@}
  private:
   REGISTER_LOGGER("openstudio.analysisdriver.AnalysisRunOptions");
@@ -172,6 +180,7 @@ class ANALYSISDRIVER_API AnalysisRunOptions {
 
   openstudio::path m_dakotaExePath;
   bool m_dakotaFileSave;
+  bool m_shareWorkflowPrefixes;
 };
 
 } // analysisdriver
@@ -228,6 +228,27 @@ namespace detail {
     return result;
   }
 
+  void CurrentAnalysis_Impl::addSharedPrefixJob(const openstudio::UUID& job,
+                                                const WorkflowPrefix& prefix,
+                                                const openstudio::path& seedPath)
+  {
+    m_sharedPrefixJobs.insert(std::make_pair(job,std::make_pair(prefix,seedPath)));
+  }
+
+  bool CurrentAnalysis_Impl::isSharedPrefixJob(const openstudio::UUID& job) const {
+    return (m_sharedPrefixJobs.find(job) != m_sharedPrefixJobs.end());
+  }
+
+  std::pair<WorkflowPrefix,openstudio::path> CurrentAnalysis_Impl::removeCompletedSharedPrefixJob(
+      const openstudio::UUID& completedJob)
+  {
+    auto it = m_sharedPrefixJobs.find(completedJob);
+    OS_ASSERT(it != m_sharedPrefixJobs.end());
+    std::pair<WorkflowPrefix,openstudio::path> result = it->second;
+    m_sharedPrefixJobs.erase(it);
+    return result;
+  }
+
   // DLM: Jason it seems the following code should be in run manager somewhere?
   // maybe a treeChildren() or allChildren() method?
   void recursivelyAddJobAndChildren(std::vector<runmanager::Job>& jobs, const runmanager::Job& job){
@@ -268,6 +289,14 @@ namespace detail {
     }
     m_queuedOSDataPoints.clear();
 
+    for (const auto& sharedPrefixJob : m_sharedPrefixJobs) {
+      try {
+        recursivelyAddJobAndChildren(jobs, runManager.getJob(sharedPrefixJob.first));
+      }
+      catch (const std::exception&) {}
+    }
+    m_sharedPrefixJobs.clear();
+
     analysis::DataPointVector queuedDakotaDataPoints = m_queuedDakotaDataPoints;
     for (const analysis::DataPoint& queuedDakotaDataPoint : queuedDakotaDataPoints) {
       boost::optional<runmanager::Job> job = queuedDakotaDataPoint.topLevelJob();
@@ -23,12 +23,15 @@
 #include "AnalysisDriverAPI.hpp"
 #include "AnalysisRunOptions.hpp"
 #include "AnalysisDriver_Impl.hpp"
+#include "WorkflowPrefixTree.hpp"
 
 #include "../analysis/Analysis.hpp"
 #include "../analysis/DataPoint.hpp"
 
 #include <QObject>
 
+#include <map>
+
 namespace openstudio {
 
 namespace runmanager {
@@ -145,6 +148,21 @@ namespace detail {
      *  from the list of jobs to watch. */
     analysis::DataPoint removeCompletedDakotaDataPoint(const openstudio::UUID& completedJob);
 
+    // SHARED WORKFLOW PREFIXES
+
+    /** Registers job as the job tree running prefix from the model at seedPath. The data points
+     *  waiting on prefix should already be registered as queued OS data points. */
+    void addSharedPrefixJob(const openstudio::UUID& job,
+                            const WorkflowPrefix& prefix,
+                            const openstudio::path& seedPath);
+
+    bool isSharedPrefixJob(const openstudio::UUID& job) const;
+
+    /** Returns the prefix and seed path registered for completedJob, and erases them from the
+     *  list of jobs to watch. */
+    std::pair<WorkflowPrefix,openstudio::path> removeCompletedSharedPrefixJob(
+        const openstudio::UUID& completedJob);
+
     // START!
 
     void start(runmanager::RunManager& runManager);
@@ -173,6 +191,8 @@ namespace detail {
     boost::optional<openstudio::UUID> m_dakotaJob;
     boost::optional<runmanager::JobErrors> m_dakotaJobErrors;
     std::vector<analysis::DataPoint> m_queuedDakotaDataPoints;
+
+    std::map<openstudio::UUID,std::pair<WorkflowPrefix,openstudio::path> > m_sharedPrefixJobs;
   };
 
 } // detail
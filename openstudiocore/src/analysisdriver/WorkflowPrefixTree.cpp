@@ -0,0 +1,161 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include "WorkflowPrefixTree.hpp"
+
+#include "../analysis/Problem.hpp"
+#include "../analysis/WorkflowStep.hpp"
+
+#include "../utilities/core/Assert.hpp"
+
+using namespace openstudio::analysis;
+
+namespace openstudio {
+namespace analysisdriver {
+
+namespace {
+
+  bool valuesEqual(const std::vector<QVariant>& values1,
+                   const std::vector<QVariant>& values2,
+                   int beginVariable,
+                   int endVariable)
+  {
+    for (int i = beginVariable; i < endVariable; ++i) {
+      if (values1[i] != values2[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // true if all of the indexed points have the same values in [beginVariable,endVariable)
+  bool valuesAgree(const std::vector<std::vector<QVariant> >& values,
+                   const std::vector<unsigned>& indices,
+                   int beginVariable,
+                   int endVariable)
+  {
+    for (unsigned index : indices) {
+      if (!valuesEqual(values[index],values[indices.front()],beginVariable,endVariable)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void addChildren(WorkflowPrefix& node,
+                   const std::vector<DataPoint>& dataPoints,
+                   const std::vector<std::vector<QVariant> >& values,
+                   const std::vector<unsigned>& indices,
+                   const std::vector<int>& splitPoints,
+                   const std::vector<int>& numVariablesBefore,
+                   unsigned nextSplit)
+  {
+    if (nextSplit >= splitPoints.size()) {
+      for (unsigned index : indices) {
+        node.dataPoints.push_back(dataPoints[index]);
+      }
+      return;
+    }
+
+    // group by the variable values in [node.endStep,splitPoints[nextSplit])
+    int beginVariable = numVariablesBefore[node.endStep];
+    int endVariable = numVariablesBefore[splitPoints[nextSplit]];
+    std::vector<std::vector<unsigned> > groups;
+    for (unsigned index : indices) {
+      bool found(false);
+      for (std::vector<unsigned>& group : groups) {
+        if (valuesEqual(values[index],values[group.front()],beginVariable,endVariable)) {
+          group.push_back(index);
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        groups.push_back(std::vector<unsigned>(1u,index));
+      }
+    }
+
+    for (const std::vector<unsigned>& group : groups) {
+      if (group.size() == 1u) {
+        node.dataPoints.push_back(dataPoints[group.front()]);
+        continue;
+      }
+      // extend the shared prefix as far as the whole group agrees
+      unsigned split = nextSplit;
+      while ((split + 1u < splitPoints.size()) &&
+             valuesAgree(values,
+                         group,
+                         numVariablesBefore[splitPoints[split]],
+                         numVariablesBefore[splitPoints[split + 1u]]))
+      {
+        ++split;
+      }
+      WorkflowPrefix child(node.endStep,splitPoints[split]);
+      addChildren(child,dataPoints,values,group,splitPoints,numVariablesBefore,split + 1u);
+      node.children.push_back(child);
+    }
+  }
+
+}
+
+WorkflowPrefix::WorkflowPrefix(int t_beginStep, int t_endStep)
+  : beginStep(t_beginStep), endStep(t_endStep)
+{}
+
+std::vector<analysis::DataPoint> WorkflowPrefix::allDataPoints() const {
+  std::vector<DataPoint> result = dataPoints;
+  for (const WorkflowPrefix& child : children) {
+    std::vector<DataPoint> childDataPoints = child.allDataPoints();
+    result.insert(result.end(),childDataPoints.begin(),childDataPoints.end());
+  }
+  return result;
+}
+
+WorkflowPrefix buildWorkflowPrefixTree(const analysis::Problem& problem,
+                                       const std::vector<analysis::DataPoint>& dataPoints)
+{
+  WorkflowPrefix result(0,0);
+
+  // forks must have at least one step left to run
+  std::vector<WorkflowStep> workflow = problem.workflow();
+  std::vector<int> splitPoints = problem.workflowSplitPoints();
+  while (!splitPoints.empty() && (splitPoints.back() >= int(workflow.size()))) {
+    splitPoints.pop_back();
+  }
+
+  std::vector<int> numVariablesBefore(1u,0);
+  for (const WorkflowStep& step : workflow) {
+    numVariablesBefore.push_back(numVariablesBefore.back() + (step.isInputVariable() ? 1 : 0));
+  }
+  OS_ASSERT(numVariablesBefore.back() == problem.numVariables());
+
+  std::vector<std::vector<QVariant> > values;
+  std::vector<unsigned> indices;
+  for (const DataPoint& dataPoint : dataPoints) {
+    indices.push_back(values.size());
+    values.push_back(dataPoint.variableValues());
+    OS_ASSERT(int(values.back().size()) == problem.numVariables());
+  }
+
+  addChildren(result,dataPoints,values,indices,splitPoints,numVariablesBefore,0u);
+  return result;
+}
+
+} // analysisdriver
+} // openstudio
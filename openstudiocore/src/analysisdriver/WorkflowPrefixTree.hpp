@@ -0,0 +1,67 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#ifndef ANALYSISDRIVER_WORKFLOWPREFIXTREE_HPP
+#define ANALYSISDRIVER_WORKFLOWPREFIXTREE_HPP
+
+#include "AnalysisDriverAPI.hpp"
+
+#include "../analysis/DataPoint.hpp"
+
+#include <vector>
+
+namespace openstudio {
+
+namespace analysis {
+  class Problem;
+}
+
+namespace analysisdriver {
+
+/** WorkflowPrefix is a node in the tree built by buildWorkflowPrefixTree. Every data point below
+ *  the node evaluates the analysis::Problem::workflow steps in [beginStep,endStep) identically,
+ *  so those steps can be run once and their output model shared. */
+struct ANALYSISDRIVER_API WorkflowPrefix {
+  int beginStep;
+  int endStep;
+  /** Data points that run workflow steps [endStep,workflow().size()) starting from the model
+   *  produced by this prefix. */
+  std::vector<analysis::DataPoint> dataPoints;
+  /** Longer shared prefixes that start from the model produced by this prefix. */
+  std::vector<WorkflowPrefix> children;
+
+  WorkflowPrefix(int t_beginStep, int t_endStep);
+
+  /** Returns all of the data points below this node. */
+  std::vector<analysis::DataPoint> allDataPoints() const;
+};
+
+/** Returns the root of the tree of workflow prefixes shared by dataPoints. The root covers no
+ *  steps, and its dataPoints do not share a prefix with any other point, so they should run
+ *  from the seed model as usual. Every other node has at least two data points below it, and
+ *  ends at one of problem.workflowSplitPoints(). The tree is path compressed: a node ends at
+ *  the last split point up to which all of its data points agree. */
+ANALYSISDRIVER_API WorkflowPrefix buildWorkflowPrefixTree(
+    const analysis::Problem& problem,
+    const std::vector<analysis::DataPoint>& dataPoints);
+
+} // analysisdriver
+} // openstudio
+
+#endif // ANALYSISDRIVER_WORKFLOWPREFIXTREE_HPP
@@ -0,0 +1,241 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "AnalysisDriverFixture.hpp"
+
+#include "../WorkflowPrefixTree.hpp"
+#include "../AnalysisDriver.hpp"
+#include "../AnalysisRunOptions.hpp"
+#include "../CurrentAnalysis.hpp"
+
+#include "../../project/ProjectDatabase.hpp"
+
+#include "../../analysis/Analysis.hpp"
+#include "../../analysis/Problem.hpp"
+#include "../../analysis/DataPoint.hpp"
+#include "../../analysis/LinearFunction.hpp"
+#include "../../analysis/MeasureGroup.hpp"
+#include "../../analysis/NullMeasure.hpp"
+#include "../../analysis/OutputAttributeVariable.hpp"
+#include "../../analysis/RubyMeasure.hpp"
+
+#include "../../runmanager/lib/Workflow.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/WeatherFile.hpp"
+
+#include "../../utilities/core/FileReference.hpp"
+#include "../../utilities/data/Attribute.hpp"
+#include "../../utilities/filetypes/EpwFile.hpp"
+
+#include <runmanager/Test/ToolBin.hxx>
+
+using namespace openstudio;
+using namespace openstudio::analysis;
+using namespace openstudio::analysisdriver;
+
+namespace {
+
+  Problem prefixTreeProblem() {
+    VariableVector variables;
+    MeasureVector measures;
+    // 0
+    measures.push_back(NullMeasure());
+    measures.push_back(RubyMeasure(toPath("modelUserScript.rb"),
+                                   FileReferenceType::OSM,
+                                   FileReferenceType::OSM,
+                                   true));
+    variables.push_back(MeasureGroup("Model Variable 1",measures));
+    // 1
+    measures[1] = RubyMeasure(toPath("modelUserScript.rb"),
+                              FileReferenceType::OSM,
+                              FileReferenceType::OSM,
+                              true);
+    variables.push_back(MeasureGroup("Model Variable 2",measures));
+    // 2
+    measures.clear();
+    measures.push_back(RubyMeasure(toPath("translationUserScript.rb"),
+                                   FileReferenceType::OSM,
+                                   FileReferenceType::IDF,
+                                   true));
+    variables.push_back(MeasureGroup("Translation Variable",measures));
+    runmanager::Workflow workflow;
+    workflow.addJob(runmanager::JobType::EnergyPlus);
+    return Problem("Problem",variables,workflow);
+  }
+
+  DataPoint prefixTreeDataPoint(const Problem& problem, int value0, int value1) {
+    std::vector<QVariant> values;
+    values.push_back(value0);
+    values.push_back(value1);
+    values.push_back(0);
+    OptionalDataPoint result = problem.createDataPoint(values);
+    EXPECT_TRUE(result);
+    return result.get();
+  }
+
+}
+
+TEST_F(AnalysisDriverFixture,WorkflowPrefixTree_SplitPoints) {
+  Problem problem = prefixTreeProblem();
+  ASSERT_EQ(4u,problem.workflow().size());
+
+  // translation and simulation steps are never shared
+  std::vector<int> splitPoints = problem.workflowSplitPoints();
+  ASSERT_EQ(2u,splitPoints.size());
+  EXPECT_EQ(1,splitPoints[0]);
+  EXPECT_EQ(2,splitPoints[1]);
+
+  // pieces of a split workflow add up to the whole
+  DataPoint dataPoint = prefixTreeDataPoint(problem,1,1);
+  unsigned n = problem.createWorkflow(dataPoint).toWorkItems().size();
+  unsigned nPrefix = problem.createWorkflow(dataPoint,openstudio::path(),0,2).toWorkItems().size();
+  unsigned nSuffix = problem.createWorkflow(dataPoint,openstudio::path(),2,4).toWorkItems().size();
+  EXPECT_EQ(2u,nPrefix);
+  EXPECT_EQ(n,nPrefix + nSuffix);
+
+  EXPECT_ANY_THROW(problem.createWorkflow(dataPoint,openstudio::path(),2,1));
+  EXPECT_ANY_THROW(problem.createWorkflow(dataPoint,openstudio::path(),0,5));
+}
+
+TEST_F(AnalysisDriverFixture,WorkflowPrefixTree_Build) {
+  Problem problem = prefixTreeProblem();
+
+  // lone data point runs from the seed
+  DataPointVector dataPoints(1u,prefixTreeDataPoint(problem,0,0));
+  WorkflowPrefix root = buildWorkflowPrefixTree(problem,dataPoints);
+  EXPECT_EQ(0,root.endStep);
+  EXPECT_EQ(1u,root.dataPoints.size());
+  EXPECT_TRUE(root.children.empty());
+
+  // full factorial on the model variables, plus a duplicate
+  dataPoints.push_back(prefixTreeDataPoint(problem,0,1));
+  dataPoints.push_back(prefixTreeDataPoint(problem,1,0));
+  dataPoints.push_back(prefixTreeDataPoint(problem,1,1));
+  dataPoints.push_back(prefixTreeDataPoint(problem,1,1));
+  root = buildWorkflowPrefixTree(problem,dataPoints);
+  EXPECT_TRUE(root.dataPoints.empty());
+  EXPECT_EQ(5u,root.allDataPoints().size());
+  ASSERT_EQ(2u,root.children.size());
+
+  // first variable shared, second variable forks
+  WorkflowPrefix prefix = root.children[0];
+  EXPECT_EQ(0,prefix.beginStep);
+  EXPECT_EQ(1,prefix.endStep);
+  EXPECT_EQ(2u,prefix.dataPoints.size());
+  EXPECT_TRUE(prefix.children.empty());
+
+  prefix = root.children[1];
+  EXPECT_EQ(0,prefix.beginStep);
+  EXPECT_EQ(1,prefix.endStep);
+  ASSERT_EQ(1u,prefix.dataPoints.size());
+  EXPECT_TRUE(prefix.dataPoints[0] == dataPoints[2]);
+  ASSERT_EQ(1u,prefix.children.size());
+
+  // duplicates share both model variables
+  prefix = prefix.children[0];
+  EXPECT_EQ(1,prefix.beginStep);
+  EXPECT_EQ(2,prefix.endStep);
+  EXPECT_EQ(2u,prefix.dataPoints.size());
+  EXPECT_TRUE(prefix.children.empty());
+}
+
+TEST_F(AnalysisDriverFixture,WorkflowPrefixTree_SharedResults) {
+  Problem problem = retrieveProblem(AnalysisDriverFixtureProblem::UserScriptContinuous,true,true);
+  FunctionVector responses;
+  responses.push_back(LinearFunction("Site Energy",
+                                     VariableVector(1u,OutputAttributeVariable(
+                                         "Site Energy",
+                                         "Total Site Energy"))));
+  responses.push_back(LinearFunction("Floor Area",
+                                     VariableVector(1u,OutputAttributeVariable(
+                                         "Floor Area",
+                                         "floorArea"))));
+  problem = Problem(problem.name(),problem.workflow(),responses);
+
+  model::Model model = fastExampleModel();
+  EpwFile epwFile(energyPlusWeatherDataPath() / toPath("USA_IL_Chicago-OHare.Intl.AP.725300_TMY3.epw"));
+  model::WeatherFile::setWeatherFile(model,epwFile);
+  openstudio::path p = toPath("./example.osm");
+  model.save(p,true);
+  FileReference seedModel(p);
+
+  // same window to wall ratio measure, different overhangs
+  std::vector<double> projectionFactors;
+  projectionFactors.push_back(0.5);
+  projectionFactors.push_back(1.0);
+
+  // run with and without sharing the window to wall ratio measure
+  std::vector<Analysis> analyses;
+  for (int share = 0; share < 2; ++share) {
+    Analysis analysis(share ? "Shared" : "Separate",problem,seedModel);
+    for (double projectionFactor : projectionFactors) {
+      std::vector<QVariant> values;
+      values.push_back(QVariant(double(0.2))); // wwr
+      values.push_back(QVariant(double(1.0))); // offset of windows from floor
+      values.push_back(QVariant(projectionFactor));
+      OptionalDataPoint dataPoint = problem.createDataPoint(values);
+      ASSERT_TRUE(dataPoint);
+      EXPECT_TRUE(analysis.addDataPoint(*dataPoint));
+    }
+
+    project::ProjectDatabase database = getCleanDatabase(std::string("WorkflowPrefixTree_SharedResults_") + analysis.name());
+    AnalysisDriver analysisDriver(database);
+    AnalysisRunOptions runOptions = standardRunOptions(analysisDriver.database().path().parent_path());
+    runOptions.setShareWorkflowPrefixes(share != 0);
+    analysisDriver.run(analysis,runOptions);
+    EXPECT_TRUE(analysisDriver.waitForFinished());
+    EXPECT_EQ(share != 0,boost::filesystem::exists(runOptions.workingDirectory() / toPath("sharedPrefixes")));
+    analyses.push_back(analysis);
+  }
+
+  // forked data points report the shared measure's results too
+  DataPointVector separateDataPoints = analyses[0].dataPoints();
+  DataPointVector sharedDataPoints = analyses[1].dataPoints();
+  ASSERT_EQ(projectionFactors.size(),separateDataPoints.size());
+  ASSERT_EQ(projectionFactors.size(),sharedDataPoints.size());
+  for (unsigned i = 0, n = projectionFactors.size(); i < n; ++i) {
+    DataPoint separate = separateDataPoints[i];
+    DataPoint shared = sharedDataPoints[i];
+    EXPECT_TRUE(separate.isComplete());
+    EXPECT_FALSE(separate.failed());
+    EXPECT_TRUE(shared.isComplete());
+    EXPECT_FALSE(shared.failed());
+
+    EXPECT_EQ(separate.xmlOutputData().size(),shared.xmlOutputData().size());
+
+    AttributeVector separateAttributes = separate.outputAttributes();
+    AttributeVector sharedAttributes = shared.outputAttributes();
+    ASSERT_EQ(separateAttributes.size(),sharedAttributes.size());
+    for (const Attribute& attribute : separateAttributes) {
+      OptionalAttribute sharedAttribute = shared.getOutputAttribute(attribute.name());
+      ASSERT_TRUE(sharedAttribute) << attribute.name();
+      EXPECT_TRUE(attribute == *sharedAttribute) << attribute.name();
+    }
+
+    DoubleVector separateResponses = separate.responseValues();
+    DoubleVector sharedResponses = shared.responseValues();
+    ASSERT_EQ(responses.size(),separateResponses.size());
+    ASSERT_EQ(responses.size(),sharedResponses.size());
+    for (unsigned j = 0, m = responses.size(); j < m; ++j) {
+      EXPECT_DOUBLE_EQ(separateResponses[j],sharedResponses[j]);
+    }
+  }
+}
@@ -43,10 +43,12 @@
 
 #include "../utilities/idf/Workspace.hpp"
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
+#include "../utilities/idf/IdfObject_Impl.hpp"
 #include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/WorkspaceObjectOrder.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/System.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/time/Time.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
@@ -71,6 +73,8 @@
 #include <QThread>
 
 #include <sstream>
+#include <thread>
+#include <atomic>
 
 using namespace openstudio::model;
 
@@ -91,19 +95,26 @@ ForwardTranslator::ForwardTranslator()
   m_keepRunControlSpecialDays = false;
   m_ipTabularOutput = false;
   m_excludeLCCObjects = false;
+
+  m_numberOfThreads = 1;
 }
 
 Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* progressBar )
 {
   Model modelCopy = model.clone().cast<Model>();
 
+  return translateModelInPlace(modelCopy, progressBar);
+}
+
+Workspace ForwardTranslator::translateModelInPlace( Model & model, ProgressBar* progressBar )
+{
   m_progressBar = progressBar;
   if (m_progressBar){
     m_progressBar->setMinimum(0);
     m_progressBar->setMaximum(model.numObjects());
   }
 
-  return translateModelPrivate(modelCopy, true);
+  return translateModelPrivate(model, true);
 }
 
 Workspace ForwardTranslator::translateModelObject( ModelObject & modelObject )
@@ -120,7 +131,7 @@ std::vector<LogMessage> ForwardTranslator::warnings() const
 {
   std::vector<LogMessage> result;
 
-  for (LogMessage logMessage : m_logSink.logMessages()){
+  for (LogMessage logMessage : logMessages()){
     if (logMessage.logLevel() == Warn){
       result.push_back(logMessage);
     }
@@ -133,7 +144,7 @@ std::vector<LogMessage> ForwardTranslator::errors() const
 {
   std::vector<LogMessage> result;
 
-  for (LogMessage logMessage : m_logSink.logMessages()){
+  for (LogMessage logMessage : logMessages()){
     if (logMessage.logLevel() > Warn){
       result.push_back(logMessage);
     }
@@ -142,6 +153,29 @@ std::vector<LogMessage> ForwardTranslator::errors() const
   return result;
 }
 
+std::vector<LogMessage> ForwardTranslator::logMessages() const
+{
+  std::vector<LogMessage> sinkMessages = m_logSink.logMessages();
+  if (m_pretranslatedLogMessages.empty()){
+    return sinkMessages;
+  }
+
+  // put the messages of pretranslated objects back where a sequential run would have logged them
+  std::vector<LogMessage> result;
+  auto pretranslated = m_pretranslatedLogMessages.begin();
+  for (size_t i = 0; i <= sinkMessages.size(); ++i){
+    while ((pretranslated != m_pretranslatedLogMessages.end()) && (pretranslated->first <= i)){
+      result.push_back(pretranslated->second);
+      ++pretranslated;
+    }
+    if (i < sinkMessages.size()){
+      result.push_back(sinkMessages[i]);
+    }
+  }
+
+  return result;
+}
+
 // temp code
 void ForwardTranslator::setKeepRunControlSpecialDays(bool keepRunControlSpecialDays)
 {
@@ -158,6 +192,11 @@ void ForwardTranslator::setExcludeLCCObjects(bool excludeLCCObjects)
   m_excludeLCCObjects = excludeLCCObjects;
 }
 
+void ForwardTranslator::setNumberOfThreads(unsigned numberOfThreads)
+{
+  m_numberOfThreads = numberOfThreads;
+}
+
 Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
 {
   reset();
@@ -329,6 +368,10 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     }
   }
 
+  // the model is not edited past this point other than by adding new objects, translate the
+  // independent objects concurrently now and merge them as the ordered translation reaches them
+  pretranslateIndependentObjects(model);
+
   translateConstructions(model);
   translateSchedules(model);
 
@@ -381,6 +424,13 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
   workspace.setFastNaming(false);
   OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
 
+  // the workspace holds its own copy of every object, release ours rather than keeping a
+  // second copy of the translation alive until the next call
+  m_idfObjects.clear();
+  m_map.clear();
+  m_constructionHandleToReversedConstructions.clear();
+  m_pretranslatedObjects.clear();
+
   return workspace;
 }
 
@@ -431,6 +481,37 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
 
   LOG(Trace,"Translating " << modelObject.briefDescription() << ".");
 
+  // merge the result of pretranslateIndependentObjects in place of translating again, the
+  // independent types have no translated children
+  auto pretranslated = m_pretranslatedObjects.find(modelObject.handle());
+  if (pretranslated != m_pretranslatedObjects.end()){
+    PretranslatedObject pretranslatedObject = pretranslated->second;
+    m_pretranslatedObjects.erase(pretranslated);
+
+    if (!pretranslatedObject.logMessages.empty()){
+      size_t position = m_logSink.logMessages().size();
+      for (const LogMessage& logMessage : pretranslatedObject.logMessages){
+        m_pretranslatedLogMessages.push_back(std::make_pair(position, logMessage));
+      }
+    }
+    if (pretranslatedObject.exception){
+      std::rethrow_exception(pretranslatedObject.exception);
+    }
+
+    m_idfObjects.insert(m_idfObjects.end(), pretranslatedObject.idfObjects.begin(), pretranslatedObject.idfObjects.end());
+
+    retVal = pretranslatedObject.result;
+    if (retVal){
+      m_map.insert(make_pair(modelObject.handle(),retVal.get()));
+
+      if (m_progressBar){
+        m_progressBar->setValue((int)m_map.size());
+      }
+    }
+
+    return retVal;
+  }
+
   switch(modelObject.iddObject().type().value())
   {
   case openstudio::IddObjectType::OS_AirConditioner_VariableRefrigerantFlow :
@@ -2138,6 +2219,119 @@ void ForwardTranslator::translateConstructions(const model::Model & model)
   }
 }
 
+std::vector<IddObjectType> ForwardTranslator::independentIddObjectTypes()
+{
+  std::vector<IddObjectType> result;
+
+  result.push_back(IddObjectType::OS_Curve_Bicubic);
+  result.push_back(IddObjectType::OS_Curve_Biquadratic);
+  result.push_back(IddObjectType::OS_Curve_Cubic);
+  result.push_back(IddObjectType::OS_Curve_DoubleExponentialDecay);
+  result.push_back(IddObjectType::OS_Curve_Exponent);
+  result.push_back(IddObjectType::OS_Curve_ExponentialDecay);
+  result.push_back(IddObjectType::OS_Curve_ExponentialSkewNormal);
+  result.push_back(IddObjectType::OS_Curve_FanPressureRise);
+  result.push_back(IddObjectType::OS_Curve_Functional_PressureDrop);
+  result.push_back(IddObjectType::OS_Curve_Linear);
+  result.push_back(IddObjectType::OS_Curve_Quadratic);
+  result.push_back(IddObjectType::OS_Curve_QuadraticLinear);
+  result.push_back(IddObjectType::OS_Curve_Quartic);
+  result.push_back(IddObjectType::OS_Curve_RectangularHyperbola1);
+  result.push_back(IddObjectType::OS_Curve_RectangularHyperbola2);
+  result.push_back(IddObjectType::OS_Curve_Sigmoid);
+  result.push_back(IddObjectType::OS_Curve_Triquadratic);
+  result.push_back(IddObjectType::OS_Table_MultiVariableLookup);
+
+  result.push_back(IddObjectType::OS_Material);
+  result.push_back(IddObjectType::OS_Material_AirGap);
+  result.push_back(IddObjectType::OS_Material_AirWall);
+  result.push_back(IddObjectType::OS_Material_InfraredTransparent);
+  result.push_back(IddObjectType::OS_Material_NoMass);
+  result.push_back(IddObjectType::OS_Material_RoofVegetation);
+
+  result.push_back(IddObjectType::OS_WindowMaterial_Blind);
+  result.push_back(IddObjectType::OS_WindowMaterial_Gas);
+  result.push_back(IddObjectType::OS_WindowMaterial_GasMixture);
+  result.push_back(IddObjectType::OS_WindowMaterial_Glazing);
+  result.push_back(IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod);
+  result.push_back(IddObjectType::OS_WindowMaterial_Screen);
+  result.push_back(IddObjectType::OS_WindowMaterial_Shade);
+  result.push_back(IddObjectType::OS_WindowMaterial_SimpleGlazingSystem);
+
+  return result;
+}
+
+void ForwardTranslator::pretranslateIndependentObjects(const model::Model & model)
+{
+  m_pretranslatedObjects.clear();
+
+  unsigned numThreads = m_numberOfThreads;
+  if (numThreads == 0){
+    numThreads = std::max(System::numberOfProcessors(), 1u);
+  }
+  if (numThreads <= 1){
+    return;
+  }
+
+  // sorting by name also fills the lazy name field cache of each IddObject before the workers
+  // read it, do the same for the EnergyPlus objects the workers will create
+  std::vector<ModelObject> modelObjects;
+  for (const IddObjectType& iddObjectType : independentIddObjectTypes()){
+    std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
+    std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+    for (const WorkspaceObject& workspaceObject : objects){
+      modelObjects.push_back(workspaceObject.cast<ModelObject>());
+    }
+  }
+
+  unsigned nThreads = std::min<unsigned>(numThreads, modelObjects.size());
+  if (nThreads <= 1){
+    return;
+  }
+
+  for (const IddObject& iddObject : IddFactory::instance().getObjects(IddFileType::EnergyPlus)){
+    iddObject.hasNameField();
+  }
+
+  // each worker translates with its own translator so that the objects it creates, its map and
+  // its log sink are not shared, workers only write to their own entries in results
+  std::vector<PretranslatedObject> results(modelObjects.size());
+  QThread* callingThread = QThread::currentThread();
+  std::atomic<size_t> next(0);
+  auto worker = [&modelObjects, &results, &next, callingThread](){
+    ForwardTranslator translator;
+    translator.m_progressBar = nullptr;
+    for (size_t i = next++; i < modelObjects.size(); i = next++){
+      PretranslatedObject& result = results[i];
+      translator.m_logSink.resetStringStream();
+      try{
+        result.result = translator.translateAndMapModelObject(modelObjects[i]);
+      }catch(...){
+        result.exception = std::current_exception();
+      }
+      result.logMessages = translator.m_logSink.logMessages();
+      result.idfObjects.swap(translator.m_idfObjects);
+
+      // hand the new objects back to the calling thread before this one exits
+      for (const IdfObject& idfObject : result.idfObjects){
+        idfObject.getImpl<openstudio::detail::IdfObject_Impl>()->moveToThread(callingThread);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < nThreads; ++i){
+    threads.push_back(std::thread(worker));
+  }
+  for (std::thread& thread : threads){
+    thread.join();
+  }
+
+  for (size_t i = 0; i < modelObjects.size(); ++i){
+    m_pretranslatedObjects.insert(std::make_pair(modelObjects[i].handle(), results[i]));
+  }
+}
+
 void ForwardTranslator::translateSchedules(const model::Model & model)
 {
 
@@ -2205,6 +2399,10 @@ void ForwardTranslator::reset()
 
   m_constructionHandleToReversedConstructions.clear();
 
+  m_pretranslatedObjects.clear();
+
+  m_pretranslatedLogMessages.clear();
+
   m_logSink.setThreadId(QThread::currentThread());
 
   m_logSink.resetStringStream();
@@ -29,6 +29,8 @@
 #include "../utilities/core/StringStreamLogSink.hpp"
 #include "../utilities/time/Time.hpp"
 
+#include <exception>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -271,6 +273,14 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModel( const model::Model & model, ProgressBar* progressBar=nullptr );
 
+  /** Translates the given Model to a Workspace without first cloning it. Translation combines
+   *  spaces into thermal zones, removes objects that are not translated and makes other edits
+   *  to the model it is given, so model is left in that state afterwards. Use this when the
+   *  model is not needed after translation, e.g. it was just loaded from disk, so that only
+   *  one copy of it is held in memory.
+   */
+  Workspace translateModelInPlace( model::Model & model, ProgressBar* progressBar=nullptr );
+
   /** Translates a ModelObject into a Workspace
    */
   Workspace translateModelObject( model::ModelObject & modelObject );
@@ -299,6 +309,12 @@ class ENERGYPLUS_API ForwardTranslator {
     */
   void setExcludeLCCObjects(bool excludeLCCObjects);
 
+  /** Set the number of threads used to translate independent objects such as curves and materials.
+    * The default of 1 translates everything on the calling thread, 0 uses one thread per processor.
+    * The translated Workspace, warnings and errors do not depend on this setting.
+   */
+  void setNumberOfThreads(unsigned numberOfThreads);
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
@@ -772,6 +788,30 @@ class ENERGYPLUS_API ForwardTranslator {
   // translate all schedules and find always on and always off schedules if they exist
   void translateSchedules(const model::Model & model);
 
+  // translate objects of independentIddObjectTypes on worker threads, results are held in
+  // m_pretranslatedObjects until translateAndMapModelObject reaches each object
+  void pretranslateIndependentObjects(const model::Model & model);
+
+  // types whose translators only read their own object, do not translate other objects and
+  // have no translated children
+  static std::vector<IddObjectType> independentIddObjectTypes();
+
+  // translation of a single object made ahead of time on a worker thread
+  struct PretranslatedObject {
+    boost::optional<IdfObject> result;
+    std::vector<IdfObject> idfObjects;
+    std::vector<LogMessage> logMessages;
+    std::exception_ptr exception;
+  };
+  std::map<Handle, PretranslatedObject> m_pretranslatedObjects;
+
+  // warnings and errors logged on worker threads, m_logSink only sees the calling thread. each is
+  // paired with the number of m_logSink messages logged before its object was merged
+  std::vector<std::pair<size_t, LogMessage> > m_pretranslatedLogMessages;
+
+  // messages of m_logSink and m_pretranslatedLogMessages in the order of a sequential run
+  std::vector<LogMessage> logMessages() const;
+
   // returns the always on schedule if found, otherwise creates one and saves for later
   IdfObject alwaysOnSchedule();
   boost::optional<IdfObject> m_alwaysOnSchedule;
@@ -877,6 +917,8 @@ class ENERGYPLUS_API ForwardTranslator {
   bool m_ipTabularOutput;
 
   bool m_excludeLCCObjects;
+
+  unsigned m_numberOfThreads;
 };
 
 namespace detail
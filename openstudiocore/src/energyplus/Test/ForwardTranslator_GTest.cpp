@@ -58,6 +58,7 @@
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/idf/IdfObject.hpp"
+#include "../../utilities/idd/IddFile.hpp"
 #include <utilities/idd/Lights_FieldEnums.hxx>
 #include <utilities/idd/OS_Schedule_Compact_FieldEnums.hxx>
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
@@ -123,6 +124,68 @@ TEST_F(EnergyPlusFixture,ForwardTranslator_ExampleModel) {
 }
 
 
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelInPlace) {
+  Model model = exampleModel();
+  unsigned numSpaces = model.getConcreteModelObjects<Space>().size();
+
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+
+  // translateModel works on a copy
+  EXPECT_EQ(numSpaces, model.getConcreteModelObjects<Space>().size());
+
+  Workspace workspaceInPlace = forwardTranslator.translateModelInPlace(model);
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+  EXPECT_EQ(workspace.numObjects(), workspaceInPlace.numObjects());
+  for (const IddObject& iddObject : workspace.iddFile().objects()){
+    EXPECT_EQ(workspace.getObjectsByType(iddObject.type()).size(), workspaceInPlace.getObjectsByType(iddObject.type()).size()) << iddObject.name();
+  }
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_NumberOfThreads) {
+  Model model = exampleModel();
+  for (unsigned i = 0; i < 20; ++i){
+    CurveBiquadratic biquadratic(model);
+    biquadratic.setCoefficient1Constant(i);
+    CurveQuadratic quadratic(model);
+    quadratic.setCoefficient2x(i);
+    StandardOpaqueMaterial material(model);
+    material.setThickness(0.01*(i + 1));
+  }
+
+  ForwardTranslator sequentialTranslator;
+  sequentialTranslator.setNumberOfThreads(1);
+  Workspace sequentialWorkspace = sequentialTranslator.translateModel(model);
+
+  ForwardTranslator parallelTranslator;
+  parallelTranslator.setNumberOfThreads(4);
+  Workspace parallelWorkspace = parallelTranslator.translateModel(model);
+
+  // output is identical, including object order
+  std::stringstream sequentialIdf;
+  sequentialWorkspace.toIdfFile().print(sequentialIdf);
+  std::stringstream parallelIdf;
+  parallelWorkspace.toIdfFile().print(parallelIdf);
+  EXPECT_EQ(sequentialIdf.str(), parallelIdf.str());
+
+  // so are the warnings and errors, in the same order
+  std::vector<LogMessage> sequentialWarnings = sequentialTranslator.warnings();
+  std::vector<LogMessage> parallelWarnings = parallelTranslator.warnings();
+  ASSERT_EQ(sequentialWarnings.size(), parallelWarnings.size());
+  for (unsigned i = 0; i < sequentialWarnings.size(); ++i){
+    EXPECT_EQ(sequentialWarnings[i].logMessage(), parallelWarnings[i].logMessage());
+  }
+
+  std::vector<LogMessage> sequentialErrors = sequentialTranslator.errors();
+  std::vector<LogMessage> parallelErrors = parallelTranslator.errors();
+  ASSERT_EQ(sequentialErrors.size(), parallelErrors.size());
+  for (unsigned i = 0; i < sequentialErrors.size(); ++i){
+    EXPECT_EQ(sequentialErrors[i].logMessage(), parallelErrors[i].logMessage());
+  }
+}
+
+
 TEST_F(EnergyPlusFixture,ForwardTranslatorTest_TranslateAirLoopHVAC) {
   openstudio::model::Model model;
   EXPECT_TRUE(model.getOptionalUniqueModelObject<Version>()) << "Blank model does not include a Version object.";
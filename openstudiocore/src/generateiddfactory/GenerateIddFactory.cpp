@@ -793,8 +793,17 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << "    std::stringstream folderString;" << std::endl
     << "    folderString << version.major() << \"_\" << version.minor() << \"_\" << version.patch().get();" << std::endl
     << "    iddPath = iddPath / toPath(folderString.str() + \"/OpenStudio.idd\");" << std::endl
-    << "    if (boost::filesystem::exists(iddPath) && (version < currentVersion)) {" << std::endl
-    << "      result = IddFile::load(iddPath);" << std::endl
+    << "    if (version < currentVersion) {" << std::endl
+    << "      // prefer a precompiled binary IDD shipped alongside the text file, then the per-user" << std::endl
+    << "      // binary cache, so only the first process to see a given version pays for parsing" << std::endl
+    << "      openstudio::path binaryPath = iddPath;" << std::endl
+    << "      binaryPath.replace_extension(toPath(\"iddb\"));" << std::endl
+    << "      if (boost::filesystem::exists(binaryPath)) {" << std::endl
+    << "        result = IddFile::loadBinary(binaryPath);" << std::endl
+    << "      }" << std::endl
+    << "      if (!result && boost::filesystem::exists(iddPath)) {" << std::endl
+    << "        result = IddFile::loadCached(iddPath);" << std::endl
+    << "      }" << std::endl
     << "    }" << std::endl
     << "    if (result) {" << std::endl
     << "      QMutexLocker l(&m_callbackmutex);" << std::endl
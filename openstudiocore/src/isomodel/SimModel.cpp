@@ -18,6 +18,12 @@
  **********************************************************************/
 #include "SimModel.hpp"
 
+#include "../utilities/core/System.hpp"
+
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #if _DEBUG || (__GNUC__ && !NDEBUG)
 #define DEBUG_ISO_MODEL_SIMULATION
 #endif
@@ -355,8 +361,8 @@ namespace isomodel {
     Vector& v_Tdbt_nt) const
   {
 
-    Matrix m_mhEgh = location->weather()->mhEgh();
-    Matrix m_mhdbt = location->weather()->mhdbt();
+    const Matrix& m_mhEgh = location->weather()->mhEgh();
+    const Matrix& m_mhdbt = location->weather()->mhdbt();
 
     Vector v_Tdbt_Day = prod(m_mhdbt,clockHourOccupied);
     v_Tdbt_Day /= sum(clockHourOccupied);
@@ -1333,8 +1339,12 @@ if T_cl_ctrl_flag ==1  % if the HVAC cooling controls are on
       
       
     
-    Vector v_Th_wk_avg = sum(sum(mult(v_Th_wk_day,frac_hrs_wk_day),mult(v_Th_wk_nt,frac_hrs_wk_nt)),mult(v_Th_wke_avg,frac_hrs_wke_tot));
-    Vector v_Tc_wk_avg = sum(sum(mult(v_Tc_wk_day,frac_hrs_wk_day),mult(v_Tc_wk_nt,frac_hrs_wk_nt)),mult(v_Tc_wke_avg,frac_hrs_wke_tot));
+    Vector v_Th_wk_avg(v_Th_wk_day.size());
+    Vector v_Tc_wk_avg(v_Tc_wk_day.size());
+    for(size_t i = 0;i<v_Th_wk_avg.size();i++){
+      v_Th_wk_avg[i] = v_Th_wk_day[i] * frac_hrs_wk_day + v_Th_wk_nt[i] * frac_hrs_wk_nt + v_Th_wke_avg[i] * frac_hrs_wke_tot;
+      v_Tc_wk_avg[i] = v_Tc_wk_day[i] * frac_hrs_wk_day + v_Tc_wk_nt[i] * frac_hrs_wk_nt + v_Tc_wke_avg[i] * frac_hrs_wke_tot;
+    }
    
 
     //v_Th_avg(v_Th_wk_avg);
@@ -1476,8 +1486,12 @@ v_qv_stack_cl=max(n_stack_coeff.*v_Q4pa*(h_stack.*abs(W.mdbt-v_Tc_avg)).^n_stack
     double n_wind_coeff = 0.0769;
     double n_dCp = 0.75;// % conventional value for cp difference between windward and leeward sides for low rise buildings as per 15242
 
-    Vector v_qv_wind_ht = mult(mult(pow(mult(mult(location->weather()->mwind(),location->weather()->mwind()), n_dCp * location->terrain()), n_wind_exp),v_Q4pa),n_wind_coeff);// % qv_wind_heating
-    Vector v_qv_wind_cl = mult(mult(pow(mult(mult(location->weather()->mwind(),location->weather()->mwind()), n_dCp * location->terrain()), n_wind_exp),v_Q4pa),n_wind_coeff);// % qv_wind_cooling
+    const Vector& v_mwind = location->weather()->mwind();
+    Vector v_qv_wind_ht(v_mwind.size());// % qv_wind_heating
+    for(size_t i = 0;i<v_mwind.size();i++){
+      v_qv_wind_ht[i] = std::pow((v_mwind[i] * v_mwind[i]) * (n_dCp * location->terrain()), n_wind_exp) * v_Q4pa * n_wind_coeff;
+    }
+    Vector v_qv_wind_cl(v_qv_wind_ht);// % qv_wind_cooling, same as heating
     
     printVector("v_qv_wind_ht",v_qv_wind_ht);
     printVector("v_qv_wind_cl",v_qv_wind_cl);
@@ -1615,9 +1629,13 @@ v_Hve_cl = n_rhoc_air*v_qve_cl/3600; % Hve (W/K/m2)  cooling
     double tau_H0=15;
     double a_H = a_H0 + tau / tau_H0;
 
-    Vector v_QT_ht = mult(mult(dif(v_Th_avg, location->weather()->mdbt()),megasecondsInMonth),H_tr);
-    Vector v_QV_ht = mult(mult(mult(v_Hve_ht,structure->floorArea()),dif(v_Th_avg, location->weather()->mdbt())),megasecondsInMonth);
-    Vector v_Qtot_ht = sum(v_QT_ht, v_QV_ht);
+    const Vector& v_mdbt = location->weather()->mdbt();
+    Vector v_Qtot_ht(v_Th_avg.size());
+    for(size_t i = 0;i<v_Th_avg.size();i++){
+      double QT_ht = (v_Th_avg[i] - v_mdbt[i]) * megasecondsInMonth[i] * H_tr;
+      double QV_ht = (v_Hve_ht[i] * structure->floorArea()) * (v_Th_avg[i] - v_mdbt[i]) * megasecondsInMonth[i];
+      v_Qtot_ht[i] = QT_ht + QV_ht;
+    }
   /*
   %% Heating and Cooling Needs
 
@@ -1665,9 +1683,12 @@ v_Qneed_ht = v_Qtot_ht - v_eta_g_H.*v_tot_mo_ht_gain; %QNH = QL,H - eta_G_H.*Q_G
 Qneed_ht_yr = sum(v_Qneed_ht);
    */
     
-    Vector v_QT_cl = mult(mult(dif(v_Tc_avg, location->weather()->mdbt()),H_tr),megasecondsInMonth);// % QT for cooling in MJ
-    Vector v_QV_cl = mult(mult(mult(v_Hve_cl, structure->floorArea()), dif(v_Tc_avg, location->weather()->mdbt())), megasecondsInMonth);// % QT for coolin in MJ
-    Vector v_Qtot_cl = sum(v_QT_cl, v_QV_cl);// % QL = QT + QV for cooling = total cooling heat loss in MJ
+    Vector v_Qtot_cl(v_Tc_avg.size());// % QL = QT + QV for cooling = total cooling heat loss in MJ
+    for(size_t i = 0;i<v_Tc_avg.size();i++){
+      double QT_cl = (v_Tc_avg[i] - v_mdbt[i]) * H_tr * megasecondsInMonth[i];// % QT for cooling in MJ
+      double QV_cl = (v_Hve_cl[i] * structure->floorArea()) * (v_Tc_avg[i] - v_mdbt[i]) * megasecondsInMonth[i];// % QT for coolin in MJ
+      v_Qtot_cl[i] = QT_cl + QV_cl;
+    }
 
     Vector v_gamma_H_cl = div(v_Qtot_cl,sum(v_tot_mo_ht_gain,std::numeric_limits<double>::min()));//  %gamma_C = heat loss ratio Qloss/Qgain 
 
@@ -2444,6 +2465,50 @@ end
             frac_hrs_wk_day);
   }
 
+  std::vector<ISOResults> SimModel::simulateAll(const std::vector<SimModel>& simModels, unsigned numberOfThreads)
+  {
+    std::vector<ISOResults> results(simModels.size());
+
+    if (numberOfThreads == 0) {
+      numberOfThreads = std::max(System::numberOfProcessors(), 1u);
+    }
+    unsigned nThreads = std::min<unsigned>(numberOfThreads, simModels.size());
+    if (nThreads <= 1) {
+      for (size_t i = 0; i < simModels.size(); ++i) {
+        results[i] = simModels[i].simulate();
+      }
+      return results;
+    }
+
+    // each model writes only its own result, the first failure is rethrown after all threads join
+    std::atomic<size_t> next(0);
+    std::vector<std::exception_ptr> errors(nThreads);
+    auto worker = [&simModels, &results, &next, &errors](unsigned threadIndex) {
+      try {
+        for (size_t i = next++; i < simModels.size(); i = next++) {
+          results[i] = simModels[i].simulate();
+        }
+      } catch (...) {
+        errors[threadIndex] = std::current_exception();
+        next = simModels.size();
+      }
+    };
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < nThreads; ++i) {
+      threads.push_back(std::thread(worker, i));
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+
+    return results;
+  }
+
   ISOResults SimModel::outputGeneration(const Vector& v_Qelec_ht,
     const Vector& v_Qcl_elec_tot,
     const Vector& v_Q_illum_tot,
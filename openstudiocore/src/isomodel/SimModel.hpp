@@ -86,6 +86,14 @@ namespace isomodel {
      *  returns ISOResults which is a vector of EndUses, one EndUses per month of the year
      */
     ISOResults simulate() const;
+
+    /*
+     *  Runs simulate() for each of simModels using up to numberOfThreads threads, or one per
+     *  processor if numberOfThreads is 0, and returns the results in the same order.
+     *  SimModels may share weather data, which is only read while simulating.
+     */
+    static std::vector<ISOResults> simulateAll(const std::vector<SimModel>& simModels, unsigned numberOfThreads = 0);
+
     REGISTER_LOGGER("openstudio.isomodel.SimModel");
 
   private:      
@@ -321,3 +321,35 @@ TEST_F(ISOModelFixture, SimModel)
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems) );
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems) );
 }
+
+TEST_F(ISOModelFixture, SimModel_SimulateAll)
+{
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+  ASSERT_TRUE(userModel.weatherData());
+
+  // variants are copies of the loaded model and share its weather data
+  std::vector<SimModel> simModels;
+  std::vector<ISOResults> expected;
+  for (int i = 0; i < 16; ++i) {
+    UserModel variant = userModel;
+    variant.setCoolingSystemCOP(2.0 + 0.25 * i);
+    variant.setHeatingSystemEfficiency(0.6 + 0.02 * i);
+    EXPECT_EQ(userModel.weatherData(), variant.weatherData());
+    simModels.push_back(variant.toSimModel());
+    expected.push_back(simModels.back().simulate());
+  }
+
+  std::vector<ISOResults> results = SimModel::simulateAll(simModels, 4);
+  ASSERT_EQ(expected.size(), results.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    ASSERT_EQ(12u, results[i].monthlyResults.size());
+    EXPECT_DOUBLE_EQ(expected[i].totalEnergyUse(), results[i].totalEnergyUse());
+  }
+
+  // variants differ, so the results should too
+  EXPECT_NE(results.front().totalEnergyUse(), results.back().totalEnergyUse());
+
+  EXPECT_TRUE(SimModel::simulateAll(std::vector<SimModel>()).empty());
+}
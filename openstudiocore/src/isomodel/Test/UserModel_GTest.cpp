@@ -806,8 +806,57 @@ TEST_F(ISOModelFixture, UserModel)
   {
     EXPECT_DOUBLE_EQ(mwindExp[v], mwind[r]);
   }
+}
+
+TEST_F(ISOModelFixture, WeatherData_Cache)
+{
+  path epw = resourcesPath() / openstudio::toPath("isomodel/weather.epw");
+  path cacheDir = openstudio::toPath("WeatherDataCache");
+  boost::filesystem::remove_all(cacheDir);
+
+  WeatherData::clearCache();
+  WeatherData::setCacheDirectory(cacheDir);
+  EXPECT_EQ(cacheDir, WeatherData::cacheDirectory());
+
+  std::shared_ptr<WeatherData> computed = WeatherData::load(epw);
+  ASSERT_TRUE(computed);
+  EXPECT_FALSE(boost::filesystem::is_empty(cacheDir));
 
+  // served from memory, each caller gets its own copy
+  std::shared_ptr<WeatherData> cached = WeatherData::load(epw);
+  ASSERT_TRUE(cached);
+  EXPECT_NE(computed.get(), cached.get());
 
+  // read back from the cache directory
+  WeatherData::clearCache();
+  std::shared_ptr<WeatherData> saved = WeatherData::load(epw);
+  ASSERT_TRUE(saved);
+
+  for (const std::shared_ptr<WeatherData>& wd : {cached, saved}) {
+    ASSERT_EQ(computed->msolar().size1(), wd->msolar().size1());
+    ASSERT_EQ(computed->msolar().size2(), wd->msolar().size2());
+    for (size_t r = 0; r < computed->msolar().size1(); ++r) {
+      for (size_t c = 0; c < computed->msolar().size2(); ++c) {
+        EXPECT_EQ(computed->msolar()(r, c), wd->msolar()(r, c));
+      }
+    }
+    for (size_t r = 0; r < computed->mhdbt().size1(); ++r) {
+      for (size_t c = 0; c < computed->mhdbt().size2(); ++c) {
+        EXPECT_EQ(computed->mhdbt()(r, c), wd->mhdbt()(r, c));
+        EXPECT_EQ(computed->mhEgh()(r, c), wd->mhEgh()(r, c));
+      }
+    }
+    ASSERT_EQ(computed->mEgh().size(), wd->mEgh().size());
+    for (size_t r = 0; r < computed->mEgh().size(); ++r) {
+      EXPECT_EQ(computed->mEgh()[r], wd->mEgh()[r]);
+      EXPECT_EQ(computed->mdbt()[r], wd->mdbt()[r]);
+      EXPECT_EQ(computed->mwind()[r], wd->mwind()[r]);
+    }
+  }
 
+  EXPECT_THROW(WeatherData::load(openstudio::toPath("missing.epw")), std::exception);
 
+  WeatherData::setCacheDirectory(path());
+  WeatherData::clearCache();
+  boost::filesystem::remove_all(cacheDir);
 }
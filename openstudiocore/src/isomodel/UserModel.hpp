@@ -44,6 +44,14 @@ namespace isomodel {
      */
     std::shared_ptr<WeatherData> loadWeather();
 
+    /**
+     * Weather data used by toSimModel, loaded on first use if not set.
+     * Variants of one building can share a single loaded WeatherData
+     * by setting it on each of them, copies of a UserModel share it already.
+     */
+    std::shared_ptr<WeatherData> weatherData() const {return _weather;}
+    void setWeatherData(const std::shared_ptr<WeatherData>& value){_weather = value;}
+
     /**
      * Loads an ISO model from the specified .ISO file
      */
@@ -16,14 +16,242 @@
  *  License along with this library; if not, write to the Free Software
  *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  **********************************************************************/
-
 #include "WeatherData.hpp"
+#include "EpwData.hpp"
+
+#include "../utilities/core/Checksum.hpp"
+
+#include <boost/filesystem/fstream.hpp>
 
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
 
 namespace openstudio {
 namespace isomodel {
 
-// nothing to see here
+namespace {
+
+  // first line of a saved file, bump the version if the format or the calculation changes
+  const char* const cacheFileHeader = "OpenStudio ISO Model Weather 1";
+
+  std::mutex &cacheMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  std::map<std::string, std::shared_ptr<const WeatherData> > &memoryCache()
+  {
+    static std::map<std::string, std::shared_ptr<const WeatherData> > cache;
+    return cache;
+  }
+
+  openstudio::path &cacheDirectoryPath()
+  {
+    static openstudio::path cacheDirectory;
+    return cacheDirectory;
+  }
+
+  void writeVector(std::ostream &os, const Vector &vec)
+  {
+    os << vec.size();
+    for (size_t i = 0; i < vec.size(); ++i) {
+      os << " " << vec[i];
+    }
+    os << std::endl;
+  }
+
+  void writeMatrix(std::ostream &os, const Matrix &mat)
+  {
+    os << mat.size1() << " " << mat.size2();
+    for (size_t i = 0; i < mat.size1(); ++i) {
+      for (size_t j = 0; j < mat.size2(); ++j) {
+        os << " " << mat(i, j);
+      }
+    }
+    os << std::endl;
+  }
+
+  bool readVector(std::istream &is, Vector &vec)
+  {
+    size_t size = 0;
+    if (!(is >> size) || (size > 8760)) {
+      return false;
+    }
+    vec = Vector(size);
+    for (size_t i = 0; i < size; ++i) {
+      if (!(is >> vec[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool readMatrix(std::istream &is, Matrix &mat)
+  {
+    size_t size1 = 0;
+    size_t size2 = 0;
+    if (!(is >> size1 >> size2) || (size1 * size2 > 8760)) {
+      return false;
+    }
+    mat = Matrix(size1, size2);
+    for (size_t i = 0; i < size1; ++i) {
+      for (size_t j = 0; j < size2; ++j) {
+        if (!(is >> mat(i, j))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  void writeWeatherData(std::ostream &os, const WeatherData &weather)
+  {
+    os << cacheFileHeader << std::endl;
+    os << std::setprecision(std::numeric_limits<double>::max_digits10);
+    writeVector(os, weather.mEgh());
+    writeVector(os, weather.mdbt());
+    writeVector(os, weather.mwind());
+    writeMatrix(os, weather.msolar());
+    writeMatrix(os, weather.mhdbt());
+    writeMatrix(os, weather.mhEgh());
+  }
+
+  std::shared_ptr<WeatherData> readWeatherData(std::istream &is)
+  {
+    std::string header;
+    if (!std::getline(is, header) || (header != cacheFileHeader)) {
+      return std::shared_ptr<WeatherData>();
+    }
+
+    Vector mEgh, mdbt, mwind;
+    Matrix msolar, mhdbt, mhEgh;
+    if (!readVector(is, mEgh) || !readVector(is, mdbt) || !readVector(is, mwind) ||
+        !readMatrix(is, msolar) || !readMatrix(is, mhdbt) || !readMatrix(is, mhEgh))
+    {
+      return std::shared_ptr<WeatherData>();
+    }
+
+    std::shared_ptr<WeatherData> result(new WeatherData);
+    result->setMEgh(mEgh);
+    result->setMdbt(mdbt);
+    result->setMwind(mwind);
+    result->setMsolar(msolar);
+    result->setMhdbt(mhdbt);
+    result->setMhEgh(mhEgh);
+    return result;
+  }
+
+  std::shared_ptr<WeatherData> computeWeatherData(const openstudio::path &epwPath)
+  {
+    EpwData edata(epwPath);
+
+    Matrix _msolar(12,8,0);
+    Matrix _mhdbt(12,24,0);
+    Matrix _mhEgh(12,24,0);
+    Vector _mEgh(12);
+    Vector _mdbt(12);
+    Vector _mwind(12);
+
+    edata.toISOData(_msolar, _mhdbt, _mhEgh, _mEgh, _mdbt, _mwind);
+
+    std::shared_ptr<WeatherData> wdata(new WeatherData);
+    wdata->setMdbt(_mdbt);
+    wdata->setMEgh(_mEgh);
+    wdata->setMhdbt(_mhdbt);
+    wdata->setMhEgh(_mhEgh);
+    wdata->setMsolar(_msolar);
+    wdata->setMwind(_mwind);
+
+    return wdata;
+  }
+
+}
+
+std::shared_ptr<WeatherData> WeatherData::load(const openstudio::path &epwPath)
+{
+  if (!boost::filesystem::is_regular_file(epwPath)) {
+    throw std::runtime_error("Unable to open weather file: " + openstudio::toString(epwPath));
+  }
+
+  // toISOData always uses the same surface tilt and orientations, so the file contents are the
+  // only input, the size guards against checksum collisions between climates
+  std::stringstream ss;
+  ss << openstudio::checksum(epwPath) << "-" << boost::filesystem::file_size(epwPath);
+  std::string key = ss.str();
+
+  openstudio::path cacheDirectory;
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex());
+    auto it = memoryCache().find(key);
+    if (it != memoryCache().end()) {
+      return std::shared_ptr<WeatherData>(new WeatherData(*it->second));
+    }
+    cacheDirectory = cacheDirectoryPath();
+  }
+
+  std::shared_ptr<WeatherData> result;
+  openstudio::path cacheFile;
+  if (!cacheDirectory.empty()) {
+    cacheFile = cacheDirectory / openstudio::toPath(key + ".isoweather");
+    boost::filesystem::ifstream ifs(cacheFile);
+    if (ifs) {
+      result = readWeatherData(ifs);
+      if (!result) {
+        LOG(Warn, "Ignoring unreadable weather cache file " << openstudio::toString(cacheFile));
+      }
+    }
+  }
+
+  if (!result) {
+    result = computeWeatherData(epwPath);
+
+    if (!cacheFile.empty()) {
+      // write to a temporary file and rename so other processes never read a partial file
+      try {
+        boost::filesystem::create_directories(cacheDirectory);
+        openstudio::path tempFile = cacheFile;
+        tempFile.replace_extension(openstudio::toPath(".isoweather." + openstudio::toString(boost::filesystem::unique_path())));
+        {
+          boost::filesystem::ofstream ofs(tempFile);
+          writeWeatherData(ofs, *result);
+        }
+        boost::filesystem::rename(tempFile, cacheFile);
+      } catch (const std::exception &e) {
+        LOG(Warn, "Unable to save weather cache file " << openstudio::toString(cacheFile) << ": " << e.what());
+      }
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex());
+    memoryCache()[key] = std::shared_ptr<const WeatherData>(new WeatherData(*result));
+  }
+
+  return result;
+}
+
+openstudio::path WeatherData::cacheDirectory()
+{
+  std::lock_guard<std::mutex> lock(cacheMutex());
+  return cacheDirectoryPath();
+}
+
+void WeatherData::setCacheDirectory(const openstudio::path &cacheDirectory)
+{
+  std::lock_guard<std::mutex> lock(cacheMutex());
+  cacheDirectoryPath() = cacheDirectory;
+}
+
+void WeatherData::clearCache()
+{
+  std::lock_guard<std::mutex> lock(cacheMutex());
+  memoryCache().clear();
+}
 
 }
 }
@@ -20,9 +20,13 @@
 #define ISOMODEL_WEATHERDATA_HPP
 
 #include "ISOModelAPI.hpp"
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
 #include "../utilities/data/Vector.hpp"
 #include "../utilities/data/Matrix.hpp"
 
+#include <memory>
+
 namespace openstudio {
 namespace isomodel {
 
@@ -62,7 +66,29 @@ public:
   void setMsolar(const Matrix &val){_msolar = val;}
   void setMhdbt(const Matrix &val){_mhdbt = val;}
 
+  /**
+   * Computes the monthly weather data for the EPW file at epwPath. Results are kept for the
+   * life of the process, keyed by the checksum and size of the file, so loading the same
+   * climate again skips parsing the file and the solar radiation pass. If a cache directory
+   * is set, results are also saved there and reused by later processes.
+   * Each call returns a separate copy. Throws if the weather file cannot be read.
+   */
+  static std::shared_ptr<WeatherData> load(const openstudio::path &epwPath);
+
+  /**
+   * Directory that load() saves results to and reads them from, empty (not used) by default.
+   */
+  static openstudio::path cacheDirectory();
+  static void setCacheDirectory(const openstudio::path &cacheDirectory);
+
+  /**
+   * Forgets the results kept in memory by load(), files in the cache directory are kept.
+   */
+  static void clearCache();
+
 private:
+  REGISTER_LOGGER("openstudio.isomodel.WeatherData");
+
   Matrix _msolar;
   Matrix _mhdbt;
   Matrix _mhEgh;
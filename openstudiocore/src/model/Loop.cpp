@@ -39,25 +39,180 @@
 #include "AirLoopHVACOutdoorAirSystem_Impl.hpp"
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
+#include "Connection.hpp"
+#include "Connection_Impl.hpp"
 #include "Model.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
+#include "../utilities/idf/WorkspaceObject_Impl.hpp"
+
 #include "../utilities/core/Assert.hpp"
 
+#include <map>
+#include <set>
+
 namespace openstudio {
 
 namespace model {
 
 namespace detail {
+
+  // Adjacency of the loop's components, read lazily from HVACComponent_Impl::edges once per
+  // component and side, and the component lists computed from it.
+  class LoopTopology {
+   public:
+
+    explicit LoopTopology(const Loop_Impl* loop)
+      : m_loop(loop)
+    {}
+
+    const std::vector<HVACComponent>& edges(const HVACComponent& component, bool isDemandComponents)
+    {
+      std::map<Handle, std::vector<HVACComponent> >& sideEdges = m_edges[isDemandComponents ? 1 : 0];
+      auto it = sideEdges.find(component.handle());
+      if( it == sideEdges.end() ) {
+        m_loop->watchTopology(component);
+        for( const WorkspaceObject& target : component.targets() ) {
+          IddObjectType targetType = target.iddObject().type();
+          if( targetType == Connection::iddObjectType() || targetType == PortList::iddObjectType() ) {
+            m_loop->watchTopology(target);
+          }
+        }
+        std::vector<HVACComponent> componentEdges = component.getImpl<HVACComponent_Impl>()->edges(isDemandComponents);
+        it = sideEdges.insert(std::make_pair(component.handle(), componentEdges)).first;
+      }
+      return it->second;
+    }
+
+    // All components on any path from inletComp to outletComp, in the order of a depth first search.
+    const std::vector<ModelObject>& components(const HVACComponent& inletComp, const HVACComponent& outletComp, bool isDemandComponents)
+    {
+      std::map<std::pair<Handle, Handle>, std::vector<ModelObject> >& sideComponents = m_components[isDemandComponents ? 1 : 0];
+      std::pair<Handle, Handle> key(inletComp.handle(), outletComp.handle());
+      auto it = sideComponents.find(key);
+      if( it != sideComponents.end() ) {
+        return it->second;
+      }
+
+      std::vector<ModelObject> paths;
+      if( inletComp == outletComp ) {
+        paths.push_back(inletComp);
+      } else {
+        std::vector<HVACComponent> visited;
+        visited.push_back(inletComp);
+        std::set<Handle> onPath;
+        onPath.insert(inletComp.handle());
+        std::set<Handle> inPaths;
+        std::map<Handle, bool> reachesSink;
+        findModelObjects(outletComp, visited, onPath, paths, inPaths, reachesSink, isDemandComponents);
+      }
+
+      return sideComponents.insert(std::make_pair(key, paths)).first->second;
+    }
+
+    // Any component reachable from inletComp without passing outletComp.
+    boost::optional<ModelObject> component(const Handle& handle, const HVACComponent& inletComp, const HVACComponent& outletComp, bool isDemandComponents)
+    {
+      std::vector<HVACComponent> stack;
+      stack.push_back(inletComp);
+      std::set<Handle> seen;
+      seen.insert(inletComp.handle());
+      seen.insert(outletComp.handle());
+      while( ! stack.empty() ) {
+        HVACComponent hvacComponent = stack.back();
+        stack.pop_back();
+        if( hvacComponent.handle() == handle ) {
+          return hvacComponent;
+        }
+        for( const auto & edge : edges(hvacComponent, isDemandComponents) ) {
+          if( seen.insert(edge.handle()).second ) {
+            stack.push_back(edge);
+          }
+        }
+      }
+      return boost::none;
+    }
+
+   private:
+
+    // Depth first search from the back of visited to sink, visiting components in the same order
+    // as enumerating every path. reachesSink remembers components already searched so that each
+    // is expanded once; the sides of a loop are acyclic so the answer does not depend on the path.
+    // Returns true if sink is reachable.
+    bool findModelObjects(const HVACComponent & sink,
+                          std::vector<HVACComponent> & visited,
+                          std::set<Handle> & onPath,
+                          std::vector<ModelObject> & paths,
+                          std::set<Handle> & inPaths,
+                          std::map<Handle, bool> & reachesSink,
+                          bool isDemandComponents)
+    {
+      bool result = false;
+      std::vector<HVACComponent> nodes = edges(visited.back(), isDemandComponents);
+
+      for( const auto & node : nodes )
+      {
+        if( onPath.find(node.handle()) != onPath.end() ) {
+          continue;
+        }
+        if( node == sink ) {
+          visited.push_back(node);
+          addPath(visited, paths, inPaths);
+          visited.pop_back();
+          result = true;
+        }
+      }
+
+      for( const auto & node : nodes )
+      {
+        if( onPath.find(node.handle()) != onPath.end() || node == sink ) {
+          continue;
+        }
+
+        visited.push_back(node);
+        auto it = reachesSink.find(node.handle());
+        if( it == reachesSink.end() ) {
+          onPath.insert(node.handle());
+          bool nodeReachesSink = findModelObjects(sink, visited, onPath, paths, inPaths, reachesSink, isDemandComponents);
+          onPath.erase(node.handle());
+          it = reachesSink.insert(std::make_pair(node.handle(), nodeReachesSink)).first;
+        } else if( it->second ) {
+          // the rest of every path through node is already in paths
+          addPath(visited, paths, inPaths);
+        }
+        visited.pop_back();
+
+        result = result || it->second;
+      }
+
+      return result;
+    }
+
+    static void addPath(const std::vector<HVACComponent> & visited, std::vector<ModelObject> & paths, std::set<Handle> & inPaths)
+    {
+      for( const auto & component : visited ) {
+        if( inPaths.insert(component.handle()).second ) {
+          paths.push_back(component);
+        }
+      }
+    }
+
+    const Loop_Impl* m_loop;
+    std::map<Handle, std::vector<HVACComponent> > m_edges[2];
+    std::map<std::pair<Handle, Handle>, std::vector<ModelObject> > m_components[2];
+  };
+
   Loop_Impl::Loop_Impl(IddObjectType type, Model_Impl* model)
     : ParentObject_Impl(type,model)
   {
+    connect(this, &Loop_Impl::onInvalidateCaches, this, &Loop_Impl::clearTopology);
   }
 
   Loop_Impl::Loop_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : ParentObject_Impl(idfObject, model, keepHandle)
   { 
+    connect(this, &Loop_Impl::onInvalidateCaches, this, &Loop_Impl::clearTopology);
   }
 
   Loop_Impl::Loop_Impl(
@@ -66,6 +221,7 @@ namespace detail {
       bool keepHandle)
     : ParentObject_Impl(other,model,keepHandle)
   {
+    connect(this, &Loop_Impl::onInvalidateCaches, this, &Loop_Impl::clearTopology);
   }
 
   Loop_Impl::Loop_Impl(const Loop_Impl& other, 
@@ -73,6 +229,45 @@ namespace detail {
       bool keepHandles)
     : ParentObject_Impl(other,model,keepHandles)
   {
+    connect(this, &Loop_Impl::onInvalidateCaches, this, &Loop_Impl::clearTopology);
+  }
+
+  std::shared_ptr<LoopTopology> Loop_Impl::topology() const
+  {
+    if( ! m_topology ) {
+      m_topology = std::make_shared<LoopTopology>(this);
+    }
+    return m_topology;
+  }
+
+  void Loop_Impl::watchTopology(const WorkspaceObject& object) const
+  {
+    Loop_Impl* receiver = const_cast<Loop_Impl*>(this);
+    std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+    connect(impl.get(), &openstudio::detail::WorkspaceObject_Impl::onInvalidateCaches, receiver, &Loop_Impl::clearTopology, Qt::UniqueConnection);
+    connect(impl.get(), &openstudio::detail::WorkspaceObject_Impl::onRemoveFromWorkspace, receiver, &Loop_Impl::clearTopology, Qt::UniqueConnection);
+  }
+
+  void Loop_Impl::clearTopology()
+  {
+    m_topology.reset();
+  }
+
+  std::vector<ModelObject> Loop_Impl::filterComponents(const std::vector<ModelObject>& components, openstudio::IddObjectType type) const
+  {
+    if( type == IddObjectType::Catchall ) {
+      return components;
+    }
+
+    std::vector<ModelObject> reducedModelObjects;
+    for( const auto & component : components )
+    {
+      if( type == component.iddObject().type() )
+      {
+        reducedModelObjects.push_back(component);
+      }
+    }
+    return reducedModelObjects;
   }
 
   const std::vector<std::string>& Loop_Impl::outputVariableNames() const
@@ -106,35 +301,6 @@ namespace detail {
     return ParentObject_Impl::remove();
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // searches all paths of nodes between the source and sink until a handle match is found
-  boost::optional<ModelObject> findModelObject(const openstudio::Handle & handle, const HVACComponent & sink, std::vector<HVACComponent> & visited, bool isDemandComponents)
-  {
-    HVACComponent hvacComponent = visited.back();
-    if( handle == hvacComponent.handle() ) { 
-      return hvacComponent;
-    }
-    std::vector<HVACComponent> nodes = hvacComponent.getImpl<HVACComponent_Impl>()->edges(isDemandComponents);
-
-    for(std::vector<HVACComponent>::iterator it = nodes.begin();
-        it != nodes.end();
-        it++)
-    {
-      // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(), visited.end(), *it) != visited.end() ||
-          *it == sink )
-      {
-        continue; 
-      }
-      visited.push_back(*it);
-      boost::optional<ModelObject> foundHandle = findModelObject(handle, sink, visited, isDemandComponents);
-      if( foundHandle ) { return *foundHandle; }
-      visited.pop_back();
-    }
-    return boost::none;
-  }
-
   OptionalModelObject Loop_Impl::component(openstudio::Handle handle)
   {
     boost::optional<ModelObject> supplyComp = this->supplyComponent(handle);
@@ -148,9 +314,7 @@ namespace detail {
     Node outletComp = this->demandOutletNode();
     if( handle == inletComp.handle() ) { return inletComp; }
     if( handle == outletComp.handle() ) { return outletComp; }
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    return findModelObject(handle, outletComp, visited, true);
+    return topology()->component(handle, inletComp, outletComp, true);
   }
 
   boost::optional<ModelObject> Loop_Impl::supplyComponent(openstudio::Handle handle) const
@@ -159,9 +323,7 @@ namespace detail {
     Node outletComp = this->supplyOutletNode();
     if( handle == inletComp.handle() ) { return inletComp; }
     if( handle == outletComp.handle() ) { return outletComp; }
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    return findModelObject(handle, outletComp, visited, false);
+    return topology()->component(handle, inletComp, outletComp, false);
   }
 
   ModelObject Loop_Impl::clone(Model model) const
@@ -230,87 +392,12 @@ namespace detail {
     return result;
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // when complete, paths will be populated with all nodes between the source node and sink
-  void findModelObjects(const HVACComponent & sink, std::vector<HVACComponent> & visited, std::vector<HVACComponent> & paths, bool isDemandComponents)
-  {
-    std::vector<HVACComponent> nodes = visited.back().getImpl<HVACComponent_Impl>()->edges(isDemandComponents);
-
-    for(const auto & node : nodes)
-    {
-      // if it node has already been visited then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() )
-      {
-        continue; 
-      }
-      if( node == sink )
-      {
-        visited.push_back(node);
-        // Avoid pushing duplicate nodes into paths
-        if( paths.empty() )
-        {
-          paths.insert(paths.end(), visited.begin(), visited.end());
-        }
-        else
-        {
-          for( const auto & visitedit : visited )
-          {
-            if( std::find(paths.begin(),paths.end(),visitedit) == paths.end() )
-            {
-              paths.push_back(visitedit);
-            }
-          }
-        }
-        visited.pop_back();
-      }
-    }
-
-    for(const auto & node : nodes)
-    {
-      // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() ||
-          node == sink )
-      {
-        continue;
-      }
-      visited.push_back(node);
-      findModelObjects(sink, visited, paths, isDemandComponents);
-      visited.pop_back();
-    }
-  }
-
   std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type ) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, true);
-    }
-    std::vector<ModelObject> _demandComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
-
-    // Filter modelObjects for type
-    if( type == IddObjectType::Catchall ) {
-      return _demandComponents;
-    }
-    std::vector<ModelObject> reducedModelObjects;
-    
-    for(const auto & demandComponent : _demandComponents)
-    {
-      if( type == demandComponent.iddObject().type() )
-      {
-        reducedModelObjects.push_back(demandComponent);
-      }
-    }
-
-    return reducedModelObjects;
+    std::shared_ptr<LoopTopology> t_topology = topology();
+    return filterComponents(t_topology->components(inletComp, outletComp, true), type);
   }
 
   std::vector<ModelObject> Loop_Impl::supplyComponents(openstudio::IddObjectType type) const
@@ -343,33 +430,58 @@ namespace detail {
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
+    std::shared_ptr<LoopTopology> t_topology = topology();
+    return filterComponents(t_topology->components(inletComp, outletComp, false), type);
+  }
 
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, false);
+  std::vector<std::vector<ModelObject> > Loop_Impl::supplyBranches() const
+  {
+    return branches(false);
+  }
+
+  std::vector<std::vector<ModelObject> > Loop_Impl::demandBranches() const
+  {
+    return branches(true);
+  }
+
+  std::vector<std::vector<ModelObject> > Loop_Impl::branches(bool isDemandComponents) const
+  {
+    std::vector<std::vector<ModelObject> > result;
+
+    std::shared_ptr<LoopTopology> t_topology = topology();
+    std::vector<ModelObject> sideComponents;
+    if( isDemandComponents ) {
+      sideComponents = t_topology->components(demandInletNode(), demandOutletNode(), true);
+    } else {
+      sideComponents = t_topology->components(supplyInletNode(), supplyOutletNode(), false);
     }
-    std::vector<ModelObject> _supplyComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
 
-    // Filter modelObjects for type
-    if( type == IddObjectType::Catchall ) {
-      return _supplyComponents;
+    boost::optional<Splitter> splitter;
+    for( const auto & sideComponent : sideComponents ) {
+      if( (splitter = sideComponent.optionalCast<Splitter>()) ) {
+        break;
+      }
     }
-    std::vector<ModelObject> reducedModelObjects;
-    
-    for(const auto & supplyComponent : _supplyComponents)
-    {
-      if( type == supplyComponent.iddObject().type() )
-      {
-        reducedModelObjects.push_back(supplyComponent);
+    if( ! splitter ) {
+      return result;
+    }
+
+    for( const auto & branchInlet : t_topology->edges(*splitter, isDemandComponents) ) {
+      std::vector<ModelObject> branch;
+      std::set<Handle> seen;
+      HVACComponent hvacComponent = branchInlet;
+      while( ! hvacComponent.optionalCast<Mixer>() && seen.insert(hvacComponent.handle()).second ) {
+        branch.push_back(hvacComponent);
+        const std::vector<HVACComponent>& nextComponents = t_topology->edges(hvacComponent, isDemandComponents);
+        if( nextComponents.size() != 1u ) {
+          break;
+        }
+        hvacComponent = nextComponents.front();
       }
+      result.push_back(branch);
     }
 
-    return reducedModelObjects;
+    return result;
   }
 
   std::vector<ModelObject> Loop_Impl::components(HVACComponent inletComp,
@@ -512,6 +624,16 @@ Mixer Loop::demandMixer() const
   return getImpl<detail::Loop_Impl>()->demandMixer();
 }
 
+std::vector<std::vector<ModelObject> > Loop::supplyBranches() const
+{
+  return getImpl<detail::Loop_Impl>()->supplyBranches();
+}
+
+std::vector<std::vector<ModelObject> > Loop::demandBranches() const
+{
+  return getImpl<detail::Loop_Impl>()->demandBranches();
+}
+
 } // model
 
 } // openstudio
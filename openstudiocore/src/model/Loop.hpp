@@ -194,6 +194,17 @@ class MODEL_API Loop : public ParentObject {
 
   Mixer demandMixer() const;
 
+  /** Returns the components on each branch of the first splitter on the supply side, in
+   * splitter outlet order.  Each branch runs from the splitter outlet up to, but not including,
+   * the mixer.  If the supply side has no splitter an empty vector is returned.
+   */
+  std::vector<std::vector<ModelObject> > supplyBranches() const;
+
+  /** Returns the components on each branch of the demand splitter, in splitter outlet order.
+   * Each branch runs from the splitter outlet up to, but not including, the demand mixer.
+   */
+  std::vector<std::vector<ModelObject> > demandBranches() const;
+
   virtual ModelObject clone(Model model) const;
 
   virtual std::vector<ModelObject> children() const;
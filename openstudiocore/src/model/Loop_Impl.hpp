@@ -35,6 +35,8 @@ namespace detail {
 
   class Model_Impl;
 
+  class LoopTopology;
+
   class MODEL_API Loop_Impl : public ParentObject_Impl {
 
     Q_OBJECT;
@@ -111,10 +113,33 @@ namespace detail {
 
     virtual Mixer demandMixer() = 0;
 
+    std::vector<std::vector<ModelObject> > supplyBranches() const;
+
+    std::vector<std::vector<ModelObject> > demandBranches() const;
+
+  private slots:
+
+    void clearTopology();
+
   private:
 
     REGISTER_LOGGER("openstudio.model.Loop");
 
+    friend class LoopTopology;
+
+    // Successor lists read from HVACComponent_Impl::edges and the traversals built on them.
+    // Held by shared_ptr so a traversal in progress survives clearTopology.
+    std::shared_ptr<LoopTopology> topology() const;
+
+    // Clears the topology when object changes or is removed.
+    void watchTopology(const WorkspaceObject& object) const;
+
+    std::vector<ModelObject> filterComponents(const std::vector<ModelObject>& components, openstudio::IddObjectType type) const;
+
+    std::vector<std::vector<ModelObject> > branches(bool isDemandComponents) const;
+
+    mutable std::shared_ptr<LoopTopology> m_topology;
+
     // TODO: Make these const.
     boost::optional<ModelObject> supplyInletNodeAsModelObject();
     boost::optional<ModelObject> supplyOutletNodeAsModelObject();
@@ -27,6 +27,10 @@
 #include "ScheduleDay_Impl.hpp"
 
 #include "../utilities/idf/ValidityReport.hpp"
+#include "../utilities/idf/WorkspaceObject_Impl.hpp"
+
+#include "../utilities/time/Date.hpp"
+#include "../utilities/time/Time.hpp"
 
 #include "../utilities/core/Assert.hpp"
 
@@ -47,17 +51,72 @@ namespace detail {
   // constructor
   Schedule_Impl::Schedule_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : ScheduleBase_Impl(idfObject, model, keepHandle)
-  {}
+  {
+    connect(this, &Schedule_Impl::onInvalidateCaches, this, &Schedule_Impl::clearCompiledValues);
+  }
 
   Schedule_Impl::Schedule_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
                                Model_Impl* model,
                                bool keepHandle)
     : ScheduleBase_Impl(other, model,keepHandle)
-  {}
+  {
+    connect(this, &Schedule_Impl::onInvalidateCaches, this, &Schedule_Impl::clearCompiledValues);
+  }
 
   Schedule_Impl::Schedule_Impl(const Schedule_Impl& other, Model_Impl* model,bool keepHandles)
     : ScheduleBase_Impl(other, model,keepHandles)
-  {}
+  {
+    connect(this, &Schedule_Impl::onInvalidateCaches, this, &Schedule_Impl::clearCompiledValues);
+  }
+
+  std::vector<double> Schedule_Impl::timestepValues(int year, unsigned timestepsPerHour) const
+  {
+    if ((timestepsPerHour == 0) || (60 % timestepsPerHour != 0)){
+      LOG(Error, "Cannot compile " << briefDescription() << " with " << timestepsPerHour << " timesteps per hour, must divide 60.");
+      return std::vector<double>();
+    }
+
+    std::pair<int, unsigned> key(year, timestepsPerHour);
+    auto it = m_compiledValues.find(key);
+    if (it != m_compiledValues.end()){
+      return it->second;
+    }
+
+    std::vector<ModelObject> dependencies;
+    std::vector<double> result = compileTimestepValues(year, timestepsPerHour, dependencies);
+
+    // any edit to an object the result was read from, or its removal, invalidates the cache
+    Schedule_Impl* receiver = const_cast<Schedule_Impl*>(this);
+    for (const ModelObject& dependency : dependencies){
+      std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = dependency.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+      if (!impl || (impl.get() == receiver)){
+        continue;
+      }
+      connect(impl.get(), &openstudio::detail::WorkspaceObject_Impl::onInvalidateCaches, receiver, &Schedule_Impl::clearCompiledValues, Qt::UniqueConnection);
+      connect(impl.get(), &openstudio::detail::WorkspaceObject_Impl::onRemoveFromWorkspace, receiver, &Schedule_Impl::clearCompiledValues, Qt::UniqueConnection);
+    }
+
+    m_compiledValues[key] = result;
+
+    return result;
+  }
+
+  std::vector<openstudio::Date> Schedule_Impl::datesInYear(int year)
+  {
+    std::vector<openstudio::Date> result;
+    openstudio::Date date(MonthOfYear::Jan, 1, year);
+    openstudio::Date endDate(MonthOfYear::Dec, 31, year);
+    while (date <= endDate){
+      result.push_back(date);
+      date += Time(1);
+    }
+    return result;
+  }
+
+  void Schedule_Impl::clearCompiledValues()
+  {
+    m_compiledValues.clear();
+  }
 
   bool Schedule_Impl::candidateIsCompatibleWithCurrentUse(const ScheduleTypeLimits& candidate) const {
     ModelObjectVector users = getObject<Schedule>().getModelObjectSources<ModelObject>();
@@ -96,6 +155,11 @@ Schedule::Schedule(IddObjectType type,const Model& model)
   OS_ASSERT(getImpl<detail::Schedule_Impl>());
 }
 
+std::vector<double> Schedule::timestepValues(int year, unsigned timestepsPerHour) const
+{
+  return getImpl<detail::Schedule_Impl>()->timestepValues(year, timestepsPerHour);
+}
+
 // constructor from impl
 Schedule::Schedule(std::shared_ptr<detail::Schedule_Impl> impl)
   : ScheduleBase(impl)
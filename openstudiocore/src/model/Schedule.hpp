@@ -52,6 +52,16 @@ class MODEL_API Schedule : public ScheduleBase {
 
   virtual ~Schedule() {}
 
+  //@}
+  /** @name Other */
+  //@{
+
+  /** Returns the value of this schedule at the end of each timestep of calendar year year, in
+   *  order starting with the first timestep of January 1st. timestepsPerHour must divide 60.
+   *  Holiday, special day and design day schedules are not applied. The result is cached until
+   *  this schedule or any object it references changes, so repeated calls are cheap. */
+  std::vector<double> timestepValues(int year, unsigned timestepsPerHour) const;
+
   //@}
  protected:
   /// @cond
@@ -23,6 +23,7 @@
 
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
+#include "ScheduleDay_Impl.hpp"
 
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 
@@ -30,6 +31,14 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/time/Date.hpp"
+#include "../utilities/time/Time.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <set>
 
 using openstudio::Handle;
 using openstudio::OptionalHandle;
@@ -43,6 +52,71 @@ using openstudio::Workspace;
 namespace openstudio {
 namespace model {
 
+namespace {
+
+  // values of the Interpolate: field, Yes is the same as Average
+  enum CompactInterpolation { NoInterpolation, AverageInterpolation, LinearInterpolation };
+
+  // one For: block of a compact schedule
+  struct CompactDayProfile {
+    CompactDayProfile()
+      : allOtherDays(false), interpolate(NoInterpolation)
+    {}
+
+    std::set<int> daysOfWeek;
+    bool allOtherDays;
+    CompactInterpolation interpolate;
+    std::vector<openstudio::Time> times;
+    std::vector<double> values;
+  };
+
+  // one Through: block of a compact schedule, throughKey is 100*month + day
+  struct CompactPeriod {
+    unsigned throughKey;
+    std::vector<CompactDayProfile> profiles;
+  };
+
+  // each timestep takes the time weighted average of the Until: values in effect during it
+  std::vector<double> averageTimestepValues(const std::vector<openstudio::Time>& times,
+                                            const std::vector<double>& values,
+                                            unsigned timestepsPerHour)
+  {
+    unsigned numTimesteps = 24 * timestepsPerHour;
+    std::vector<double> result(numTimesteps, 0.0);
+
+    double start = 0.0;
+    for (unsigned i = 0; i < times.size(); ++i) {
+      double end = std::min(times[i].totalDays(), 1.0);
+      if (end <= start) {
+        continue;
+      }
+      for (unsigned j = static_cast<unsigned>(start * numTimesteps); j < numTimesteps; ++j) {
+        double timestepStart = j / static_cast<double>(numTimesteps);
+        double timestepEnd = (j + 1) / static_cast<double>(numTimesteps);
+        if (timestepStart >= end) {
+          break;
+        }
+        double overlap = std::min(end, timestepEnd) - std::max(start, timestepStart);
+        if (overlap > 0.0) {
+          result[j] += values[i] * overlap * numTimesteps;
+        }
+      }
+      start = end;
+    }
+
+    return result;
+  }
+
+  // text after the first ':' of a compact schedule field
+  std::string compactFieldValue(const std::string& str)
+  {
+    std::string result = str.substr(str.find(':') + 1);
+    boost::trim(result);
+    return result;
+  }
+
+} // anonymous namespace
+
 namespace detail {
 
   ScheduleCompact_Impl::ScheduleCompact_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
@@ -173,6 +247,154 @@ namespace detail {
     LOG(Warn, "Ensure no leap days is not yet implemented for schedule compact");
   }
 
+  std::vector<double> ScheduleCompact_Impl::compileTimestepValues(int year,
+                                                                  unsigned timestepsPerHour,
+                                                                  std::vector<ModelObject>& /*dependencies*/) const
+  {
+    unsigned timestepsPerDay = 24 * timestepsPerHour;
+
+    // parse Through:, For:, Interpolate:, Until: and value fields once
+    std::vector<CompactPeriod> periods;
+    boost::optional<openstudio::Time> untilTime;
+    for (const IdfExtensibleGroup& eg : extensibleGroups()) {
+      std::string str = eg.getString(0,true).get();
+      boost::trim(str);
+      std::string lower = boost::to_lower_copy(str);
+
+      if (boost::starts_with(lower, "through:")) {
+        CompactPeriod period;
+        period.throughKey = 1231;
+        std::vector<std::string> monthDay;
+        std::string value = compactFieldValue(lower);
+        boost::split(monthDay, value, boost::is_any_of("/"));
+        try {
+          if (monthDay.size() == 2u) {
+            period.throughKey = 100 * boost::lexical_cast<unsigned>(boost::trim_copy(monthDay[0])) +
+                                boost::lexical_cast<unsigned>(boost::trim_copy(monthDay[1]));
+          }
+        }
+        catch (...) {
+          LOG(Warn, "Could not read '" << str << "' in " << briefDescription() << ", assuming 12/31.");
+        }
+        periods.push_back(period);
+      }
+      else if (boost::starts_with(lower, "for:")) {
+        if (periods.empty()) {
+          continue;
+        }
+        CompactDayProfile profile;
+        std::vector<std::string> dayTypes;
+        std::string value = compactFieldValue(lower);
+        boost::split(dayTypes, value, boost::is_any_of(" ,"), boost::token_compress_on);
+        for (const std::string& dayType : dayTypes) {
+          if (dayType == "alldays") {
+            for (int i = 0; i < 7; ++i) { profile.daysOfWeek.insert(i); }
+          }
+          else if (dayType == "weekdays") {
+            for (int i = 1; i < 6; ++i) { profile.daysOfWeek.insert(i); }
+          }
+          else if (dayType == "weekends") {
+            profile.daysOfWeek.insert(0);
+            profile.daysOfWeek.insert(6);
+          }
+          else if (dayType == "allotherdays") {
+            profile.allOtherDays = true;
+          }
+          else {
+            // holidays, design days and custom days are not part of the annual calendar
+            for (int i = 0; i < 7; ++i) {
+              if (dayType == boost::to_lower_copy(DayOfWeek(i).valueName())) {
+                profile.daysOfWeek.insert(i);
+              }
+            }
+          }
+        }
+        periods.back().profiles.push_back(profile);
+        untilTime.reset();
+      }
+      else if (boost::starts_with(lower, "interpolate:")) {
+        if (!periods.empty() && !periods.back().profiles.empty()) {
+          std::string value = compactFieldValue(lower);
+          if (value == "no") {
+            periods.back().profiles.back().interpolate = NoInterpolation;
+          }
+          else if (value == "linear") {
+            periods.back().profiles.back().interpolate = LinearInterpolation;
+          }
+          else {
+            periods.back().profiles.back().interpolate = AverageInterpolation;
+          }
+        }
+      }
+      else if (boost::starts_with(lower, "until:")) {
+        std::vector<std::string> hourMinute;
+        std::string value = compactFieldValue(lower);
+        boost::split(hourMinute, value, boost::is_any_of(":"));
+        try {
+          if (hourMinute.size() == 2u) {
+            untilTime = openstudio::Time(0, boost::lexical_cast<int>(boost::trim_copy(hourMinute[0])),
+                                            boost::lexical_cast<int>(boost::trim_copy(hourMinute[1])));
+          }
+        }
+        catch (...) {
+          LOG(Warn, "Could not read '" << str << "' in " << briefDescription() << ".");
+          untilTime.reset();
+        }
+      }
+      else if (!str.empty() && untilTime && !periods.empty() && !periods.back().profiles.empty()) {
+        try {
+          double value = boost::lexical_cast<double>(str);
+          periods.back().profiles.back().times.push_back(*untilTime);
+          periods.back().profiles.back().values.push_back(value);
+        }
+        catch (...) {}
+        untilTime.reset();
+      }
+    }
+
+    // evaluate each profile once and resolve the profile in effect on each day of the week
+    std::vector<double> zeros(timestepsPerDay, 0.0);
+    std::vector<std::vector<std::vector<double> > > periodDayValues;
+    for (const CompactPeriod& period : periods) {
+      std::vector<std::vector<double> > dayValues(7, zeros);
+      std::set<int> assigned;
+      for (const CompactDayProfile& profile : period.profiles) {
+        std::vector<double> profileValues;
+        if (profile.interpolate == AverageInterpolation) {
+          profileValues = averageTimestepValues(profile.times, profile.values, timestepsPerHour);
+        }
+        else {
+          profileValues = ScheduleDay_Impl::timestepValues(profile.times, profile.values,
+                                                           (profile.interpolate == LinearInterpolation), timestepsPerHour);
+        }
+        for (int i = 0; i < 7; ++i) {
+          bool applies = (profile.daysOfWeek.find(i) != profile.daysOfWeek.end()) || profile.allOtherDays;
+          if (applies && assigned.insert(i).second) {
+            dayValues[i] = profileValues;
+          }
+        }
+      }
+      periodDayValues.push_back(dayValues);
+    }
+
+    std::vector<openstudio::Date> dates = datesInYear(year);
+    std::vector<double> result;
+    result.reserve(dates.size() * timestepsPerDay);
+    for (const openstudio::Date& date : dates) {
+      unsigned key = 100 * date.monthOfYear().value() + date.dayOfMonth();
+      const std::vector<double>* dayValues = &zeros;
+      for (unsigned i = 0; i < periods.size(); ++i) {
+        if (periods[i].throughKey >= key) {
+          dayValues = &periodDayValues[i][date.dayOfWeek().value()];
+          break;
+        }
+      }
+      result.insert(result.end(), dayValues->begin(), dayValues->end());
+    }
+
+    return result;
+  }
+
   bool ScheduleCompact_Impl::isConstantValue() const {
     IdfExtensibleGroupVector scheduleData = extensibleGroups();
     if (scheduleData.size() == 4u) {
@@ -92,6 +92,11 @@ namespace detail {
     boost::optional<Quantity> getConstantValue(bool returnIP=false) const;
 
     //@}
+   protected:
+    virtual std::vector<double> compileTimestepValues(int year,
+                                                      unsigned timestepsPerHour,
+                                                      std::vector<ModelObject>& dependencies) const;
+
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleCompact");
   };
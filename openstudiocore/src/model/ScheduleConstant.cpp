@@ -30,6 +30,7 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/time/Date.hpp"
 
 using openstudio::Handle;
 using openstudio::OptionalHandle;
@@ -147,6 +148,14 @@ namespace detail {
     // nothing to do
   }
 
+  std::vector<double> ScheduleConstant_Impl::compileTimestepValues(int year,
+                                                                   unsigned timestepsPerHour,
+                                                                   std::vector<ModelObject>& /*dependencies*/) const
+  {
+    unsigned numDays = (Date::isLeapYear(year) ? 366 : 365);
+    return std::vector<double>(numDays * 24 * timestepsPerHour, this->value());
+  }
+
 } // detail
 
 // create a new ScheduleConstant object in the model's workspace
@@ -54,7 +54,7 @@ namespace detail {
     OS_ASSERT(idfObject.iddObject().type() == ScheduleDay::iddObjectType());
 
     // connect signals
-    connect(this, &ScheduleDay_Impl::onChange, this, &ScheduleDay_Impl::clearCachedVariables);
+    connect(this, &ScheduleDay_Impl::onInvalidateCaches, this, &ScheduleDay_Impl::clearCachedVariables);
   }
 
   ScheduleDay_Impl::ScheduleDay_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -65,7 +65,7 @@ namespace detail {
     OS_ASSERT(other.iddObject().type() == ScheduleDay::iddObjectType());
 
     // connect signals
-    connect(this, &ScheduleDay_Impl::onChange, this, &ScheduleDay_Impl::clearCachedVariables);
+    connect(this, &ScheduleDay_Impl::onInvalidateCaches, this, &ScheduleDay_Impl::clearCachedVariables);
   }
 
   ScheduleDay_Impl::ScheduleDay_Impl(const ScheduleDay_Impl& other,
@@ -74,7 +74,7 @@ namespace detail {
     : ScheduleBase_Impl(other,model,keepHandle)
   {
     // connect signals
-    connect(this, &ScheduleDay_Impl::onChange, this, &ScheduleDay_Impl::clearCachedVariables);
+    connect(this, &ScheduleDay_Impl::onInvalidateCaches, this, &ScheduleDay_Impl::clearCachedVariables);
   }
 
   std::vector<IdfObject> ScheduleDay_Impl::remove() {
@@ -242,6 +242,57 @@ namespace detail {
     return result;
   }
 
+  std::vector<double> ScheduleDay_Impl::timestepValues(unsigned timestepsPerHour) const
+  {
+    auto it = m_cachedTimestepValues.find(timestepsPerHour);
+    if (it != m_cachedTimestepValues.end()){
+      return it->second;
+    }
+
+    std::vector<double> result = timestepValues(this->times(), this->values(), this->interpolatetoTimestep(), timestepsPerHour);
+    m_cachedTimestepValues[timestepsPerHour] = result;
+
+    return result;
+  }
+
+  std::vector<double> ScheduleDay_Impl::timestepValues(const std::vector<openstudio::Time>& times,
+                                                       const std::vector<double>& values,
+                                                       bool interpolate,
+                                                       unsigned timestepsPerHour)
+  {
+    unsigned numTimesteps = 24 * timestepsPerHour;
+    unsigned N = times.size();
+    OS_ASSERT(values.size() == N);
+
+    if (N == 0){
+      return std::vector<double>(numTimesteps, 0.0);
+    }
+
+    // same interpolation grid as getValue, built once for the whole day
+    openstudio::Vector x(N + 2);
+    openstudio::Vector y(N + 2);
+
+    x[0] = -0.000001;
+    y[0] = 0.0;
+
+    for (unsigned i = 0; i < N; ++i){
+      x[i + 1] = times[i].totalDays();
+      y[i + 1] = values[i];
+    }
+
+    x[N + 1] = 1.000001;
+    y[N + 1] = 0.0;
+
+    openstudio::Vector xi(numTimesteps);
+    for (unsigned i = 0; i < numTimesteps; ++i){
+      xi[i] = (i + 1) / static_cast<double>(numTimesteps);
+    }
+
+    openstudio::Vector yi = interp(x, y, xi, interpolate ? LinearInterp : HoldNextInterp, NoneExtrap);
+
+    return std::vector<double>(yi.begin(), yi.end());
+  }
+
   boost::optional<Quantity> ScheduleDay_Impl::getValueAsQuantity(const openstudio::Time& time, bool returnIP) const {
     return toQuantity(getValue(time),returnIP);
   }
@@ -410,6 +461,7 @@ namespace detail {
   {
     m_cachedTimes.reset();
     m_cachedValues.reset();
+    m_cachedTimestepValues.clear();
   }
 
 } // detail
@@ -463,6 +515,10 @@ double ScheduleDay::getValue(const openstudio::Time& time) const {
   return getImpl<detail::ScheduleDay_Impl>()->getValue(time);
 }
 
+std::vector<double> ScheduleDay::timestepValues(unsigned timestepsPerHour) const {
+  return getImpl<detail::ScheduleDay_Impl>()->timestepValues(timestepsPerHour);
+}
+
 boost::optional<Quantity> ScheduleDay::getValueAsQuantity(const openstudio::Time& time,
                                                           bool returnIP) const
 {
@@ -86,6 +86,10 @@ class MODEL_API ScheduleDay : public ScheduleBase {
    *  false. */
   boost::optional<Quantity> getValueAsQuantity(const openstudio::Time& time, bool returnIP=false) const;
 
+  /** Returns the value at the end of each timestep of the day, 24*timestepsPerHour values in total.
+   *  The result is cached until this object changes. */
+  std::vector<double> timestepValues(unsigned timestepsPerHour) const;
+
   //@}
   /** @name Setters */
   //@{
@@ -93,6 +93,17 @@ namespace detail {
 
     boost::optional<Quantity> getValueAsQuantity(const openstudio::Time& time, bool returnIP=false) const;
 
+    /// Returns the value at the end of each timestep of the day, 24*timestepsPerHour values.
+    /// Values match getValue at each timestep end time and are cached until this object changes.
+    std::vector<double> timestepValues(unsigned timestepsPerHour) const;
+
+    /// Evaluates a day profile given as (until time, value) pairs at the end of each timestep, using
+    /// the same hold next or linear interpolation as getValue.
+    static std::vector<double> timestepValues(const std::vector<openstudio::Time>& times,
+                                              const std::vector<double>& values,
+                                              bool interpolate,
+                                              unsigned timestepsPerHour);
+
     //@}
     /** @name Setters */
     //@{
@@ -136,6 +147,7 @@ namespace detail {
 
     mutable boost::optional<std::vector<openstudio::Time> > m_cachedTimes;
     mutable boost::optional<std::vector<double> > m_cachedValues;
+    mutable std::map<unsigned, std::vector<double> > m_cachedTimestepValues;
   };
 
 } // detail
@@ -33,6 +33,8 @@
 #include <utilities/idd/OS_Schedule_Compact_FieldEnums.hxx>
 
 #include "../utilities/data/TimeSeries.hpp"
+#include "../utilities/time/Date.hpp"
+#include "../utilities/time/DateTime.hpp"
 #include "../utilities/core/Assert.hpp"
 
 using openstudio::Handle;
@@ -91,6 +93,39 @@ namespace detail {
     return toStandardVector(timeSeries().values());
   }
 
+  std::vector<double> ScheduleInterval_Impl::compileTimestepValues(int year,
+                                                                   unsigned timestepsPerHour,
+                                                                   std::vector<ModelObject>& /*dependencies*/) const
+  {
+    unsigned timestepsPerDay = 24 * timestepsPerHour;
+    int secondsPerTimestep = 3600 / timestepsPerHour;
+
+    // build the time series once, each timestep is then a single lookup
+    openstudio::TimeSeries timeSeries = this->timeSeries();
+    boost::optional<int> seriesYear = timeSeries.firstReportDateTime().date().baseYear();
+    bool seriesIsLeapYear = (seriesYear ? Date::isLeapYear(*seriesYear) : Date(MonthOfYear::Jan, 1).isLeapYear());
+
+    std::vector<openstudio::Date> dates = datesInYear(year);
+    std::vector<double> result;
+    result.reserve(dates.size() * timestepsPerDay);
+    for (const openstudio::Date& date : dates){
+
+      // map month and day onto the year of the time series, 2/29 falls back to 2/28 if needed
+      unsigned dayOfMonth = date.dayOfMonth();
+      if ((date.monthOfYear() == MonthOfYear::Feb) && (dayOfMonth == 29) && !seriesIsLeapYear){
+        dayOfMonth = 28;
+      }
+      openstudio::Date seriesDate = (seriesYear ? Date(date.monthOfYear(), dayOfMonth, *seriesYear) : Date(date.monthOfYear(), dayOfMonth));
+      openstudio::DateTime dayStart(seriesDate);
+
+      for (unsigned i = 0; i < timestepsPerDay; ++i){
+        result.push_back(timeSeries.value(dayStart + Time(0, 0, 0, (i + 1) * secondsPerTimestep)));
+      }
+    }
+
+    return result;
+  }
+
 } // detail
     
 boost::optional<ScheduleInterval> ScheduleInterval::fromTimeSeries(const openstudio::TimeSeries& timeSeries, Model& model)
@@ -77,6 +77,11 @@ namespace detail {
     virtual bool setTimeSeries(const openstudio::TimeSeries& timeSeries) = 0;
 
     //@}
+   protected:
+    virtual std::vector<double> compileTimestepValues(int year,
+                                                      unsigned timestepsPerHour,
+                                                      std::vector<ModelObject>& dependencies) const;
+
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleInterval");
 
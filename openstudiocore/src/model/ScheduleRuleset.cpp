@@ -36,11 +36,77 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
 #include "../utilities/time/Date.hpp"
 
+#include <algorithm>
+
 namespace openstudio {
 namespace model {
 
+namespace {
+
+  // month and day of a date, comparable across years
+  unsigned monthDayKey(const openstudio::Date& date)
+  {
+    return 100 * date.monthOfYear().value() + date.dayOfMonth();
+  }
+
+  // ScheduleRule fields read once so that a whole year can be tested without further field access
+  struct CompiledScheduleRule {
+    explicit CompiledScheduleRule(const ScheduleRule& scheduleRule)
+      : isDateRange(istringEqual("DateRange", scheduleRule.dateSpecificationType())),
+        startKey(0),
+        endKey(0)
+    {
+      if (isDateRange){
+        boost::optional<openstudio::Date> startDate = scheduleRule.startDate();
+        OS_ASSERT(startDate);
+        boost::optional<openstudio::Date> endDate = scheduleRule.endDate();
+        OS_ASSERT(endDate);
+        startKey = monthDayKey(*startDate);
+        endKey = monthDayKey(*endDate);
+      }else{
+        for (const openstudio::Date& specificDate : scheduleRule.specificDates()){
+          specificKeys.push_back(monthDayKey(specificDate));
+        }
+      }
+
+      applyDay[DayOfWeek::Sunday] = scheduleRule.applySunday();
+      applyDay[DayOfWeek::Monday] = scheduleRule.applyMonday();
+      applyDay[DayOfWeek::Tuesday] = scheduleRule.applyTuesday();
+      applyDay[DayOfWeek::Wednesday] = scheduleRule.applyWednesday();
+      applyDay[DayOfWeek::Thursday] = scheduleRule.applyThursday();
+      applyDay[DayOfWeek::Friday] = scheduleRule.applyFriday();
+      applyDay[DayOfWeek::Saturday] = scheduleRule.applySaturday();
+    }
+
+    bool containsDate(const openstudio::Date& date) const
+    {
+      std::map<int, bool>::const_iterator it = applyDay.find(date.dayOfWeek().value());
+      if ((it == applyDay.end()) || !it->second){
+        return false;
+      }
+
+      unsigned key = monthDayKey(date);
+      if (isDateRange){
+        if (startKey <= endKey){
+          return ((key >= startKey) && (key <= endKey));
+        }
+        return ((key >= startKey) || (key <= endKey));
+      }
+      return (std::find(specificKeys.begin(), specificKeys.end(), key) != specificKeys.end());
+    }
+
+    bool isDateRange;
+    unsigned startKey;
+    unsigned endKey;
+    std::vector<unsigned> specificKeys;
+    std::map<int, bool> applyDay;
+  };
+
+} // anonymous namespace
+
 namespace detail {
 
   ScheduleRuleset_Impl::ScheduleRuleset_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
@@ -394,6 +460,9 @@ namespace detail {
 
     }
 
+    // new and reordered rules do not change this object's fields
+    clearCompiledValues();
+
     return true;
   }
 
@@ -478,6 +547,44 @@ namespace detail {
     }
   }
 
+  std::vector<double> ScheduleRuleset_Impl::compileTimestepValues(int year,
+                                                                  unsigned timestepsPerHour,
+                                                                  std::vector<ModelObject>& dependencies) const
+  {
+    unsigned timestepsPerDay = 24 * timestepsPerHour;
+
+    // each day schedule is evaluated once, days are then copied from these profiles
+    ScheduleDay defaultDaySchedule = this->defaultDaySchedule();
+    dependencies.push_back(defaultDaySchedule);
+    std::vector<double> defaultDayValues = defaultDaySchedule.timestepValues(timestepsPerHour);
+
+    std::vector<CompiledScheduleRule> compiledRules;
+    std::vector<std::vector<double> > ruleDayValues;
+    for (const ScheduleRule& scheduleRule : this->scheduleRules()){
+      ScheduleDay daySchedule = scheduleRule.daySchedule();
+      dependencies.push_back(scheduleRule);
+      dependencies.push_back(daySchedule);
+      compiledRules.push_back(CompiledScheduleRule(scheduleRule));
+      ruleDayValues.push_back(daySchedule.timestepValues(timestepsPerHour));
+    }
+
+    std::vector<openstudio::Date> dates = datesInYear(year);
+    std::vector<double> result;
+    result.reserve(dates.size() * timestepsPerDay);
+    for (const openstudio::Date& date : dates){
+      const std::vector<double>* dayValues = &defaultDayValues;
+      for (unsigned i = 0; i < compiledRules.size(); ++i){
+        if (compiledRules[i].containsDate(date)){
+          dayValues = &ruleDayValues[i];
+          break;
+        }
+      }
+      result.insert(result.end(), dayValues->begin(), dayValues->end());
+    }
+
+    return result;
+  }
+
   boost::optional<ScheduleDay> ScheduleRuleset_Impl::optionalDefaultDaySchedule() const {
     return getObject<ScheduleRuleset>().getModelObjectTarget<ScheduleDay>(OS_Schedule_RulesetFields::DefaultDayScheduleName);
   }
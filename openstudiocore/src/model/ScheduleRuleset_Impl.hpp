@@ -138,6 +138,11 @@ namespace detail {
     virtual void ensureNoLeapDays();
 
     //@}
+   protected:
+    virtual std::vector<double> compileTimestepValues(int year,
+                                                      unsigned timestepsPerHour,
+                                                      std::vector<ModelObject>& dependencies) const;
+
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleRuleset");
 
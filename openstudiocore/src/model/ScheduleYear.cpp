@@ -21,6 +21,8 @@
 #include "ScheduleYear_Impl.hpp"
 #include "ScheduleWeek.hpp"
 #include "ScheduleWeek_Impl.hpp"
+#include "ScheduleDay.hpp"
+#include "ScheduleDay_Impl.hpp"
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
 #include "YearDescription.hpp"
@@ -172,6 +174,76 @@ namespace detail {
     return result;
   }
 
+  std::vector<double> ScheduleYear_Impl::compileTimestepValues(int year,
+                                                               unsigned timestepsPerHour,
+                                                               std::vector<ModelObject>& dependencies) const
+  {
+    unsigned timestepsPerDay = 24 * timestepsPerHour;
+
+    // until dates as month and day so that any calendar year can be compiled, these are already sorted
+    std::vector<unsigned> untilKeys;
+    std::vector<ScheduleWeek> scheduleWeeks;
+    for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(this->extensibleGroups()))
+    {
+      OptionalUnsigned month = group.getUnsigned(0, true);
+      OptionalUnsigned day = group.getUnsigned(1, true);
+      OptionalWorkspaceObject object = group.getTarget(2);
+      boost::optional<ScheduleWeek> scheduleWeek;
+      if (object){
+        scheduleWeek = object->optionalCast<ScheduleWeek>();
+      }
+      if (month && day && scheduleWeek){
+        untilKeys.push_back(100 * (*month) + (*day));
+        scheduleWeeks.push_back(*scheduleWeek);
+        dependencies.push_back(*scheduleWeek);
+      }
+    }
+
+    // day schedules in week order Sunday through Saturday, each evaluated once
+    std::vector<std::vector<std::vector<double> > > weekDayValues;
+    std::vector<double> zeros(timestepsPerDay, 0.0);
+    for (const ScheduleWeek& scheduleWeek : scheduleWeeks){
+      std::vector<boost::optional<ScheduleDay> > daySchedules;
+      daySchedules.push_back(scheduleWeek.sundaySchedule());
+      daySchedules.push_back(scheduleWeek.mondaySchedule());
+      daySchedules.push_back(scheduleWeek.tuesdaySchedule());
+      daySchedules.push_back(scheduleWeek.wednesdaySchedule());
+      daySchedules.push_back(scheduleWeek.thursdaySchedule());
+      daySchedules.push_back(scheduleWeek.fridaySchedule());
+      daySchedules.push_back(scheduleWeek.saturdaySchedule());
+
+      std::vector<std::vector<double> > dayValues;
+      for (const boost::optional<ScheduleDay>& daySchedule : daySchedules){
+        if (daySchedule){
+          dependencies.push_back(*daySchedule);
+          dayValues.push_back(daySchedule->timestepValues(timestepsPerHour));
+        }else{
+          dayValues.push_back(zeros);
+        }
+      }
+      weekDayValues.push_back(dayValues);
+    }
+
+    std::vector<openstudio::Date> dates = datesInYear(year);
+    std::vector<double> result;
+    result.reserve(dates.size() * timestepsPerDay);
+    for (const openstudio::Date& date : dates){
+      unsigned key = 100 * date.monthOfYear().value() + date.dayOfMonth();
+
+      // want first date which is greater than or equal to the target date
+      const std::vector<double>* dayValues = &zeros;
+      for (unsigned i = 0; i < untilKeys.size(); ++i){
+        if (untilKeys[i] >= key){
+          dayValues = &weekDayValues[i][date.dayOfWeek().value()];
+          break;
+        }
+      }
+      result.insert(result.end(), dayValues->begin(), dayValues->end());
+    }
+
+    return result;
+  }
+
   bool ScheduleYear_Impl::addScheduleWeek(const openstudio::Date& untilDate, const ScheduleWeek& scheduleWeek)
   {
     YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
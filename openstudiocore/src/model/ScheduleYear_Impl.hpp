@@ -107,6 +107,10 @@ namespace detail {
 
     //@}
    protected:
+    virtual std::vector<double> compileTimestepValues(int year,
+                                                      unsigned timestepsPerHour,
+                                                      std::vector<ModelObject>& dependencies) const;
+
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleYear");
   };
@@ -25,8 +25,12 @@
 #include <QObject>
 
 namespace openstudio {
+
+class Date;
+
 namespace model {
 
+class ModelObject;
 class ScheduleTypeLimits;
 
 namespace detail {
@@ -51,13 +55,36 @@ namespace detail {
     // virtual destructor
     virtual ~Schedule_Impl(){}
 
+    //@}
+    /** @name Other */
+    //@{
+
+    /** Returns the value at the end of each timestep of calendar year year. The result is
+     *  compiled once per (year, timestepsPerHour) and cached until this schedule or any object it
+     *  was compiled from changes. */
+    std::vector<double> timestepValues(int year, unsigned timestepsPerHour) const;
+
     //@}
    protected:
     virtual bool candidateIsCompatibleWithCurrentUse(const ScheduleTypeLimits& candidate) const;
 
     virtual bool okToResetScheduleTypeLimits() const;
+
+    /** Evaluates this schedule at the end of each timestep of every day of year. Implementations
+     *  append every object other than this one that the result was read from to dependencies. */
+    virtual std::vector<double> compileTimestepValues(int year,
+                                                      unsigned timestepsPerHour,
+                                                      std::vector<ModelObject>& dependencies) const = 0;
+
+    /// Returns every day of calendar year year, in order.
+    static std::vector<openstudio::Date> datesInYear(int year);
+
+    void clearCompiledValues();
+
    private:
     REGISTER_LOGGER("openstudio.model.Schedule");
+
+    mutable std::map<std::pair<int, unsigned>, std::vector<double> > m_compiledValues;
   };
 
 } // detail
@@ -109,8 +109,11 @@
 #include "../utilities/geometry/Vector3d.hpp"
 #include "../utilities/geometry/EulerAngles.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
+#include "../utilities/geometry/Plane.hpp"
+#include "../utilities/geometry/Intersection.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/System.hpp"
 
 #undef BOOST_UBLAS_TYPE_CHECK
 #include <boost/geometry/geometry.hpp>
@@ -121,6 +124,8 @@
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
 
 #include <cmath>
+#include <thread>
+#include <atomic>
 
 namespace openstudio {
 namespace model {
@@ -2268,12 +2273,32 @@ namespace detail {
       return;
     }
 
+    // same tolerance as Surface::computeIntersection
+    double tol = 0.01;
+
     std::vector<Surface> surfaces = this->surfaces();
     std::vector<Surface> otherSurfaces = other.surfaces();
+
+    // goes from local system to building coordinates
+    Transformation transformation = this->transformation();
+    Transformation otherTransformation = other.transformation();
     
-    std::map<std::string, bool> hasSubSurfaceMap;
-    std::map<std::string, bool> hasAdjacentSurfaceMap;
-    std::set<std::string> completedIntersections;
+    std::map<Handle, bool> hasSubSurfaceMap;
+    std::map<Handle, bool> hasAdjacentSurfaceMap;
+    std::set<std::pair<Handle, Handle> > completedIntersections;
+
+    // building coordinate plane and bounds of each surface, computeIntersection can only succeed for surfaces
+    // with reverse equal planes whose vertices are within tolerance of each other, so other pairs are skipped
+    std::map<Handle, std::pair<Plane, BoundingBox> > buildingGeometryMap;
+    auto buildingGeometry = [&buildingGeometryMap](const Surface& s, const Transformation& t) -> const std::pair<Plane, BoundingBox>& {
+      std::map<Handle, std::pair<Plane, BoundingBox> >::iterator it = buildingGeometryMap.find(s.handle());
+      if (it == buildingGeometryMap.end()){
+        BoundingBox bounds;
+        bounds.addPoints(t*s.vertices());
+        it = buildingGeometryMap.insert(std::make_pair(s.handle(), std::make_pair(t*s.plane(), bounds))).first;
+      }
+      return it->second;
+    };
 
     bool anyNewSurfaces = true;
     while(anyNewSurfaces){
@@ -2283,7 +2308,7 @@ namespace detail {
       std::vector<Surface> newOtherSurfaces;
 
       for (Surface surface : surfaces){
-        std::string surfaceHandle = toString(surface.handle());
+        Handle surfaceHandle = surface.handle();
         if (hasSubSurfaceMap.find(surfaceHandle) == hasSubSurfaceMap.end()){
           hasSubSurfaceMap[surfaceHandle] = !surface.subSurfaces().empty();
           hasAdjacentSurfaceMap[surfaceHandle] = surface.adjacentSurface();
@@ -2294,7 +2319,7 @@ namespace detail {
         }
 
         for (Surface otherSurface : otherSurfaces){
-          std::string otherSurfaceHandle = toString(otherSurface.handle());
+          Handle otherSurfaceHandle = otherSurface.handle();
           if (hasSubSurfaceMap.find(otherSurfaceHandle) == hasSubSurfaceMap.end()){
             hasSubSurfaceMap[otherSurfaceHandle] = !otherSurface.subSurfaces().empty();
             hasAdjacentSurfaceMap[otherSurfaceHandle] = otherSurface.adjacentSurface();
@@ -2307,15 +2332,26 @@ namespace detail {
           // see if we have already tested these for intersection, 
           // surfaces that previously did not intersect will not intersect if vertices change
           // surfaces that previously did intersect will intersect exactly
-          std::string intersectionKey = surfaceHandle + otherSurfaceHandle;
+          std::pair<Handle, Handle> intersectionKey(surfaceHandle, otherSurfaceHandle);
           if (completedIntersections.find(intersectionKey) != completedIntersections.end()){
             continue;
           }
           completedIntersections.insert(intersectionKey);
 
+          // vertices may be snapped by up to tol on each surface
+          const std::pair<Plane, BoundingBox>& geometry = buildingGeometry(surface, transformation);
+          const std::pair<Plane, BoundingBox>& otherGeometry = buildingGeometry(otherSurface, otherTransformation);
+          if (!geometry.second.intersects(otherGeometry.second, 2*tol) || !geometry.first.reverseEqual(otherGeometry.first)){
+            continue;
+          }
+
           // number of surfaces in each space will only increase in intersect
           boost::optional<SurfaceIntersection> intersection = surface.computeIntersection(otherSurface);
           if (intersection){
+            // vertices of both surfaces may have changed
+            buildingGeometryMap.erase(surfaceHandle);
+            buildingGeometryMap.erase(otherSurfaceHandle);
+
             std::vector<Surface> newSurfaces1 = intersection->newSurfaces1();
             newSurfaces.insert(newSurfaces.end(), newSurfaces1.begin(), newSurfaces1.end());
 
@@ -3401,12 +3437,161 @@ void intersectSurfaces(std::vector<Space>& spaces)
     bounds.push_back(space.transformation()*space.boundingBox());
   }
 
-  for (unsigned i = 0; i < spaces.size(); ++i){
-    for (unsigned j = i+1; j < spaces.size(); ++j){
-      if (!bounds[i].intersects(bounds[j])){
+  // pairs come back in the same order as a loop over i < j
+  for (const std::pair<unsigned, unsigned>& pair : intersectingPairs(bounds)){
+    spaces[pair.first].intersectSurfaces(spaces[pair.second]);
+  }
+}
+
+namespace {
+
+  // surface geometry in building coordinates, extracted on the calling thread
+  struct IntersectSurfaceGeometry {
+    Surface surface;
+    std::vector<Point3d> buildingVertices;
+    Plane plane;
+    BoundingBox bounds;
+  };
+
+  // pair of surfaces to intersect, only plain geometry is read by the worker threads
+  struct IntersectCandidate {
+    const IntersectSurfaceGeometry* geometry;
+    const IntersectSurfaceGeometry* otherGeometry;
+    Transformation faceTransformation;
+    boost::optional<IntersectionResult> result;
+  };
+
+  void computeIntersectCandidate(IntersectCandidate& candidate, double tol)
+  {
+    try {
+      candidate.faceTransformation = Transformation::alignFace(candidate.geometry->buildingVertices);
+      candidate.result = detail::Surface_Impl::intersectBuildingVertices(candidate.geometry->buildingVertices,
+                                                                         candidate.otherGeometry->buildingVertices,
+                                                                         candidate.faceTransformation, tol);
+    }catch(const std::exception&){
+      candidate.result.reset();
+    }
+  }
+
+}
+
+void intersectSurfacesParallel(std::vector<Space>& spaces, unsigned numThreads)
+{
+  // same tolerance as Surface::computeIntersection
+  double tol = 0.01;
+
+  if (numThreads == 0){
+    numThreads = std::max(System::numberOfProcessors(), 1u);
+  }
+
+  std::vector<BoundingBox> spaceBounds;
+  std::vector<Transformation> transformations;
+  for (const Space& space : spaces){
+    transformations.push_back(space.transformation());
+    spaceBounds.push_back(transformations.back()*space.boundingBox());
+  }
+
+  // intersection only shrinks existing surfaces and adds surfaces within them, space bounds do not grow
+  std::vector<std::pair<unsigned, unsigned> > spacePairs = intersectingPairs(spaceBounds);
+
+  // as in Space::intersectSurfaces, each pair of surfaces is intersected at most once
+  std::set<std::pair<Handle, Handle> > completedIntersections;
+
+  bool repeat = true;
+  while (repeat){
+    repeat = false;
+
+    // extract geometry of surfaces that may be intersected
+    std::vector<std::vector<IntersectSurfaceGeometry> > geometries(spaces.size());
+    for (unsigned i = 0; i < spaces.size(); ++i){
+      if (spaces[i].handle().isNull()){
         continue;
       }
-      spaces[i].intersectSurfaces(spaces[j]);
+      for (const Surface& surface : spaces[i].surfaces()){
+        if (!surface.subSurfaces().empty() || surface.adjacentSurface()){
+          continue;
+        }
+        IntersectSurfaceGeometry geometry{surface, transformations[i]*surface.vertices(), transformations[i]*surface.plane(), BoundingBox()};
+        if (geometry.buildingVertices.size() < 3){
+          continue;
+        }
+        geometry.bounds.addPoints(geometry.buildingVertices);
+        geometries[i].push_back(geometry);
+      }
+    }
+
+    // candidates are ordered by space pair then by surface order within each space
+    std::vector<IntersectCandidate> candidates;
+    for (const std::pair<unsigned, unsigned>& spacePair : spacePairs){
+      if (spaces[spacePair.first].handle() == spaces[spacePair.second].handle()){
+        continue;
+      }
+      for (const IntersectSurfaceGeometry& geometry : geometries[spacePair.first]){
+        for (const IntersectSurfaceGeometry& otherGeometry : geometries[spacePair.second]){
+          std::pair<Handle, Handle> intersectionKey(geometry.surface.handle(), otherGeometry.surface.handle());
+          if (completedIntersections.find(intersectionKey) != completedIntersections.end()){
+            continue;
+          }
+          // vertices may be snapped by up to tol on each surface
+          if (!geometry.bounds.intersects(otherGeometry.bounds, 2*tol) || !geometry.plane.reverseEqual(otherGeometry.plane)){
+            completedIntersections.insert(intersectionKey);
+            continue;
+          }
+          candidates.push_back(IntersectCandidate{&geometry, &otherGeometry, Transformation(), boost::none});
+        }
+      }
+    }
+
+    if (candidates.empty()){
+      break;
+    }
+
+    // compute intersections, workers only touch their own candidates
+    unsigned nThreads = std::min<unsigned>(numThreads, candidates.size());
+    if (nThreads <= 1){
+      for (IntersectCandidate& candidate : candidates){
+        computeIntersectCandidate(candidate, tol);
+      }
+    }else{
+      std::atomic<size_t> next(0);
+      auto worker = [&candidates, &next, tol](){
+        for (size_t i = next++; i < candidates.size(); i = next++){
+          computeIntersectCandidate(candidates[i], tol);
+        }
+      };
+      std::vector<std::thread> threads;
+      for (unsigned i = 0; i < nThreads; ++i){
+        threads.push_back(std::thread(worker));
+      }
+      for (std::thread& thread : threads){
+        thread.join();
+      }
+    }
+
+    // apply results in candidate order, a result computed from vertices that have since changed
+    // is discarded and the pair is retried in the next round
+    std::set<Handle> modifiedSurfaces;
+    for (IntersectCandidate& candidate : candidates){
+      Surface surface = candidate.geometry->surface;
+      Surface otherSurface = candidate.otherGeometry->surface;
+      if ((modifiedSurfaces.find(surface.handle()) != modifiedSurfaces.end()) ||
+          (modifiedSurfaces.find(otherSurface.handle()) != modifiedSurfaces.end())){
+        repeat = true;
+        continue;
+      }
+
+      completedIntersections.insert(std::make_pair(surface.handle(), otherSurface.handle()));
+
+      if (!candidate.result){
+        continue;
+      }
+
+      SurfaceIntersection intersection = surface.getImpl<detail::Surface_Impl>()->applyIntersection(otherSurface, candidate.faceTransformation, *candidate.result);
+      if (!intersection.newSurfaces1().empty() || !intersection.newSurfaces2().empty()){
+        modifiedSurfaces.insert(surface.handle());
+        modifiedSurfaces.insert(otherSurface.handle());
+        repeat = true;
+      }
     }
   }
 }
@@ -3418,13 +3603,9 @@ void matchSurfaces(std::vector<Space>& spaces)
     bounds.push_back(space.transformation()*space.boundingBox());
   }
 
-  for (unsigned i = 0; i < spaces.size(); ++i){
-    for (unsigned j = i+1; j < spaces.size(); ++j){
-      if (!bounds[i].intersects(bounds[j])){
-        continue;
-      }
-      spaces[i].matchSurfaces(spaces[j]);
-    }
+  // pairs come back in the same order as a loop over i < j
+  for (const std::pair<unsigned, unsigned>& pair : intersectingPairs(bounds)){
+    spaces[pair.first].matchSurfaces(spaces[pair.second]);
   }
 }
 
@@ -575,6 +575,11 @@ class MODEL_API Space : public PlanarSurfaceGroup {
 /** Intersect surfaces within spaces. */
 MODEL_API void intersectSurfaces(std::vector<Space>& spaces);
 
+/** Intersect surfaces within spaces, candidate surface pairs are intersected on numThreads worker threads
+ *  (0 uses all processors) and the results are applied to the model in a deterministic order on the calling thread.
+ *  Results do not depend on the number of threads but may differ in surface order and naming from intersectSurfaces. */
+MODEL_API void intersectSurfacesParallel(std::vector<Space>& spaces, unsigned numThreads = 0);
+
 /** Match surfaces and sub surfaces within spaces. */
 MODEL_API void matchSurfaces(std::vector<Space>& spaces);
 
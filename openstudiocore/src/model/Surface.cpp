@@ -860,6 +860,24 @@ namespace detail {
       return boost::none;
     }
 
+    //LOG(Info, "Trying intersection of '" << this->name().get() << "' with '" << otherSurface.name().get());
+
+    boost::optional<IntersectionResult> intersection = intersectBuildingVertices(buildingVertices, otherBuildingVertices, faceTransformation, tol);
+    if (!intersection){
+      //LOG(Info, "No intersection");
+      return boost::none;
+    }
+
+    return applyIntersection(otherSurface, faceTransformation, *intersection);
+  }
+
+  boost::optional<IntersectionResult> Surface_Impl::intersectBuildingVertices(const std::vector<Point3d>& buildingVertices,
+                                                                              const std::vector<Point3d>& otherBuildingVertices,
+                                                                              const Transformation& faceTransformation,
+                                                                              double tol)
+  {
+    Transformation faceTransformationInverse = faceTransformation.inverse();
+
     // put building vertices into face coordinates
     std::vector<Point3d> faceVertices = faceTransformationInverse * buildingVertices;
     std::vector<Point3d> otherFaceVertices = faceTransformationInverse * otherBuildingVertices;
@@ -868,13 +886,19 @@ namespace detail {
     std::reverse(faceVertices.begin(), faceVertices.end());
     //std::reverse(otherFaceVertices.begin(), otherFaceVertices.end());
 
-    //LOG(Info, "Trying intersection of '" << this->name().get() << "' with '" << otherSurface.name().get());
+    return openstudio::intersect(faceVertices, otherFaceVertices, tol);
+  }
 
-    boost::optional<IntersectionResult> intersection = openstudio::intersect(faceVertices, otherFaceVertices, tol);
-    if (!intersection){
-      //LOG(Info, "No intersection");
-      return boost::none;
-    }
+  SurfaceIntersection Surface_Impl::applyIntersection(Surface& otherSurface, const Transformation& faceTransformation, const IntersectionResult& intersection)
+  {
+    boost::optional<Space> space = this->space();
+    boost::optional<Space> otherSpace = otherSurface.space();
+    OS_ASSERT(space);
+    OS_ASSERT(otherSpace);
+
+    // goes from local system to building coordinates
+    Transformation spaceTransformation = space->transformation();
+    Transformation otherSpaceTransformation = otherSpace->transformation();
 
     // non-zero intersection
     // could match here but will save that for other discrete operation
@@ -890,8 +914,8 @@ namespace detail {
     Transformation spaceTransformationInverse = spaceTransformation.inverse();
     Transformation otherSpaceTransformationInverse = otherSpaceTransformation.inverse();
 
-    std::vector< std::vector<Point3d> > newPolygons1 = intersection->newPolygons1();
-    std::vector< std::vector<Point3d> > newPolygons2 = intersection->newPolygons2();
+    std::vector< std::vector<Point3d> > newPolygons1 = intersection.newPolygons1();
+    std::vector< std::vector<Point3d> > newPolygons2 = intersection.newPolygons2();
     if (newPolygons1.empty() && newPolygons2.empty()){
       // both surfaces intersect perfectly, no-op
 
@@ -899,14 +923,14 @@ namespace detail {
       // new surfaces are created
 
       // modify vertices for surface in this space
-      std::vector<Point3d> newBuildingVertices = faceTransformation * intersection->polygon1();
+      std::vector<Point3d> newBuildingVertices = faceTransformation * intersection.polygon1();
       std::vector<Point3d> newVertices = spaceTransformationInverse * newBuildingVertices;
       std::reverse(newVertices.begin(), newVertices.end());
       newVertices = reorderULC(newVertices);
       this->setVertices(newVertices);
 
       // modify vertices for surface in other space
-      std::vector<Point3d> newOtherBuildingVertices = faceTransformation * intersection->polygon2();
+      std::vector<Point3d> newOtherBuildingVertices = faceTransformation * intersection.polygon2();
       std::vector<Point3d> newOtherVertices = otherSpaceTransformationInverse * newOtherBuildingVertices;
       newOtherVertices = reorderULC(newOtherVertices);
       otherSurface.setVertices(newOtherVertices);
@@ -24,6 +24,10 @@
 #include "PlanarSurface_Impl.hpp"
 
 namespace openstudio {
+
+class Transformation;
+class IntersectionResult;
+
 namespace model {
 
 class Space;
@@ -207,6 +211,16 @@ namespace detail {
     bool intersect(Surface& otherSurface);
     boost::optional<SurfaceIntersection> computeIntersection(Surface& otherSurface);
 
+    /// Intersects two polygons given in building coordinates, faceTransformation is the alignFace transformation of
+    /// buildingVertices.  Does not access the model so it may be called from worker threads.
+    static boost::optional<IntersectionResult> intersectBuildingVertices(const std::vector<Point3d>& buildingVertices,
+                                                                         const std::vector<Point3d>& otherBuildingVertices,
+                                                                         const Transformation& faceTransformation,
+                                                                         double tol);
+
+    /// Applies the result of intersectBuildingVertices to this surface and otherSurface, creating new surfaces as needed.
+    SurfaceIntersection applyIntersection(Surface& otherSurface, const Transformation& faceTransformation, const IntersectionResult& intersection);
+
     boost::optional<Surface> createAdjacentSurface(const Space& otherSpace);
 
     bool isPartOfEnvelope() const;
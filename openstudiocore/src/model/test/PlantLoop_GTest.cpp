@@ -143,6 +143,45 @@ TEST_F(ModelFixture,PlantLoop_demandComponents)
   ASSERT_EQ( 3u,plantLoop.demandComponents(coil2,mixer).size() );
 }
 
+TEST_F(ModelFixture,PlantLoop_demandBranches)
+{
+  Model m;
+  PlantLoop plantLoop(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+
+  std::vector<CoilHeatingWater> coils;
+  for( unsigned i = 0; i < 20; ++i ) {
+    CoilHeatingWater coil(m,s);
+    EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+    coils.push_back(coil);
+  }
+
+  // inlet node, splitter, mixer, outlet node, and three components per branch
+  ASSERT_EQ( 4u + 3u * 20u,plantLoop.demandComponents().size() );
+  ASSERT_EQ( 20u,plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size() );
+
+  std::vector<std::vector<ModelObject> > branches = plantLoop.demandBranches();
+  ASSERT_EQ( 20u,branches.size() );
+  for( unsigned i = 0; i < branches.size(); ++i ) {
+    ASSERT_EQ( 3u,branches[i].size() );
+    EXPECT_TRUE( branches[i][1].optionalCast<CoilHeatingWater>() );
+  }
+
+  ASSERT_TRUE( plantLoop.demandComponent(coils[10].handle()) );
+  EXPECT_FALSE( plantLoop.supplyComponent(coils[10].handle()) );
+
+  // repeated queries come from the cached topology and edits are picked up
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(coils[10]));
+  EXPECT_EQ( 4u + 3u * 19u,plantLoop.demandComponents().size() );
+  EXPECT_EQ( 19u,plantLoop.demandBranches().size() );
+  EXPECT_FALSE( plantLoop.demandComponent(coils[10].handle()) );
+
+  // the supply side has a splitter with a single bypass branch by default
+  std::vector<std::vector<ModelObject> > supplyBranches = plantLoop.supplyBranches();
+  ASSERT_EQ( 1u,supplyBranches.size() );
+  EXPECT_EQ( 1u,supplyBranches[0].size() );
+}
+
 TEST_F(ModelFixture,PlantLoop_addDemandBranchForComponent)
 {
   Model m; 
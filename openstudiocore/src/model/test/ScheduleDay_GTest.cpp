@@ -27,6 +27,7 @@
 
 #include "../../utilities/time/Date.hpp"
 #include "../../utilities/time/Time.hpp"
+#include "../../utilities/idf/WorkspaceEditSession.hpp"
 
 using namespace openstudio::model;
 using namespace openstudio;
@@ -325,3 +326,25 @@ TEST_F(ModelFixture, Schedule_Day_Clone)
   EXPECT_EQ(limits.handle(), daySchedule.scheduleTypeLimits()->handle());
   EXPECT_EQ(daySchedule.scheduleTypeLimits()->handle(), daySchedule2.scheduleTypeLimits()->handle());
 }
+
+TEST_F(ModelFixture, Schedule_Day_EditSession)
+{
+  Model model;
+
+  ScheduleDay daySchedule(model);
+  EXPECT_EQ(1u, daySchedule.values().size());
+  EXPECT_EQ(0.0, daySchedule.getValue(Time(0, 6, 0)));
+
+  {
+    WorkspaceEditSession session(model);
+
+    // cached values are cleared at once, only the change signals wait for the session to end
+    EXPECT_TRUE(daySchedule.addValue(Time(0, 12, 0), 1.0));
+    ASSERT_EQ(2u, daySchedule.values().size());
+    EXPECT_EQ(1.0, daySchedule.values()[0]);
+    EXPECT_EQ(1.0, daySchedule.getValue(Time(0, 6, 0)));
+  }
+
+  ASSERT_EQ(2u, daySchedule.values().size());
+  EXPECT_EQ(1.0, daySchedule.getValue(Time(0, 6, 0)));
+}
@@ -94,3 +94,36 @@ TEST_F(ModelFixture, Schedule_VariableInterval)
   EXPECT_FALSE(timeSeries3.intervalLength());
   EXPECT_EQ(timeSeries2.values().size(), timeSeries3.values().size());
 }
+
+TEST_F(ModelFixture, Schedule_IntervalTimestepValues)
+{
+  Model model;
+  ScheduleFixedInterval schedule(model);
+
+  Date startDate(MonthOfYear::Jan, 1);
+  Time intervalLength(0, 0, 60);
+  Vector values(8760);
+  for (unsigned i = 0; i < values.size(); ++i){
+    values[i] = i % 24;
+  }
+  EXPECT_TRUE(schedule.setTimeSeries(TimeSeries(startDate, intervalLength, values, "")));
+
+  // each timestep takes the value of the interval it ends in
+  std::vector<double> timestepValues = schedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, timestepValues.size());
+  EXPECT_DOUBLE_EQ(0.0, timestepValues[0]);
+  EXPECT_DOUBLE_EQ(5.0, timestepValues[5]);
+  EXPECT_DOUBLE_EQ(23.0, timestepValues[24 + 23]);
+
+  timestepValues = schedule.timestepValues(2013, 4);
+  ASSERT_EQ(4u*8760u, timestepValues.size());
+  EXPECT_DOUBLE_EQ(0.0, timestepValues[3]);
+  EXPECT_DOUBLE_EQ(1.0, timestepValues[4]);
+
+  // a new time series invalidates the compiled values
+  Vector constantValues(8760, 7.0);
+  EXPECT_TRUE(schedule.setTimeSeries(TimeSeries(startDate, intervalLength, constantValues, "")));
+  timestepValues = schedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, timestepValues.size());
+  EXPECT_DOUBLE_EQ(7.0, timestepValues[5]);
+}
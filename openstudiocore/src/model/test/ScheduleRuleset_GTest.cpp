@@ -745,6 +745,68 @@ TEST_F(ModelFixture, ScheduleRuleset_DaySchedule2)
   EXPECT_EQ("My Day Schedule", daySchedule.name().get());
 }
 
+TEST_F(ModelFixture, ScheduleRuleset_TimestepValues)
+{
+  Model model;
+  ScheduleRuleset schedule(model);
+  schedule.defaultDaySchedule().addValue(Time(0,24,0), 0.0);
+
+  // 2013 starts on a Tuesday
+  std::vector<double> values = schedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[8]);
+
+  ScheduleRule weekdayRule(schedule);
+  weekdayRule.setApplyMonday(true);
+  weekdayRule.setApplyTuesday(true);
+  weekdayRule.setApplyWednesday(true);
+  weekdayRule.setApplyThursday(true);
+  weekdayRule.setApplyFriday(true);
+  ScheduleDay weekday = weekdayRule.daySchedule();
+  weekday.clearValues();
+  weekday.addValue(Time(0,8,0), 0.0);
+  weekday.addValue(Time(0,18,0), 1.0);
+  weekday.addValue(Time(0,24,0), 0.0);
+
+  // the new rule invalidates the compiled values
+  values = schedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[7]);
+  EXPECT_DOUBLE_EQ(1.0, values[8]);
+  EXPECT_DOUBLE_EQ(1.0, values[17]);
+  EXPECT_DOUBLE_EQ(0.0, values[18]);
+  EXPECT_DOUBLE_EQ(0.0, values[4*24 + 12]); // Saturday
+
+  // compiled values agree with the day schedules in effect on each day
+  std::vector<ScheduleDay> daySchedules = schedule.getDaySchedules(Date(MonthOfYear::Jan, 1), Date(MonthOfYear::Dec, 31));
+  ASSERT_EQ(365u, daySchedules.size());
+  values = schedule.timestepValues(2009, 1);
+  ASSERT_EQ(8760u, values.size());
+  for (unsigned d = 0; d < 365; ++d){
+    for (unsigned h = 0; h < 24; ++h){
+      EXPECT_DOUBLE_EQ(daySchedules[d].getValue(Time(0, h + 1, 0)), values[24*d + h]);
+    }
+  }
+
+  // edits to a referenced day schedule invalidate the compiled values
+  weekday.addValue(Time(0,18,0), 0.5);
+  values = schedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[7]);
+  EXPECT_DOUBLE_EQ(0.5, values[8]);
+  EXPECT_DOUBLE_EQ(0.5, values[17]);
+
+  values = schedule.timestepValues(2013, 4);
+  ASSERT_EQ(4u*8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.5, values[4*8 + 3]);
+
+  EXPECT_EQ(96u, weekday.timestepValues(4).size());
+
+  // leap years have 8784 hours
+  EXPECT_EQ(8784u, schedule.timestepValues(2012, 1).size());
+  EXPECT_TRUE(schedule.timestepValues(2013, 7).empty());
+}
+
 
 TEST_F(ModelFixture, ScheduleRuleset_InsertObjects)
 {
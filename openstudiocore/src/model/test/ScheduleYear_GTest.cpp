@@ -24,6 +24,8 @@
 #include "../ScheduleYear_Impl.hpp"
 #include "../ScheduleWeek.hpp"
 #include "../ScheduleWeek_Impl.hpp"
+#include "../ScheduleDay.hpp"
+#include "../ScheduleDay_Impl.hpp"
 #include "../YearDescription.hpp"
 #include "../YearDescription_Impl.hpp"
 #include "../ScheduleTypeLimits.hpp"
@@ -161,3 +163,45 @@ TEST_F(ModelFixture, Schedule_Year)
   ASSERT_TRUE(yearSchedule.getScheduleWeek(yd.makeDate(12,31)));
   EXPECT_EQ(weekSchedule3.handle(), yearSchedule.getScheduleWeek(yd.makeDate(12,31))->handle());
 }
+
+TEST_F(ModelFixture, Schedule_YearTimestepValues)
+{
+  Model model;
+
+  openstudio::model::YearDescription yd = model.getUniqueModelObject<openstudio::model::YearDescription>();
+
+  ScheduleDay daySchedule1(model, 1.0);
+  ScheduleDay daySchedule2(model, 2.0);
+  ScheduleWeek weekSchedule1(model);
+  EXPECT_TRUE(weekSchedule1.setAllSchedules(daySchedule1));
+  ScheduleWeek weekSchedule2(model);
+  EXPECT_TRUE(weekSchedule2.setAllSchedules(daySchedule2));
+
+  ScheduleYear yearSchedule(model);
+  EXPECT_TRUE(yearSchedule.addScheduleWeek(yd.makeDate(6,30), weekSchedule1));
+  EXPECT_TRUE(yearSchedule.addScheduleWeek(yd.makeDate(12,31), weekSchedule2));
+
+  std::vector<double> values = yearSchedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(1.0, values[0]);
+  EXPECT_DOUBLE_EQ(1.0, values[180*24 + 23]); // June 30
+  EXPECT_DOUBLE_EQ(2.0, values[181*24]); // July 1
+  EXPECT_DOUBLE_EQ(2.0, values[8759]);
+  EXPECT_EQ(8784u, yearSchedule.timestepValues(2012, 1).size());
+
+  // edits to a referenced day schedule invalidate the compiled values
+  daySchedule1.clearValues();
+  EXPECT_TRUE(daySchedule1.addValue(openstudio::Time(0,12,0), 0.0));
+  EXPECT_TRUE(daySchedule1.addValue(openstudio::Time(0,24,0), 3.0));
+  values = yearSchedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[11]);
+  EXPECT_DOUBLE_EQ(3.0, values[12]);
+  EXPECT_DOUBLE_EQ(2.0, values[181*24 + 12]);
+
+  // as do edits to the year schedule itself
+  yearSchedule.clearScheduleWeeks();
+  values = yearSchedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[12]);
+}
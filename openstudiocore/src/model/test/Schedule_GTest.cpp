@@ -22,6 +22,8 @@
 #include "ModelFixture.hpp"
 #include "../ScheduleConstant.hpp"
 #include "../ScheduleConstant_Impl.hpp"
+#include "../ScheduleCompact.hpp"
+#include "../ScheduleCompact_Impl.hpp"
 #include "../ScheduleTypeRegistry.hpp"
 
 #include "../../utilities/idf/ValidityReport.hpp"
@@ -43,3 +45,62 @@ TEST_F(ModelFixture, Schedule_FinalStrictness) {
   EXPECT_EQ(0u,report.numErrors());
 }
 
+TEST_F(ModelFixture, Schedule_CompactTimestepValues)
+{
+  Model model;
+  ScheduleCompact schedule(model);
+  schedule.clearExtensibleGroups();
+  std::vector<std::string> fields = {"Through: 6/30",
+                                     "For: Weekdays", "Until: 08:00", "0", "Until: 18:00", "1", "Until: 24:00", "0",
+                                     "For: AllOtherDays", "Until: 24:00", "0.25",
+                                     "Through: 12/31",
+                                     "For: AllDays", "Until: 24:00", "0.5"};
+  for (const std::string& field : fields){
+    EXPECT_FALSE(schedule.pushExtensibleGroup(std::vector<std::string>(1u, field)).empty());
+  }
+
+  // 2013 starts on a Tuesday
+  std::vector<double> values = schedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[7]);
+  EXPECT_DOUBLE_EQ(1.0, values[8]);
+  EXPECT_DOUBLE_EQ(1.0, values[17]);
+  EXPECT_DOUBLE_EQ(0.0, values[18]);
+  EXPECT_DOUBLE_EQ(0.25, values[4*24 + 12]); // Saturday
+  EXPECT_DOUBLE_EQ(0.5, values[181*24 + 12]); // July 1
+
+  values = schedule.timestepValues(2013, 4);
+  ASSERT_EQ(4u*8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[4*8 - 1]);
+  EXPECT_DOUBLE_EQ(1.0, values[4*8]);
+
+  // edits to the schedule invalidate the compiled values
+  schedule.setToConstantValue(2.0);
+  values = schedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(2.0, values[8]);
+  EXPECT_DOUBLE_EQ(2.0, values[181*24 + 12]);
+
+  // Interpolate:Average averages over the timestep, Interpolate:Linear interpolates between Until: times
+  schedule.clearExtensibleGroups();
+  fields = {"Through: 12/31", "For: AllDays", "Interpolate: Average", "Until: 08:30", "0", "Until: 24:00", "1"};
+  for (const std::string& field : fields){
+    EXPECT_FALSE(schedule.pushExtensibleGroup(std::vector<std::string>(1u, field)).empty());
+  }
+  values = schedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[7]);
+  EXPECT_DOUBLE_EQ(0.5, values[8]);
+  EXPECT_DOUBLE_EQ(1.0, values[9]);
+  EXPECT_DOUBLE_EQ(1.0, values[23]);
+
+  schedule.clearExtensibleGroups();
+  fields = {"Through: 12/31", "For: AllDays", "Interpolate: Linear", "Until: 12:00", "0", "Until: 24:00", "1"};
+  for (const std::string& field : fields){
+    EXPECT_FALSE(schedule.pushExtensibleGroup(std::vector<std::string>(1u, field)).empty());
+  }
+  values = schedule.timestepValues(2013, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[11]);
+  EXPECT_NEAR(0.5, values[17], 1.0e-9);
+}
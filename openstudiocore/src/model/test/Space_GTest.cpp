@@ -1464,3 +1464,59 @@ TEST_F(ModelFixture, Space_Intersect_FourToOne){
     }
   }
 }
+
+TEST_F(ModelFixture, Space_IntersectParallel_OneToFour){
+
+  double areaTol = 0.000001;
+  double xOrigin = 20.0;
+
+  // same geometry as Space_Intersect_OneToFour, result must not depend on the number of threads
+  for (double rotation = 0; rotation < 360.0; rotation += 30.0){
+    for (unsigned numThreads = 1; numThreads <= 4; numThreads += 3){
+
+      Transformation t = Transformation::rotation(Vector3d(0,0,1), degToRad(rotation));
+
+      Model model;
+      Space space1(model);
+      Space space2(model);
+
+      Point3dVector points;
+      points.push_back(Point3d(xOrigin,  0, 20));
+      points.push_back(Point3d(xOrigin,  0,  0));
+      points.push_back(Point3d(xOrigin, 10,  0));
+      points.push_back(Point3d(xOrigin, 10, 20));
+      Surface surface(t*points, model);
+      surface.setSpace(space1);
+
+      for (unsigned i = 0; i < 4; ++i){
+        points.clear();
+        points.push_back(Point3d(xOrigin, 10, (i+1)*5));
+        points.push_back(Point3d(xOrigin, 10,  i*5));
+        points.push_back(Point3d(xOrigin,  0,  i*5));
+        points.push_back(Point3d(xOrigin,  0, (i+1)*5));
+        Surface tempSurface(t*points, model);
+        tempSurface.setSpace(space2);
+      }
+
+      std::vector<Space> spaces;
+      spaces.push_back(space1);
+      spaces.push_back(space2);
+      intersectSurfacesParallel(spaces, numThreads);
+      matchSurfaces(spaces);
+
+      EXPECT_EQ(4u, space1.surfaces().size());
+      for (const Surface& s : space1.surfaces()){
+        EXPECT_EQ(4u, s.vertices().size());
+        EXPECT_NEAR(50.0, s.grossArea(), areaTol);
+        EXPECT_TRUE(s.adjacentSurface());
+      }
+
+      EXPECT_EQ(4u, space2.surfaces().size());
+      for (const Surface& s : space2.surfaces()){
+        EXPECT_EQ(4u, s.vertices().size());
+        EXPECT_NEAR(50.0, s.grossArea(), areaTol);
+        EXPECT_TRUE(s.adjacentSurface());
+      }
+    }
+  }
+}
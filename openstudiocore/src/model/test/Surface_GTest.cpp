@@ -67,6 +67,7 @@
 #include "../../utilities/data/Attribute.hpp"
 #include "../../utilities/idf/IdfObject.hpp"
 #include "../../utilities/idf/WorkspaceWatcher.hpp"
+#include "../../utilities/idf/WorkspaceEditSession.hpp"
 #include "../../utilities/idf/WorkspaceExtensibleGroup.hpp"
 
 #include "../../utilities/idd/IddEnums.hpp"
@@ -295,6 +296,38 @@ TEST_F(ModelFixture, Surface_Area)
 }
 
 /* HAS TO WAIT UNTIL WE GET A GOOD OSM EXAMPLE
+TEST_F(ModelFixture, Surface_EditSession)
+{
+  Model model;
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 1, 0));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(1, 0, 0));
+  points.push_back(Point3d(1, 1, 0));
+
+  Surface surface(points, model);
+  EXPECT_DOUBLE_EQ(1.0, surface.outwardNormal().z());
+  EXPECT_DOUBLE_EQ(1.0, surface.grossArea());
+
+  {
+    WorkspaceEditSession session(model);
+
+    // cached geometry is cleared at once, only the change signals wait for the session to end
+    points.clear();
+    points.push_back(Point3d(1, 2, 0));
+    points.push_back(Point3d(1, 0, 0));
+    points.push_back(Point3d(0, 0, 0));
+    points.push_back(Point3d(0, 2, 0));
+    EXPECT_TRUE(surface.setVertices(points));
+    EXPECT_DOUBLE_EQ(-1.0, surface.outwardNormal().z());
+    EXPECT_DOUBLE_EQ(2.0, surface.grossArea());
+  }
+
+  EXPECT_DOUBLE_EQ(-1.0, surface.outwardNormal().z());
+  EXPECT_DOUBLE_EQ(2.0, surface.grossArea());
+}
+
 TEST_F(ModelFixture, Surface_Area_In_File)
 {
   openstudio::path modelDir = resourcesPath() / toPath("model/Daylighting_Office/");
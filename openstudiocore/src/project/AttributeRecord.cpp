@@ -1025,16 +1025,7 @@ boost::optional<AttributeRecord> AttributeRecord::factoryFromQuery(
 }
 
 std::vector<AttributeRecord> AttributeRecord::getAttributeRecords(ProjectDatabase& database) {
-  AttributeRecordVector result;
-
-  QSqlQuery query(*(database.qSqlDatabase()));
-  query.prepare(toQString("SELECT * FROM " + AttributeRecord::databaseTableName() + " WHERE parentAttributeRecordId IS NULL"));
-  assertExec(query);
-  while (query.next()) {
-    result.push_back(AttributeRecord(query,database));
-  }
-
-  return result;
+  return database.getRecordsFromTable<AttributeRecord>("parentAttributeRecordId IS NULL");
 }
 
 boost::optional<AttributeRecord> AttributeRecord::getAttributeRecord(int id, ProjectDatabase& database)
@@ -1035,19 +1035,7 @@ DataPointRecord DataPointRecord::factoryFromDataPoint(const analysis::DataPoint&
 }
 
 std::vector<DataPointRecord> DataPointRecord::getDataPointRecords(ProjectDatabase& database) {
-  std::vector<DataPointRecord> result;
-
-  QSqlQuery query(*(database.qSqlDatabase()));
-  query.prepare(toQString("SELECT * FROM " + DataPointRecord::databaseTableName()));
-  assertExec(query);
-  while (query.next()) {
-    OptionalDataPointRecord dataPointRecord = DataPointRecord::factoryFromQuery(query, database);
-    if (dataPointRecord) {
-      result.push_back(*dataPointRecord);
-    }
-  }
-
-  return result;
+  return database.getRecordsFromTable<DataPointRecord>();
 }
 
 boost::optional<DataPointRecord> DataPointRecord::getDataPointRecord(
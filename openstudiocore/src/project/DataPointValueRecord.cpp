@@ -385,16 +385,7 @@ boost::optional<DataPointValueRecord> DataPointValueRecord::factoryFromQuery(
 std::vector<DataPointValueRecord> DataPointValueRecord::getDataPointValueRecords(
     ProjectDatabase& database) 
 {
-  std::vector<DataPointValueRecord> result;
-
-  QSqlQuery query(*(database.qSqlDatabase()));
-  query.prepare(toQString("SELECT * FROM " + DataPointValueRecord::databaseTableName()));
-  assertExec(query);
-  while (query.next()) {
-    result.push_back(DataPointValueRecord(query, database));
-  }
-
-  return result;
+  return database.getRecordsFromTable<DataPointValueRecord>();
 }
 
 boost::optional<DataPointValueRecord> DataPointValueRecord::getDataPointValueRecord(int id, ProjectDatabase& database) {
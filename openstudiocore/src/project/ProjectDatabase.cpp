@@ -137,8 +137,8 @@ namespace detail {
       //query.prepare("PRAGMA journal_mode=DELETE");
       //query.prepare("PRAGMA journal_mode=TRUNCATE");
       //query.prepare("PRAGMA journal_mode=PERSIST");
-      query.prepare("PRAGMA journal_mode=MEMORY");
-      //query.prepare("PRAGMA journal_mode=WAL");
+      //query.prepare("PRAGMA journal_mode=MEMORY");
+      query.prepare("PRAGMA journal_mode=WAL");
       //query.prepare("PRAGMA journal_mode=OFF");
       query.exec();
 
@@ -183,6 +183,9 @@ namespace detail {
       // any uncommitted transactions will now be lost
     }
 
+    // finalize cached statements before closing the connection
+    m_preparedQueries.clear();
+
     // make sure we are the last one using database connection
     OS_ASSERT(m_qSqlDatabase.use_count() == 1);
 
@@ -389,6 +392,12 @@ namespace detail {
     if (didStartTransaction){
       bool didCommitTransaction = this->commitTransaction();
       OS_ASSERT(didCommitTransaction);
+
+      if (didChange){
+        // copy the write-ahead log into the database file so that the file alone is up to date
+        QSqlQuery query(*m_qSqlDatabase);
+        query.exec("PRAGMA wal_checkpoint(PASSIVE)");
+      }
     }
 
     m_ignoreSignals = false;
@@ -865,6 +874,17 @@ namespace detail {
     return m_qSqlDatabase;
   }
 
+  QSqlQuery ProjectDatabase_Impl::preparedQuery(const std::string& queryString) const
+  {
+    auto it = m_preparedQueries.find(queryString);
+    if (it == m_preparedQueries.end()){
+      QSqlQuery query(*m_qSqlDatabase);
+      query.prepare(toQString(queryString));
+      it = m_preparedQueries.insert(std::make_pair(queryString, query)).first;
+    }
+    return it->second;
+  }
+
   boost::optional<Record> ProjectDatabase_Impl::findLoadedRecord(const UUID& handle) const
   {
     boost::optional<Record> result;
@@ -213,6 +213,51 @@ class PROJECT_API ProjectDatabase {
     return *result;
   }
 
+  /** Gets all Records in T's table, or just those whose rows satisfy whereClause if it is not
+   *  empty. Rows are read in a single transaction and Records that are already loaded are
+   *  reused rather than constructed again. */
+  template<typename T>
+  std::vector<T> getRecordsFromTable(const std::string& whereClause = std::string())
+  {
+    std::vector<T> result;
+
+    std::string queryString = "SELECT * FROM " + T::databaseTableName();
+    if (!whereClause.empty()) {
+      queryString += " WHERE " + whereClause;
+    }
+
+    bool didStartTransaction = this->startTransaction();
+    try {
+      QSqlQuery query(*(this->qSqlDatabase()));
+      query.prepare(toQString(queryString));
+      assertExec(query);
+      while (query.next()) {
+        QVariant value = query.value(T::ColumnsType::handle);
+        OS_ASSERT(value.isValid() && !value.isNull());
+        boost::optional<Record> record = this->findLoadedRecord(toUUID(value.toString().toStdString()));
+        if (record) {
+          boost::optional<T> loaded = record->optionalCast<T>();
+          OS_ASSERT(loaded);
+          result.push_back(*loaded);
+        }
+        else if (boost::optional<T> constructed = T::factoryFromQuery(query, *this)) {
+          result.push_back(*constructed);
+        }
+      }
+    }
+    catch (...) {
+      if (didStartTransaction) {
+        this->commitTransaction();
+      }
+      throw;
+    }
+    if (didStartTransaction) {
+      this->commitTransaction();
+    }
+
+    return result;
+  }
+
   /// Gets an ObjectRecord by name.
   template <typename T>
   boost::optional<T> getObjectRecordByName(const std::string& name) {
@@ -160,6 +160,11 @@ namespace project {
         /// get the qSql database
         std::shared_ptr<QSqlDatabase> qSqlDatabase() const;
 
+        /// get a query for queryString that is only prepared the first time it is asked for,
+        /// the returned query shares its statement with the cache so it must be executed (and
+        /// finished, if a select) before queryString is asked for again
+        QSqlQuery preparedQuery(const std::string& queryString) const;
+
         // find record by handle, will check all maps
         boost::optional<Record> findLoadedRecord(const UUID& handle) const;
 
@@ -267,6 +272,9 @@ namespace project {
         bool m_reloaded;
         bool m_ignoreSignals;
 
+        // map of query string to prepared statement
+        mutable std::map<std::string, QSqlQuery> m_preparedQueries;
+
         // map of handle to record
         std::map<UUID, Record> m_handleNewRecordMap;
         std::map<UUID, Record> m_handleDirtyRecordMap;
@@ -189,13 +189,14 @@ namespace project {
       boost::optional<int> result;
 
       QSqlQuery query(*(projectDatabase.qSqlDatabase()));
-      query.prepare(toQString("SELECT id FROM " + this->databaseTableName() + " WHERE handle=:handle"));
+      this->prepareQuery(query, "SELECT id FROM " + this->databaseTableName() + " WHERE handle=:handle");
       query.bindValue(":handle", toQString(toString(this->handle())));
 
       assertExec(query);
       if(query.first()){
         result = query.value(0).toInt();
       }
+      query.finish();
 
       return result;
    }
@@ -205,13 +206,14 @@ namespace project {
       QSqlQuery query(*database);
 
       // check there is not already an entry
-      query.prepare(QString::fromStdString("SELECT id FROM " + this->databaseTableName() + " WHERE handle=:handle"));
+      this->prepareQuery(query, "SELECT id FROM " + this->databaseTableName() + " WHERE handle=:handle");
       query.bindValue(":handle", toQString(toString(this->handle())));
       assertExec(query);
       OS_ASSERT(!query.first());
+      query.finish();
 
       // do the insert
-      query.prepare(QString::fromStdString("INSERT INTO " + this->databaseTableName() + " (id) VALUES (:id)"));
+      this->prepareQuery(query, "INSERT INTO " + this->databaseTableName() + " (id) VALUES (:id)");
       query.bindValue(":id", QVariant(QVariant::Int));
       assertExec(query);
 
@@ -253,6 +255,18 @@ namespace project {
       return this->compareValues(query);
     }
 
+    void Record_Impl::prepareQuery(QSqlQuery& query, const std::string& queryString) const
+    {
+      // the weak impl has expired while the ProjectDatabase_Impl destructor writes back
+      // removed records, in which case the statement is prepared as usual
+      std::shared_ptr<detail::ProjectDatabase_Impl> database = m_projectDatabaseWeakImpl.lock();
+      if (database && (query.driver() == database->qSqlDatabase()->driver())) {
+        query = database->preparedQuery(queryString);
+      }else{
+        query.prepare(toQString(queryString));
+      }
+    }
+
     void Record_Impl::makeSelectAllQuery(QSqlQuery& query) const
     {
       std::stringstream ss;
@@ -316,7 +330,14 @@ namespace project {
 
     // check if this object is in the database but not yet loaded
     if (!m_impl){
-      boost::optional<int> id = impl->findIdByHandle();
+      // impls constructed from a query already know their row, so only look up the id
+      // of impls constructed from scratch
+      boost::optional<int> id;
+      if (impl->id() != std::numeric_limits<int>::min()) {
+        id = impl->id();
+      }else{
+        id = impl->findIdByHandle();
+      }
       if (id){
 
         // clean state of this object is from database
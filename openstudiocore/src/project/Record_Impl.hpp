@@ -174,11 +174,15 @@ namespace project {
         /// do we have values to revert to
         bool haveLastValues() const;
 
+        /// prepare queryString on query, reusing the statement cached by this record's
+        /// ProjectDatabase if query is on that database's connection
+        void prepareQuery(QSqlQuery& query, const std::string& queryString) const;
+
         /// get the query to update by id
         template<typename T>
         void makeUpdateByIdQuery(QSqlQuery& query) const {
           UpdateByIdQueryData queryData = T::updateByIdQueryData();
-          query.prepare(QString::fromStdString(queryData.queryString));
+          this->prepareQuery(query, queryData.queryString);
           auto colIndexIt = queryData.columnValues.begin();
           auto colIndexItEnd = queryData.columnValues.end();
           std::vector<QVariant>::const_iterator nullIt = queryData.nulls.begin();
@@ -365,3 +365,43 @@ TEST_F(ProjectFixture, AttributeRecord_FromScratch_Database)
   EXPECT_EQ("54.23",record2.attributeValueAsString());
 }
 
+
+TEST_F(ProjectFixture, AttributeRecord_BatchedLoad)
+{
+  std::vector<UUID> handles;
+  {
+    ProjectDatabase database = getCleanDatabase("AttributeRecord_BatchedLoad");
+
+    FileReferenceRecord model(FileReference(toPath("./in.osm")),database);
+    for (int i = 0; i < 100; ++i) {
+      std::stringstream ss;
+      ss << "attribute " << i;
+      AttributeRecord attributeRecord(Attribute(ss.str(),static_cast<double>(i)),model);
+      handles.push_back(attributeRecord.handle());
+    }
+    database.save();
+
+    // records are already loaded, so the same ones come back
+    AttributeRecordVector attributeRecords = AttributeRecord::getAttributeRecords(database);
+    ASSERT_EQ(100u,attributeRecords.size());
+    for (const AttributeRecord& attributeRecord : attributeRecords) {
+      EXPECT_TRUE(database.isCleanRecord(attributeRecord));
+    }
+    EXPECT_FALSE(database.isDirty());
+  }
+
+  ProjectDatabase database = getExistingDatabase("AttributeRecord_BatchedLoad");
+  AttributeRecordVector attributeRecords = AttributeRecord::getAttributeRecords(database);
+  ASSERT_EQ(100u,attributeRecords.size());
+  for (const AttributeRecord& attributeRecord : attributeRecords) {
+    auto it = std::find(handles.begin(),handles.end(),attributeRecord.handle());
+    ASSERT_TRUE(it != handles.end());
+    EXPECT_DOUBLE_EQ(static_cast<double>(it - handles.begin()),attributeRecord.attributeValueAsDouble());
+    EXPECT_TRUE(database.isCleanRecord(attributeRecord));
+  }
+
+  // loading again reuses the loaded records
+  AttributeRecordVector reloaded = AttributeRecord::getAttributeRecords(database);
+  ASSERT_EQ(100u,reloaded.size());
+  EXPECT_TRUE(reloaded[0].getImpl<detail::AttributeRecord_Impl>() == attributeRecords[0].getImpl<detail::AttributeRecord_Impl>());
+}
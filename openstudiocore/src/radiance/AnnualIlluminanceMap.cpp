@@ -23,12 +23,9 @@
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <cstdlib>
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
 #include <boost/filesystem/fstream.hpp>
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
 
 using namespace std;
 using namespace boost;
@@ -71,12 +68,6 @@ namespace radiance{
     // lines 1 and 2 are the header lines
     string line1, line2;
 
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
     // conversion from footcandles to lux
     const double footcandlesToLux(10.76);
 
@@ -98,12 +89,12 @@ namespace radiance{
         // create the header info
         HeaderInfo headerInfo(line1, line2);
 
-        // we can now initialize x and y vectors
-        m_xVector = headerInfo.xVector();
-        m_yVector = headerInfo.yVector();
+        // we can now initialize the grid
+        m_series = IlluminanceMapSeries(headerInfo.xVector(), headerInfo.yVector());
+        m_series.reserve(8760);
 
-        M = m_xVector.size();
-        N = m_yVector.size();
+        M = m_series.x().size();
+        N = m_series.y().size();
 
       }else{
 
@@ -111,45 +102,42 @@ namespace radiance{
         // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
         // followed by M*N illuminance points
 
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string > tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string >::iterator it(tk.begin()); it!=tk.end(); ++it)
-        {
-           lineVector.push_back(*it);
+        // parse the numbers in place rather than splitting the line into strings
+        std::vector<double> lineValues;
+        lineValues.reserve(6 + M*N);
+        const char* begin = line.c_str();
+        char* end = nullptr;
+        for (double value = strtod(begin, &end); end != begin; value = strtod(begin, &end)){
+          lineValues.push_back(value);
+          begin = end;
         }
 
         // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
+        unsigned numValues = (lineValues.size() < 6) ? 0 : lineValues.size() - 6;
 
         if (numValues != M*N){
           LOG(Fatal,  "Incorrect number of illuminance values read " << numValues << ", expecting " << M*N << ".");
           return;
         }else{
 
-          MonthOfYear month = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          unsigned day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+          MonthOfYear month = monthOfYear(static_cast<unsigned>(lineValues[0]));
+          unsigned day = static_cast<unsigned>(lineValues[1]);
+          double fracDays = lineValues[2] / 24.0;
 
           // ignore solar angles and global horizontal for now
 
           // make the date time
           DateTime dateTime(Date(month, day), Time(fracDays));
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M,N);
-
-          // read in the values
+          // values are listed with x varying fastest, the series stores y fastest
+          float* illuminanceMap = m_series.append(dateTime);
           unsigned index = 6;
           for (unsigned j = 0; j < N; ++j){
             for (unsigned i = 0; i < M; ++i){
-              illuminanceMap(i,j) = footcandlesToLux*lexical_cast<double>(lineVector[index]);
+              illuminanceMap[i*N + j] = static_cast<float>(footcandlesToLux*lineValues[index]);
               ++index;
             }
           }
-
-          m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
         }
       }
     }
@@ -159,14 +147,9 @@ namespace radiance{
   }
 
   /// get the illuminance map in lux corresponding to date and time
-  const openstudio::Matrix& AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const
+  openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const
   {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()){
-      return it->second;
-    }
-
-    return m_nullIlluminanceMap;
+    return m_series.illuminanceMap(dateTime);
   }
 
 
@@ -24,6 +24,7 @@
 
 #include "../utilities/data/Vector.hpp"
 #include "../utilities/data/Matrix.hpp"
+#include "../utilities/data/IlluminanceMapSeries.hpp"
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
@@ -37,11 +38,6 @@ namespace radiance{
   */ 
   class RADIANCE_API AnnualIlluminanceMap
   {
-    private:
-
-      // map of DateTime to Matrix (illuminance map)
-      typedef std::map<openstudio::DateTime, openstudio::Matrix> DateTimeIlluminanceMap;
-
     public:
 
       /// default constructor
@@ -54,17 +50,19 @@ namespace radiance{
       virtual ~AnnualIlluminanceMap () {}
 
       /// get the dates and times for which illuminance maps are available
-      openstudio::DateTimeVector dateTimes() {return m_dateTimes;}
-      //openstudio::DateTime::ConstVec dateTimes() const {return openstudio::DateTime::ConstVec(m_dateTimes.begin(), m_dateTimes.end());}
+      openstudio::DateTimeVector dateTimes() const {return m_series.dateTimes();}
 
       /// get the x points corresponding to illuminance matrix columns in meters
-      const openstudio::Vector& xVector() const {return m_xVector;}
+      const openstudio::Vector& xVector() const {return m_series.x();}
 
       /// get the y points corresponding to illuminance matrix rows in meters
-      const openstudio::Vector& yVector() const {return m_yVector;}
+      const openstudio::Vector& yVector() const {return m_series.y();}
+
+      /// get the illuminance map in lux corresponding to date and time, empty if there is no data
+      openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
-      /// get the illuminance map in lux corresponding to date and time
-      const openstudio::Matrix& illuminanceMap(const openstudio::DateTime& dateTime) const;
+      /// get all illuminance maps in lux, for annual metrics such as daylight autonomy
+      const openstudio::IlluminanceMapSeries& illuminanceMapSeries() const {return m_series;}
 
     private:
 
@@ -72,11 +70,7 @@ namespace radiance{
 
       void init(const openstudio::path& path);
 
-      openstudio::DateTimeVector m_dateTimes;
-      openstudio::Vector m_xVector;
-      openstudio::Vector m_yVector;
-      openstudio::Matrix m_nullIlluminanceMap; // used when there is no data
-      DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+      openstudio::IlluminanceMapSeries m_series;
   };
 
 } // radiance
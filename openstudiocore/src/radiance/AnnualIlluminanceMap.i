@@ -22,6 +22,9 @@
 
 %ignore openstudio::radiance::AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::Path&);
 
+// IlluminanceMapSeries is not wrapped
+%ignore openstudio::radiance::AnnualIlluminanceMap::illuminanceMapSeries;
+
 %include <radiance/AnnualIlluminanceMap.hpp>
 
 #endif //RADIANCE_ANNUALILLUMINANCEMAP_I 
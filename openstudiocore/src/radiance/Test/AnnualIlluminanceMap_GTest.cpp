@@ -67,6 +67,24 @@ AnnualIlluminanceMap RadAnnualIlluminanceMapFixture::outFile;
 
 TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap)
 {
-
+  openstudio::DateTimeVector dateTimes = outFile.dateTimes();
+  ASSERT_FALSE(dateTimes.empty());
+
+  const openstudio::IlluminanceMapSeries& series = outFile.illuminanceMapSeries();
+  EXPECT_EQ(dateTimes.size(), series.numDateTimes());
+
+  openstudio::Matrix map = outFile.illuminanceMap(dateTimes.front());
+  EXPECT_EQ(outFile.xVector().size(), map.size1());
+  EXPECT_EQ(outFile.yVector().size(), map.size2());
+
+  openstudio::Matrix autonomy = series.fractionAtLeast(300.0);
+  ASSERT_EQ(map.size1(), autonomy.size1());
+  ASSERT_EQ(map.size2(), autonomy.size2());
+  for (unsigned i = 0; i < autonomy.size1(); ++i){
+    for (unsigned j = 0; j < autonomy.size2(); ++j){
+      EXPECT_LE(0.0, autonomy(i,j));
+      EXPECT_GE(1.0, autonomy(i,j));
+    }
+  }
 }
 
@@ -61,6 +61,11 @@ namespace runmanager {
     return rhs.toolType == toolType && rhs.binaryDir == binaryDir;
   }
 
+  bool JobResources::operator==(const JobResources &rhs) const
+  {
+    return rhs.cores == cores && rhs.memory == memory;
+  }
+
   std::ostream &operator<<(std::ostream &os, const ToolLocationInfo &epi)
   {
     os << "(" << epi.toolType.valueDescription() << ", " << toString(epi.binaryDir) << ")";
@@ -71,6 +76,7 @@ namespace runmanager {
 
   ConfigOptions::ConfigOptions(bool t_loadQSettings)
      : m_maxLocalJobs(std::max(1u, boost::thread::hardware_concurrency()-1)),
+       m_maxLocalMemory(0),
        m_simpleName(false)
   {
     if (t_loadQSettings)
@@ -528,6 +534,71 @@ namespace runmanager {
     m_maxLocalJobs = t_numjobs;
   }
 
+  double ConfigOptions::getMaxLocalMemory() const
+  {
+    return m_maxLocalMemory;
+  }
+
+  void ConfigOptions::setMaxLocalMemory(double t_memory)
+  {
+    m_maxLocalMemory = std::max(0.0, t_memory);
+  }
+
+  JobResources ConfigOptions::getJobResources(const JobType &t_jobType) const
+  {
+    auto itr = m_jobResources.find(t_jobType);
+    if (itr != m_jobResources.end())
+    {
+      return itr->second;
+    }
+
+    return defaultJobResources(t_jobType);
+  }
+
+  void ConfigOptions::setJobResources(const JobType &t_jobType, const JobResources &t_resources)
+  {
+    m_jobResources[t_jobType] = t_resources;
+  }
+
+  openstudio::path ConfigOptions::getResultCacheLocation() const
+  {
+    return m_resultCacheLocation;
+  }
+
+  void ConfigOptions::setResultCacheLocation(const openstudio::path &t_loc)
+  {
+    m_resultCacheLocation = t_loc;
+  }
+
+  std::vector<std::pair<JobType, JobResources> > ConfigOptions::getJobResourceOverrides() const
+  {
+    return std::vector<std::pair<JobType, JobResources> >(m_jobResources.begin(), m_jobResources.end());
+  }
+
+  JobResources ConfigOptions::defaultJobResources(const JobType &t_jobType)
+  {
+    switch (t_jobType.value())
+    {
+      case JobType::Workflow:
+      case JobType::Null:
+        // containers for child jobs, they do not run a process of their own
+        return JobResources(0, 0);
+      case JobType::EnergyPlus:
+      case JobType::ParallelEnergyPlusJoin:
+        return JobResources(1, 1000);
+      case JobType::ModelToIdf:
+      case JobType::IdfToModel:
+      case JobType::ModelToRad:
+      case JobType::ModelToRadPreProcess:
+      case JobType::Ruby:
+      case JobType::UserScript:
+      case JobType::Dakota:
+        return JobResources(1, 500);
+      default:
+        return JobResources(1, 200);
+    }
+  }
+
   bool ConfigOptions::getSimpleName() const
   {
     return m_simpleName;
@@ -698,6 +769,8 @@ namespace runmanager {
     }
 
     QVariant maxlocaljobs = settings.value("runmanager_maxlocaljobs");
+    QVariant maxlocalmemory = settings.value("runmanager_maxlocalmemory");
+    QVariant resultcachelocation = settings.value("runmanager_resultcachelocation");
     QVariant defaultidflocation = settings.value("runmanager_defaultidflocation");
     QVariant defaultepwlocation = settings.value("runmanager_defaultepwlocation");
     QVariant outputlocation = settings.value("runmanager_outputlocation");
@@ -708,6 +781,16 @@ namespace runmanager {
       setMaxLocalJobs(maxlocaljobs.toInt());
     }
 
+    if (maxlocalmemory.isValid())
+    {
+      setMaxLocalMemory(maxlocalmemory.toDouble());
+    }
+
+    if (resultcachelocation.isValid())
+    {
+      setResultCacheLocation(openstudio::toPath(resultcachelocation.toString()));
+    }
+
     if (defaultidflocation.isValid())
     {
       setDefaultIDFLocation(openstudio::toPath(defaultidflocation.toString()));
@@ -728,6 +811,19 @@ namespace runmanager {
       setSimpleName(simplename.toBool());
     }
 
+    int count = settings.beginReadArray("runmanager_jobresources");
+    for (int i = 0; i < count; ++i)
+    {
+      try {
+        settings.setArrayIndex(i);
+        setJobResources(JobType(openstudio::toString(settings.value("jobType").toString())),
+            JobResources(settings.value("cores").toInt(), settings.value("memory").toDouble()));
+      } catch (const std::exception &e) {
+        LOG(Error, "Error loading runmanager job resource estimates: " << e.what());
+      }
+    }
+    settings.endArray();
+
   }
 
 
@@ -741,11 +837,25 @@ namespace runmanager {
     settings.setValue("runmanager_settings_openstudio_version", openstudio::toQString(openStudioVersion()));
 
     settings.setValue("runmanager_maxlocaljobs", getMaxLocalJobs());
+    settings.setValue("runmanager_maxlocalmemory", getMaxLocalMemory());
+    settings.setValue("runmanager_resultcachelocation", openstudio::toQString(getResultCacheLocation()));
     settings.setValue("runmanager_defaultidflocation", openstudio::toQString(getDefaultIDFLocation()));
     settings.setValue("runmanager_defaultepwlocation", openstudio::toQString(getDefaultEPWLocation()));
     settings.setValue("runmanager_outputlocation", openstudio::toQString(getOutputLocation()));
     settings.setValue("runmanager_simplename", getSimpleName());
 
+    std::vector<std::pair<JobType, JobResources> > jobResources = getJobResourceOverrides();
+    settings.remove("runmanager_jobresources");
+    settings.beginWriteArray("runmanager_jobresources", jobResources.size());
+    for (size_t i = 0; i < jobResources.size(); ++i)
+    {
+      settings.setArrayIndex(i);
+      settings.setValue("jobType", openstudio::toQString(jobResources[i].first.valueName()));
+      settings.setValue("cores", jobResources[i].second.cores);
+      settings.setValue("memory", jobResources[i].second.memory);
+    }
+    settings.endArray();
+
   }
 
 
@@ -22,10 +22,13 @@
 
 #include "RunManagerAPI.hpp"
 #include "ToolInfo.hpp"
+#include "JobType.hpp"
 
 #include "../../utilities/core/Path.hpp"
 #include "../../utilities/core/Enum.hpp"
 
+#include <map>
+
 namespace openstudio {
 namespace runmanager {
 
@@ -65,6 +68,30 @@ namespace runmanager {
   /// Operator overload for streaming ToolLocationInfo to ostream
   RUNMANAGER_API std::ostream &operator<<(std::ostream &os, const ToolLocationInfo &epi);
 
+  /// Estimated local resources used by a running job, used by the RunManager to fill local slots
+  class RUNMANAGER_API JobResources
+  {
+    public:
+      JobResources()
+        : cores(1), memory(0)
+      {}
+
+      /** 
+       *  \param[in] t_cores Number of cores the job keeps busy
+       *  \param[in] t_memory Estimated peak memory use in megabytes */
+      JobResources(int t_cores, double t_memory)
+        : cores(t_cores), memory(t_memory)
+      {}
+
+      bool operator==(const JobResources &rhs) const;
+
+      /// Number of cores the job keeps busy, 0 for jobs that do no significant work themselves
+      int cores;
+
+      /// Estimated peak memory use in megabytes
+      double memory;
+  };
+
 
   //! Stores configuration options for the runmanager project
   //! \sa openstudio::runmanager::Configuration
@@ -212,13 +239,44 @@ namespace runmanager {
       //! \param[in] t_loc The new location
       void setOutputLocation(const openstudio::path &t_loc);
 
-      //! \returns the maximum number of simultaneous jobs to run locally
+      //! \returns the maximum number of simultaneous jobs to run locally. This is a budget of cores: each
+      //!          running job counts with the cores of its getJobResources estimate, so Workflow and Null
+      //!          jobs, which only hold child jobs, do not take a slot
       int getMaxLocalJobs() const;
 
       //! Set the maximum number of simultaneous jobs to run locally
-      //! \param[in] t_numjobs the new max
+      //! \param[in] t_numjobs the new max, in cores as for getMaxLocalJobs
       void setMaxLocalJobs(int t_numjobs);
 
+      //! \returns the maximum estimated memory in megabytes for simultaneous local jobs, 0 for no limit
+      double getMaxLocalMemory() const;
+
+      //! Set the maximum estimated memory in megabytes for simultaneous local jobs
+      //! \param[in] t_memory the new max, 0 for no limit
+      void setMaxLocalMemory(double t_memory);
+
+      //! \returns the resources a job of type t_jobType is expected to use when run locally.
+      //!          The sum of cores over running local jobs is limited by getMaxLocalJobs
+      JobResources getJobResources(const JobType &t_jobType) const;
+
+      //! Override the default resource estimate for a job type
+      //! \param[in] t_jobType the job type to set the estimate for
+      //! \param[in] t_resources the new estimate
+      void setJobResources(const JobType &t_jobType, const JobResources &t_resources);
+
+      //! \returns the job types whose resource estimates have been overridden, with their estimates
+      std::vector<std::pair<JobType, JobResources> > getJobResourceOverrides() const;
+
+      //! \returns the built in resource estimate for a job type
+      static JobResources defaultJobResources(const JobType &t_jobType);
+
+      //! \returns the directory used to cache outputs of tools with identical inputs, empty if disabled
+      openstudio::path getResultCacheLocation() const;
+
+      //! Sets the directory used to cache outputs of tools with identical inputs
+      //! \param[in] t_loc The new location, an empty path disables the cache
+      void setResultCacheLocation(const openstudio::path &t_loc);
+
       //! \returns True if jobs created by the RunManager UI should have simple folder names
       //!          these folder names are more likely to conflict with other jobs
       bool getSimpleName() const;
@@ -260,6 +318,15 @@ namespace runmanager {
       //! Number of jobs that can be run locally simultaneously
       int m_maxLocalJobs;
 
+      //! Estimated memory that can be used by jobs run locally simultaneously, 0 for no limit
+      double m_maxLocalMemory;
+
+      //! Overrides of the default per job type resource estimates
+      std::map<JobType, JobResources> m_jobResources;
+
+      //! Location of the tool result cache, empty if disabled
+      openstudio::path m_resultCacheLocation;
+
       //! Whether the UI should use simplified folder names which are more likely to conflict with each other
       bool m_simpleName;
 
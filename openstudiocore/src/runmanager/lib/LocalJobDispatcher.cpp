@@ -0,0 +1,93 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include "LocalJobDispatcher.hpp"
+
+namespace openstudio {
+namespace runmanager {
+
+  LocalJobDispatcher::LocalJobDispatcher(int t_reservationSeconds)
+    : m_reservationSeconds(t_reservationSeconds)
+  {
+  }
+
+  std::vector<openstudio::UUID> LocalJobDispatcher::selectJobsToStart(const std::vector<Candidate> &t_queue,
+      int t_maxCores, double t_maxMemory, const QDateTime &t_now)
+  {
+    int usedCores = 0;
+    double usedMemory = 0;
+
+    for (const auto & candidate : t_queue)
+    {
+      if (candidate.running)
+      {
+        usedCores += candidate.resources.cores;
+        usedMemory += candidate.resources.memory;
+      }
+    }
+
+    std::vector<openstudio::UUID> result;
+    std::map<openstudio::UUID, QDateTime> waitingSince;
+    bool reserved = false;
+
+    for (const auto & candidate : t_queue)
+    {
+      if (candidate.running || !candidate.runnable)
+      {
+        continue;
+      }
+
+      const JobResources &resources = candidate.resources;
+      bool lightweight = (resources.cores <= 0 && resources.memory <= 0);
+
+      if (reserved && !lightweight)
+      {
+        continue;
+      }
+
+      // a job larger than the limits may still run by itself
+      bool fits = lightweight
+        || ((usedCores + resources.cores <= t_maxCores || (usedCores == 0 && t_maxCores > 0))
+            && (t_maxMemory <= 0 || usedMemory + resources.memory <= t_maxMemory || usedMemory == 0));
+
+      if (fits)
+      {
+        result.push_back(candidate.uuid);
+        usedCores += resources.cores;
+        usedMemory += resources.memory;
+      } else {
+        auto itr = m_waitingSince.find(candidate.uuid);
+        QDateTime since = (itr == m_waitingSince.end()) ? t_now : itr->second;
+        waitingSince[candidate.uuid] = since;
+
+        if (since.addSecs(m_reservationSeconds) <= t_now)
+        {
+          // hold the resources that are freed from here on for this job
+          reserved = true;
+        }
+      }
+    }
+
+    m_waitingSince.swap(waitingSince);
+
+    return result;
+  }
+
+}
+}
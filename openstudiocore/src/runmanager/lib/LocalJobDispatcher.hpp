@@ -0,0 +1,82 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#ifndef RUNMANAGER_LIB_LOCALJOBDISPATCHER_HPP
+#define RUNMANAGER_LIB_LOCALJOBDISPATCHER_HPP
+
+#include "RunManagerAPI.hpp"
+#include "ConfigOptions.hpp"
+
+#include "../../utilities/core/UUID.hpp"
+
+#include <QDateTime>
+
+#include <map>
+#include <vector>
+
+namespace openstudio {
+namespace runmanager {
+
+  /// Chooses which queued jobs the RunManager starts locally, keeping the estimated resources of the
+  /// running jobs within the configured core and memory limits.
+  ///
+  /// Jobs are considered in queue (priority) order and each one that fits is started. A job larger than
+  /// the limits may still run once nothing else is using resources. Jobs that use no resources, such as
+  /// Workflow and Null containers, always start. A runnable job that has been passed over for lack of
+  /// resources for the reservation period reserves them: jobs after it in the queue that need resources
+  /// are not started until it has started, so a steady stream of small jobs cannot starve a large one.
+  class RUNMANAGER_API LocalJobDispatcher
+  {
+    public:
+      /// A queued job as seen by the dispatcher
+      struct Candidate
+      {
+        Candidate(const openstudio::UUID &t_uuid, const JobResources &t_resources, bool t_running, bool t_runnable)
+          : uuid(t_uuid), resources(t_resources), running(t_running), runnable(t_runnable)
+        {}
+
+        openstudio::UUID uuid;
+        JobResources resources;
+        bool running;
+        bool runnable;
+      };
+
+      /// \param[in] t_reservationSeconds How long a runnable job can be passed over for lack of resources
+      ///                                 before it reserves them
+      explicit LocalJobDispatcher(int t_reservationSeconds = 30);
+
+      /// \param[in] t_queue The queued jobs in priority order
+      /// \param[in] t_maxCores Limit on the sum of cores over running jobs
+      /// \param[in] t_maxMemory Limit on the sum of memory over running jobs in megabytes, 0 for no limit
+      /// \param[in] t_now The current time, used to track how long jobs have been waiting
+      /// \returns the uuids of the jobs to start, in queue order
+      std::vector<openstudio::UUID> selectJobsToStart(const std::vector<Candidate> &t_queue,
+          int t_maxCores, double t_maxMemory, const QDateTime &t_now);
+
+    private:
+      int m_reservationSeconds;
+
+      /// Time each runnable job was first passed over for lack of local resources
+      std::map<openstudio::UUID, QDateTime> m_waitingSince;
+  };
+
+}
+}
+
+#endif // RUNMANAGER_LIB_LOCALJOBDISPATCHER_HPP
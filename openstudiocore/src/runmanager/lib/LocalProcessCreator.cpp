@@ -19,6 +19,11 @@
 
 #include "LocalProcessCreator.hpp"
 #include "LocalProcess.hpp"
+#include "ResultCache.hpp"
+
+#include "../../utilities/core/PathHelpers.hpp"
+
+#include <set>
 
 namespace openstudio {
 namespace runmanager {
@@ -27,6 +32,29 @@ namespace runmanager {
   {
   }
 
+  void LocalProcessCreator::setResultCacheLocation(const openstudio::path &t_location)
+  {
+    QMutexLocker l(&m_mutex);
+
+    if (t_location.empty())
+    {
+      m_resultCache.reset();
+    } else if (!m_resultCache || m_resultCache->location() != boost::filesystem::complete(t_location)) {
+      try {
+        m_resultCache = std::make_shared<ResultCache>(t_location);
+      } catch (const std::exception &e) {
+        LOG(Error, "Unable to use result cache location " << toString(t_location) << ": " << e.what());
+        m_resultCache.reset();
+      }
+    }
+  }
+
+  std::shared_ptr<ResultCache> LocalProcessCreator::resultCache() const
+  {
+    QMutexLocker l(&m_mutex);
+    return m_resultCache;
+  }
+
   std::shared_ptr<Process> LocalProcessCreator::createProcess(
       const openstudio::runmanager::ToolInfo &t_tool,
       const std::vector<std::pair<openstudio::path, openstudio::path> > &t_requiredFiles,
@@ -36,7 +64,21 @@ namespace runmanager {
       const std::string &t_stdin,
       const openstudio::path &t_basePath)
   {
-    return std::shared_ptr<Process>(
+    std::shared_ptr<ResultCache> cache = resultCache();
+
+    std::string manifest;
+    if (cache)
+    {
+      manifest = ResultCache::manifest(t_tool, t_requiredFiles, t_parameters, t_outdir, t_expectedOutputFiles, t_stdin, t_basePath);
+
+      boost::optional<CachedResult> result = cache->restore(manifest, t_outdir);
+      if (result)
+      {
+        return std::shared_ptr<Process>(new detail::CachedProcess(*result, t_requiredFiles, t_outdir));
+      }
+    }
+
+    std::shared_ptr<Process> process(
         new detail::LocalProcess(
           t_tool,
           t_requiredFiles,
@@ -45,8 +87,53 @@ namespace runmanager {
           t_expectedOutputFiles,
           t_stdin,
           t_basePath));
-  }
 
+    if (!manifest.empty())
+    {
+      // record the outputs of a successful run, these connections are made before the job's own
+      // so the outputs are stored before the job processes them
+      std::shared_ptr<std::string> standardOut = std::make_shared<std::string>();
+      std::shared_ptr<std::string> standardErr = std::make_shared<std::string>();
+      std::weak_ptr<Process> weakProcess = process;
+
+      // earlier tools of the same job may share the output directory, so only files this run writes are stored
+      std::shared_ptr<const ResultCache::DirectorySnapshot> before
+        = std::make_shared<const ResultCache::DirectorySnapshot>(ResultCache::snapshot(t_outdir));
+
+      connect(process.get(), &Process::standardOutDataAdded, [standardOut](const std::string &t_data) { standardOut->append(t_data); });
+      connect(process.get(), &Process::standardErrDataAdded, [standardErr](const std::string &t_data) { standardErr->append(t_data); });
+      connect(process.get(), &Process::finished,
+          [cache, manifest, t_outdir, weakProcess, standardOut, standardErr, before](int t_exitCode, QProcess::ExitStatus t_exitStatus) {
+            std::shared_ptr<Process> p = weakProcess.lock();
+            if (!p || p->stopped() || t_exitCode != 0 || t_exitStatus != QProcess::NormalExit)
+            {
+              return;
+            }
+
+            std::vector<openstudio::path> changed = ResultCache::changedFiles(*before, ResultCache::snapshot(t_outdir));
+            std::set<openstudio::path> written(changed.begin(), changed.end());
+
+            std::vector<openstudio::path> files;
+            for (const auto & file : p->outputFiles())
+            {
+              if (!file.exists || file.filename == "stdout" || file.filename == "stderr")
+              {
+                continue;
+              }
+
+              openstudio::path relative = openstudio::relativePath(file.fullPath, t_outdir);
+              if (!relative.empty() && written.count(relative))
+              {
+                files.push_back(relative);
+              }
+            }
+
+            cache->store(manifest, t_outdir, files, *standardOut, *standardErr);
+          });
+    }
+
+    return process;
+  }
 
 
 }
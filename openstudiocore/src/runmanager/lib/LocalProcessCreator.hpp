@@ -24,10 +24,15 @@
 #include <vector>
 #include <string>
 #include "../../utilities/core/Path.hpp"
+#include "../../utilities/core/Logger.hpp"
+
+#include <QMutex>
 
 namespace openstudio {
 namespace runmanager {
 
+  class ResultCache;
+
 
   /// Implements ProcessCreator interface to create a process locally.
   ///
@@ -58,6 +63,20 @@ namespace runmanager {
           const std::string &t_stdin,
           const openstudio::path &t_basePath);
 
+      /// Sets the directory of the ResultCache used for tools whose outputs depend only on their inputs.
+      /// Cached outputs are restored instead of running the tool, and outputs of successful runs are stored.
+      /// \param[in] t_location cache directory, an empty path disables caching
+      void setResultCacheLocation(const openstudio::path &t_location);
+
+      /// \returns the ResultCache in use, if any
+      std::shared_ptr<ResultCache> resultCache() const;
+
+    private:
+      REGISTER_LOGGER("openstudio.runmanager.LocalProcessCreator");
+
+      mutable QMutex m_mutex;
+      std::shared_ptr<ResultCache> m_resultCache;
+
   };
 
 }
@@ -173,7 +173,8 @@ namespace detail {
           ft.setExcludeLCCObjects(true);
         }
 
-        openstudio::Workspace workspace = ft.translateModel(*m);
+        // the loaded model is not used after translation, so translate it without a copy
+        openstudio::Workspace workspace = ft.translateModelInPlace(*m);
 
         if (workspace.numObjects() > 0){
           boost::filesystem::ofstream ofs(outpath / openstudio::toPath("in.idf"));
@@ -26,11 +26,13 @@
 #include <sstream>
 #include <iomanip>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/iter_find.hpp>
+#include <boost/lexical_cast.hpp>
 
 #include "../../../utilities/idf/IdfFile.hpp"
 #include "../../../utilities/idf/IdfObject.hpp"
@@ -94,96 +96,111 @@ void ParallelEnergyPlus::getRunPeriod(const openstudio::WorkspaceObject &t_runPe
 }
 
 
-void ParallelEnergyPlus::computeLinearCombination(int &A, int &B, int &X,
-    int &Y, double &t_averageDays, const double daysPerPeriod, const double totalDays, const int t_numPartitions)
+std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > ParallelEnergyPlus::createPartitions(const openstudio::WorkspaceObject &t_runPeriod, int t_offset, int t_numPartitions)
 {
-  if (totalDays < t_numPartitions)
+  boost::gregorian::date sd, ed;
+  getRunPeriod(t_runPeriod, sd, ed);
+  return createPartitions(sd, ed, t_offset, t_numPartitions);
+}
+
+std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > ParallelEnergyPlus::createPartitions(
+    const boost::gregorian::date &t_startDate, const boost::gregorian::date &t_endDate,
+    int t_offset, int t_numPartitions)
+{
+  if (t_numPartitions < 1)
   {
-    throw std::runtime_error("cannot have more partitions than days");
+    throw std::runtime_error("at least one partition is required");
   }
 
-  B = ceil(daysPerPeriod);
-  A = floor(daysPerPeriod);
+  int totalDays = (t_endDate - t_startDate).days() + 1;
 
-  if (B > A)
-  {
-    Y = (totalDays - A * t_numPartitions) / (B - A);
-  }
-  else
+  LOG(Debug, "t_offset " << t_offset << " t_numPartitions " << t_numPartitions << " totalDays " << totalDays);
+
+  if (totalDays < t_numPartitions)
   {
-    Y = t_numPartitions / 2;
+    throw std::runtime_error("cannot have more partitions than days");
   }
 
-  X = t_numPartitions - Y;
+  // Every partition after the first re-simulates t_offset days before the days it reports.
+  // Spread the total simulated days evenly, giving the extra days to the last partitions.
+  int simulatedDays = totalDays + t_offset * (t_numPartitions - 1);
+  int baseDays = simulatedDays / t_numPartitions;
+  int remainder = simulatedDays % t_numPartitions;
 
-  t_averageDays = (X * A + Y * B) / static_cast<double> (X + Y);
-}
+  if (t_numPartitions > 1 && baseDays - t_offset < 1)
+  {
+    throw std::runtime_error("The days per period is too small compared to the offset, they fully overlap");
+  }
 
-void ParallelEnergyPlus::createPartitions(boost::gregorian::date &d1, const boost::gregorian::date &ed,
-    const int A, const int startVal, const int endVal, const int t_offset, const boost::gregorian::date &t_startDate, 
-    std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > &t_partitions)
-{
-  boost::gregorian::date_duration increment(A - 1);
-  boost::gregorian::date_duration offset(t_offset);
+  std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > partitions;
+  boost::gregorian::date d1(t_startDate);
 
-  for (int i = startVal; i < endVal; ++i)
+  for (int i = 0; i < t_numPartitions; ++i)
   {
-    boost::gregorian::date d2(d1 + increment);
-    boost::gregorian::date ds(d1);
-    ds = ds - offset;
-    if (ds < t_startDate)
-    {
-      ds = t_startDate;
-    }
+    int days = baseDays + ((i >= t_numPartitions - remainder) ? 1 : 0);
+    int leadIn = (i == 0) ? 0 : t_offset;
 
-    if (d2 > ed)
+    boost::gregorian::date d2(d1 + boost::gregorian::date_duration(days - leadIn - 1));
+    if (d2 > t_endDate || i == t_numPartitions - 1)
     {
-      d2 = ed;
+      d2 = t_endDate;
     }
 
-    //boost::gregorian::date_duration dur = d2 - ds;
-    t_partitions[i] = std::make_pair(ds, d2);
+    partitions.push_back(std::make_pair(d1 - boost::gregorian::date_duration(leadIn), d2));
     d1 = d2 + boost::gregorian::date_duration(1);
   }
+
+  return partitions;
 }
 
-// Break this up into smaller bits
-std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > ParallelEnergyPlus::createPartitions(const openstudio::WorkspaceObject &t_runPeriod, int t_offset, int t_numPartitions)
+int ParallelEnergyPlus::numberOfPartitions(int t_totalDays, int t_offset, double t_warmupDays, int t_maxPartitions)
 {
+  if (t_maxPartitions < 1 || t_totalDays <= t_offset)
+  {
+    return 1;
+  }
 
-  boost::gregorian::date sd, ed;
-  getRunPeriod(t_runPeriod, sd, ed);
-
-  boost::gregorian::date_duration totalduration = ed - sd;
-  double totalDays = totalduration.days() + 1;
-
-  LOG(Debug, "t_offset " << t_offset << " t_numPartitions " << t_numPartitions << " totalDays " << totalDays);
-
-  std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > partitions(t_numPartitions);
-
-  // Compute partitions
-  double daysPerPeriod = totalDays / t_numPartitions;
+  // Wall time with N partitions is roughly warmup + (totalDays + offset * (N - 1)) / N, which keeps
+  // falling as N grows, but each partition past the first pays offset + warmup days of overhead
+  // for (totalDays - offset) / N days of results. Stop once the overhead exceeds the results.
+  double overhead = std::max(1.0, t_offset + std::max(0.0, t_warmupDays));
+  int result = static_cast<int>((t_totalDays - t_offset) / overhead);
+  result = std::max(1, std::min(result, std::min(t_maxPartitions, t_totalDays)));
 
-  if (daysPerPeriod-1 < t_offset)
+  // createPartitions needs every partition to report at least one day
+  while (result > 1 && (t_totalDays + t_offset * (result - 1)) / result - t_offset < 1)
   {
-    throw std::runtime_error("The days per period is too small compared to the offset, they fully overlap");
+    --result;
   }
 
-  int X, Y, A, B;
-  double averageDays;
-  computeLinearCombination(A, B, X, Y, averageDays, daysPerPeriod, totalDays, t_numPartitions);
+  LOG(Debug, "numberOfPartitions: totalDays " << t_totalDays << " offset " << t_offset
+      << " warmupDays " << t_warmupDays << " maxPartitions " << t_maxPartitions << " -> " << result);
 
-  // So... x processors get A days and y processors get B days
-  // Start with ranks 0... x
-  boost::gregorian::date d1(sd);
+  return result;
+}
 
-  //std::cout << boost::gregorian::to_simple_string(d1) << std::endl;
-  createPartitions(d1, ed, A, 0, X, t_offset, sd, partitions);
+boost::optional<int> ParallelEnergyPlus::warmupDays(const openstudio::path &t_eio)
+{
+  std::ifstream ifs(openstudio::toString(t_eio).c_str());
 
-  //std::cout << boost::gregorian::to_simple_string(d1) << std::endl;
-  createPartitions(d1, ed, B, X, t_numPartitions, t_offset, sd, partitions);
+  boost::optional<int> result;
+  std::string line;
+  const std::string key = "Environment:WarmupDays,";
 
-  return partitions;
+  while (std::getline(ifs, line))
+  {
+    boost::trim(line);
+    if (boost::starts_with(line, key))
+    {
+      try {
+        result = boost::lexical_cast<int>(boost::trim_copy(line.substr(key.size())));
+      } catch (const boost::bad_lexical_cast &) {
+        LOG(Debug, "Unable to read warmup days from: " << line);
+      }
+    }
+  }
+
+  return result;
 }
 
 
@@ -20,16 +20,18 @@
 #ifndef RUNMANAGER_LIB_PARALLELENERGYPLUS_PARALLELENERGYPLUS_HPP
 #define RUNMANAGER_LIB_PARALLELENERGYPLUS_PARALLELENERGYPLUS_HPP
 
+#include "../RunManagerAPI.hpp"
 #include "../../../utilities/core/Path.hpp"
 
 #include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
 
 #include "../../../utilities/idf/Workspace.hpp"
 #include "../../../utilities/idf/WorkspaceObject.hpp"
 
 
-class ParallelEnergyPlus {
+class RUNMANAGER_API ParallelEnergyPlus {
 
   public:
 
@@ -38,22 +40,31 @@ class ParallelEnergyPlus {
 
     void writePartition(int t_num, const openstudio::path &t_path) const;
 
+    /// Returns the largest number of partitions, at most t_maxPartitions, for which every partition
+    /// still reports at least as many days as it spends on its lead-in (t_offset) and warmup
+    /// (t_warmupDays). Beyond that point extra partitions mostly add overhead.
+    static int numberOfPartitions(int t_totalDays, int t_offset, double t_warmupDays, int t_maxPartitions);
+
+    /// Returns the number of warmup days EnergyPlus reported for the last environment in an
+    /// eplusout.eio file, if any.
+    static boost::optional<int> warmupDays(const openstudio::path &t_eio);
+
+    /// Splits [t_startDate, t_endDate] into t_numPartitions (lead-in start, end) ranges. Every partition
+    /// but the first also simulates t_offset lead-in days, so the first partition is given that many
+    /// more reported days to keep the number of simulated days, and so the run time, even.
+    static std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > createPartitions(
+        const boost::gregorian::date &t_startDate, const boost::gregorian::date &t_endDate,
+        int t_offset, int t_numPartitions);
+
   private:
     REGISTER_LOGGER("openstudio.runmanager.ParallelEnergyPlus");
 
     static std::pair<openstudio::Workspace, openstudio::WorkspaceObject> getRunPeriod(const openstudio::path &t_path);
     static void getRunPeriod(const openstudio::WorkspaceObject &t_runPeriod, boost::gregorian::date &, boost::gregorian::date &);
 
-    static void computeLinearCombination(int &A, int &B, int &X,
-        int &Y, double &t_averageDays, const double daysPerPeriod, const double totalDays, const int t_numPartitions);
-
     static std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > createPartitions(const openstudio::WorkspaceObject &t_runPeriod, 
         int t_offset, int t_numPartitions);
 
-    static void createPartitions(boost::gregorian::date &d1, const boost::gregorian::date &ed,
-        const int A, const int startVal, const int endVal, const int t_offset, const boost::gregorian::date &t_startDate, 
-        std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > &t_partitions);
-
     void modifyIdf(std::string &);
 
 
@@ -50,57 +50,90 @@ static int rowCount(void *r, int argc, char **argv, char **azColName) {
 
 
 SqliteMerge::SqliteMerge()
-  : m_final("final")  //name of final database
+  : m_db(nullptr), m_appended(false), m_final("final")  //name of final database
 {
 }
 
 SqliteMerge::~SqliteMerge()
 {
-
+  if (m_db)
+  {
+    closeDatabase(m_db);
+  }
 }
 
 
 void SqliteMerge::mergeFiles()
 {
+  if (m_files.empty())
+  {
+    return;
+  }
+
+  start(m_files[0]);
 
-  // If there is only one file, we are done.
-  if (m_files.size() == 1)
+  for (size_t i = 1; i < m_files.size(); ++i)
   {
-    sqlite3 *main_db = openDatabase(m_files[0]);
-    createABUPS(main_db);
-    closeDatabase(main_db);
-    renameFinalDatabase( m_files[0]);
-  } else {
-    // Otherwise, there are more files..
-    sqlite3 *main_db = openDatabase(m_files[0]);
+    append(m_files[i]);
+  }
 
-    //summary(main_db);
-    //m_primaryKeyBase = sqlite3_last_insert_rowid(main_db);  
-    //std::sort(m_files.begin(),m_files.end()); 
+  finish();
+  renameFinalDatabase( m_files[0]);
+}
 
-    for (size_t i = 1; i < m_files.size(); ++i)
-    {
-      //m_primaryKeyBase = i*1000;
-      //m_primaryKeyBase = sqlite3_last_insert_rowid(main_db);  
-      mergeDatabases(main_db,m_files[i]);
-    }
+void SqliteMerge::start(const openstudio::path &t_base)
+{
+  if (m_db)
+  {
+    throw std::runtime_error("SqliteMerge already started");
+  }
+
+  m_db = openDatabase(t_base);
+  m_appended = false;
+
+  // the merged file is rebuilt from scratch on failure, so there is no need to sync every commit
+  executeCommand(m_db, "PRAGMA synchronous = OFF");
+
+  // keeping indexes up to date while bulk appending is slower than rebuilding them once at the end
+  m_deferredIndexes = dropIndexes(m_db);
+}
+
+void SqliteMerge::append(const openstudio::path &t_partition)
+{
+  if (!m_db)
+  {
+    throw std::runtime_error("SqliteMerge::append called before start");
+  }
 
-    //summary(main_db);
+  mergeDatabases(m_db, t_partition);
+  m_appended = true;
+}
+
+void SqliteMerge::finish()
+{
+  if (!m_db)
+  {
+    throw std::runtime_error("SqliteMerge::finish called before start");
+  }
 
-    //printMeterData(main_db);
-    //CreateView 
-    //CreateView(main_db);  //for testing purposes
-    // create ABUPS table in main database 
-    //
-    begin(main_db); 
+  begin(m_db);
 
+  for (const auto &index : m_deferredIndexes)
+  {
+    executeCommand(m_db, index);
+  }
+  m_deferredIndexes.clear();
+
+  if (m_appended)
+  {
     //meaningless is the tabular data now
-    dropTabularData(main_db);
-    createABUPS(main_db); 
-    commit(main_db); 
-    closeDatabase(main_db);
-    renameFinalDatabase( m_files[0]);
+    dropTabularData(m_db);
   }
+
+  createABUPS(m_db);
+  commit(m_db);
+  closeDatabase(m_db);
+  m_db = nullptr;
 }
 
 void SqliteMerge::dropTabularData(sqlite3 *db)
@@ -603,6 +636,31 @@ void SqliteMerge::detachDatabases(sqlite3 *destination)
   executeCommand(destination, "detach database merger");
 }
 
+std::vector<std::string> SqliteMerge::dropIndexes(sqlite3 *db)
+{
+  std::vector<std::string> indexes;
+  std::vector<std::string> names;
+
+  // sql is NULL for the automatic indexes backing primary keys and unique constraints
+  sqlite3_stmt *stmt = nullptr;
+  if (sqlite3_prepare_v2(db, "SELECT name, sql FROM sqlite_master WHERE type = 'index' AND sql IS NOT NULL", -1, &stmt, nullptr) == SQLITE_OK)
+  {
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+      names.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+      indexes.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1)));
+    }
+  }
+  sqlite3_finalize(stmt);
+
+  for (const auto &name : names)
+  {
+    executeCommand(db, "DROP INDEX \"" + name + "\"");
+  }
+
+  return indexes;
+}
+
 bool SqliteMerge::executeCommand(sqlite3 *destination, const std::string &cmd)
 {
   char *zErrMsg = nullptr;
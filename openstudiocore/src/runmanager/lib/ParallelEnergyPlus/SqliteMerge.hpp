@@ -21,6 +21,7 @@
 #define RUNMANAGER_LIB_PARALLELENERGYPLUS_SQLITEMERGE_HPP
 
 #include <iostream>
+#include <string>
 #include <vector>
 #include "../../../utilities/core/Path.hpp"
 
@@ -36,10 +37,23 @@ class SqliteMerge {
     void mergeFiles();
     void loadFile(const openstudio::path &);
 
+    /// Opens t_base as the database to merge into. Index maintenance is deferred until finish().
+    void start(const openstudio::path &t_base);
+
+    /// Appends the next partition database, in run period order, to the database passed to start().
+    void append(const openstudio::path &t_partition);
+
+    /// Recreates deferred indexes, builds the ABUPS tables and closes the merged database.
+    void finish();
+
   private:
     void renameFinalDatabase(const openstudio::path &);
     std::vector<openstudio::path> m_files;
 
+    sqlite3 *m_db;
+    bool m_appended;
+    std::vector<std::string> m_deferredIndexes;
+
     openstudio::path m_working;
     std::string m_final;
 
@@ -50,6 +64,7 @@ class SqliteMerge {
     static void attachDatabases(sqlite3 *, const openstudio::path &source);
     static void detachDatabases(sqlite3 *);
     static bool executeCommand(sqlite3 *, const std::string &);
+    static std::vector<std::string> dropIndexes(sqlite3 *);
 
     static bool commit(sqlite3 *);
     static bool begin(sqlite3 *);
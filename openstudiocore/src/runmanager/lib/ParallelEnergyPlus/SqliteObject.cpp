@@ -420,6 +420,29 @@ boost::gregorian::date SqliteObject::getStartDay()
 }
 
 
+int SqliteObject::getNumberOfDays()
+{
+  const std::string runPeriodDays = "select month, day from time where month is not null and day is not null "
+    "and daytype not in ('WinterDesignDay', 'SummerDesignDay', 'customday1', 'customday2') ";
+
+  execute(runPeriodDays + "order by month, day limit 1");
+  if (m_results->data.size() != 1)
+  {
+    return 0;
+  }
+  boost::gregorian::date first(2010, atoi(m_results->data[0][0].c_str()), atoi(m_results->data[0][1].c_str()));
+
+  execute(runPeriodDays + "order by month desc, day desc limit 1");
+  if (m_results->data.size() != 1)
+  {
+    return 0;
+  }
+  boost::gregorian::date last(2010, atoi(m_results->data[0][0].c_str()), atoi(m_results->data[0][1].c_str()));
+
+  return (last - first).days() + 1;
+}
+
+
 bool SqliteObject::deleteDay(const boost::gregorian::date &d) 
 {
 
@@ -65,6 +65,9 @@ class SqliteObject {
     void extract_total();
     boost::gregorian::date getStartDay();
 
+    /// Number of days from the first to the last reported day, design days excluded. 0 if there are none.
+    int getNumberOfDays();
+
 
   private:
     sqlite3 *m_db;
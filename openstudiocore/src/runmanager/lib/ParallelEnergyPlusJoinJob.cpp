@@ -21,6 +21,7 @@
 #include <sstream>
 #include <iterator>
 #include <algorithm>
+#include <future>
 
 #include "ParallelEnergyPlusJoinJob.hpp"
 #include "FileInfo.hpp"
@@ -36,9 +37,11 @@
 #include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/sql/SqlFile.hpp"
+#include "../../utilities/core/System.hpp"
 
 #include <sqlite/sqlite3.h>
 
+#include "ParallelEnergyPlus/ParallelEnergyPlus.hpp"
 #include "ParallelEnergyPlus/SqliteMerge.hpp"
 #include "ParallelEnergyPlus/SqliteObject.hpp"
 
@@ -135,43 +138,45 @@ namespace detail {
 
 
 
-      // clean up generated sql files, removing duplicated data
+      // Clean up the generated sql files, removing duplicated lead-in data, concurrently. Each
+      // partition is merged as soon as its cleanup is done, so merging overlaps with the cleanup
+      // of later partitions.
+      std::vector<std::future<void> > cleanups;
       for (size_t i = 1; i < eplussqlfiles.size(); ++i)
       {
-        SqliteObject sql(eplussqlfiles[i].fullPath);
-
-        boost::gregorian::date tmp_date(sql.getStartDay());
-        boost::gregorian::date start_date(tmp_date);
-
-        // BLB  remove the design days from the slaves in case they are still there.
-        sql.removeDesignDay();
-        start_date += boost::gregorian::date_duration(m_offset);
-          
-        while (tmp_date < start_date)
-        {
-          sql.deleteDay(tmp_date);  //BLBtest
-          //std::cout << boost::gregorian::to_simple_string(tmp_date) << std::endl;
-          tmp_date = tmp_date + boost::gregorian::date_duration(1);
-        }
+        cleanups.push_back(std::async(std::launch::async, &ParallelEnergyPlusJoinJob::removeLeadInDays, eplussqlfiles[i].fullPath, m_offset));
       }
 
-
       SqliteMerge merge;
       LOG(Info, "Copying 0th file into place: " << openstudio::toString(eplussqlfiles[0].fullPath) << " to " << openstudio::toString(outFile));
       boost::filesystem::remove(outFile);
       boost::filesystem::copy_file(eplussqlfiles[0].fullPath, outFile, boost::filesystem::copy_option::overwrite_if_exists);
 
       LOG(Info, "Merging base, 0th file: " << openstudio::toString(outFile));
-      merge.loadFile(outFile);
+      merge.start(outFile);
 
-      // clean up generated sql files, removing duplicated data
       for (size_t i = 1; i < eplussqlfiles.size(); ++i)
       {
+        // rethrows any cleanup error
+        cleanups[i - 1].get();
         LOG(Info, "Merging " << i << "th file: " << openstudio::toString(eplussqlfiles[i].fullPath));
-        merge.loadFile(eplussqlfiles[i].fullPath);
+        merge.append(eplussqlfiles[i].fullPath);
       }
 
-      merge.mergeFiles();
+      merge.finish();
+
+      int totalDays = SqliteObject(outFile).getNumberOfDays();
+      for (size_t i = 1; totalDays > 0 && i < eplussqlfiles.size(); ++i)
+      {
+        openstudio::path eio = eplussqlfiles[i].fullPath.parent_path() / toPath("eplusout.eio");
+        if (boost::optional<int> warmupDays = ParallelEnergyPlus::warmupDays(eio))
+        {
+          LOG(Info, "Partition " << i << " used " << *warmupDays << " warmup days; "
+              << ParallelEnergyPlus::numberOfPartitions(totalDays, m_offset, *warmupDays, System::numberOfProcessors())
+              << " splits are recommended for a " << totalDays << " day run of this model on this machine");
+          break;
+        }
+      }
 
       // emit the file changed
       emitOutputFileChanged(RunManager_Util::dirFile(outFile));
@@ -183,6 +188,24 @@ namespace detail {
     setErrors(errors);
   }
 
+  void ParallelEnergyPlusJoinJob::removeLeadInDays(const openstudio::path &t_sqlFile, int t_offset)
+  {
+    SqliteObject sql(t_sqlFile);
+
+    boost::gregorian::date tmp_date(sql.getStartDay());
+    boost::gregorian::date start_date(tmp_date);
+
+    // BLB  remove the design days from the slaves in case they are still there.
+    sql.removeDesignDay();
+    start_date += boost::gregorian::date_duration(t_offset);
+
+    while (tmp_date < start_date)
+    {
+      sql.deleteDay(tmp_date);  //BLBtest
+      tmp_date = tmp_date + boost::gregorian::date_duration(1);
+    }
+  }
+
   std::string ParallelEnergyPlusJoinJob::getOutput() const
   {
     return "";
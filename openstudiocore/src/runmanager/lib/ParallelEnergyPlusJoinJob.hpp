@@ -72,6 +72,9 @@ namespace detail {
 
       FileInfo inputFile() const;
 
+      /// Removes the design days and the t_offset lead-in days from a partition's sql file
+      static void removeLeadInDays(const openstudio::path &t_sqlFile, int t_offset);
+
       mutable QReadWriteLock m_mutex;
 
       int m_numSplits; //< Number of splits to expect to join
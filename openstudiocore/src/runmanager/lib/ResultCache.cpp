@@ -0,0 +1,435 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include "ResultCache.hpp"
+#include "RunManager_Util.hpp"
+
+#include "../../utilities/core/Checksum.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
+#include "../../utilities/core/UUID.hpp"
+
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutex>
+#include <QMutexLocker>
+
+#include <boost/algorithm/string/replace.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <map>
+#include <set>
+#include <sstream>
+
+namespace openstudio {
+namespace runmanager {
+
+  namespace {
+    // Jobs run on several threads at once. Function local statics are not initialized
+    // thread safely by Visual Studio 2013, so these are built during static initialization.
+
+    // tools whose outputs depend only on their binary, parameters and required files
+    const std::set<std::string> cacheableTools = {"energyplus", "expandobjects", "readvars", "basement", "slab"};
+
+    // checksums of tool binaries and data files, recomputed if the file is modified
+    QMutex toolFileChecksumsMutex;
+    std::map<openstudio::path, std::pair<std::pair<std::time_t, boost::uintmax_t>, std::string> > toolFileChecksums;
+
+    bool cacheableTool(const std::string &t_name)
+    {
+      return cacheableTools.count(t_name) != 0;
+    }
+
+    std::string toolFileChecksum(const openstudio::path &t_file)
+    {
+      std::pair<std::time_t, boost::uintmax_t> stamp(boost::filesystem::last_write_time(t_file), boost::filesystem::file_size(t_file));
+
+      QMutexLocker l(&toolFileChecksumsMutex);
+      auto itr = toolFileChecksums.find(t_file);
+      if (itr == toolFileChecksums.end() || itr->second.first != stamp)
+      {
+        l.unlock();
+        std::string result = openstudio::checksum(t_file);
+        l.relock();
+        itr = toolFileChecksums.insert(std::make_pair(t_file, std::make_pair(stamp, result))).first;
+        itr->second = std::make_pair(stamp, result);
+      }
+
+      return itr->second.second;
+    }
+
+    std::string readFile(const openstudio::path &t_path)
+    {
+      boost::filesystem::ifstream ifs(t_path, std::ios_base::in | std::ios_base::binary);
+      std::stringstream ss;
+      ss << ifs.rdbuf();
+      return ss.str();
+    }
+
+    void writeFile(const openstudio::path &t_path, const std::string &t_contents)
+    {
+      boost::filesystem::ofstream ofs(t_path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+      ofs << t_contents;
+    }
+  }
+
+  ResultCache::ResultCache(const openstudio::path &t_location)
+    : m_location(boost::filesystem::complete(t_location))
+  {
+    boost::filesystem::create_directories(m_location);
+  }
+
+  openstudio::path ResultCache::location() const
+  {
+    return m_location;
+  }
+
+  std::string ResultCache::manifest(const ToolInfo &t_tool,
+      const std::vector<std::pair<openstudio::path, openstudio::path> > &t_requiredFiles,
+      const std::vector<std::string> &t_parameters,
+      const openstudio::path &t_outdir,
+      const std::vector<openstudio::path> &t_expectedOutputFiles,
+      const std::string &t_stdin,
+      const openstudio::path &t_basePath)
+  {
+    if (!cacheableTool(t_tool.name))
+    {
+      return std::string();
+    }
+
+    try {
+      std::stringstream ss;
+
+      ss << "tool " << t_tool.name << "\n";
+      ss << "version " << t_tool.version.toString() << "\n";
+
+      if (!boost::filesystem::is_regular_file(t_tool.localBinPath))
+      {
+        return std::string();
+      }
+      ss << "binary " << toString(t_tool.localBinPath.filename()) << " " << toolFileChecksum(t_tool.localBinPath) << "\n";
+
+      // the tool may read data files installed next to it, such as Energy+.idd, and shared libraries there
+      // change its behavior as much as the binary does
+      std::set<openstudio::path> toolFiles;
+      for (boost::filesystem::directory_iterator itr(t_tool.localBinPath.parent_path()), end; itr != end; ++itr)
+      {
+        if (boost::filesystem::is_regular_file(itr->status()) && itr->path() != t_tool.localBinPath)
+        {
+          toolFiles.insert(itr->path());
+        }
+      }
+
+      for (const auto & toolFile : toolFiles)
+      {
+        ss << "toolfile " << toString(toolFile.filename()) << " " << toolFileChecksum(toolFile) << "\n";
+      }
+
+      // parameters may name files in the output directory, which differs for every job
+      const std::string outdir = toString(t_outdir);
+      for (const auto & parameter : t_parameters)
+      {
+        ss << "parameter " << boost::algorithm::replace_all_copy(parameter, outdir, "$outdir") << "\n";
+      }
+
+      ss << "stdin " << openstudio::checksum(t_stdin) << " " << t_stdin.size() << "\n";
+
+      for (const auto & requiredFile : t_requiredFiles)
+      {
+        // relative required files are resolved the same way as LocalProcess does
+        openstudio::path from = requiredFile.first;
+        if (!from.has_root_path())
+        {
+          openstudio::path baserelative = t_basePath / from;
+          if (boost::filesystem::exists(baserelative))
+          {
+            from = baserelative;
+          } else {
+            from = t_tool.localBinPath.parent_path() / from;
+          }
+        }
+
+        if (!boost::filesystem::is_regular_file(from))
+        {
+          return std::string();
+        }
+
+        openstudio::path to = requiredFile.second;
+        if (to.has_root_path())
+        {
+          to = openstudio::relativePath(to, t_outdir);
+        }
+
+        ss << "required " << toString(to) << " " << openstudio::checksum(from) << " " << boost::filesystem::file_size(from) << "\n";
+      }
+
+      for (const auto & expectedOutputFile : t_expectedOutputFiles)
+      {
+        openstudio::path expected = expectedOutputFile;
+        if (expected.has_root_path())
+        {
+          expected = openstudio::relativePath(expected, t_outdir);
+        }
+        ss << "expected " << toString(expected) << "\n";
+      }
+
+      return ss.str();
+    } catch (const std::exception &e) {
+      LOG(Debug, "Unable to build result cache manifest for " << t_tool.name << ": " << e.what());
+      return std::string();
+    }
+  }
+
+  ResultCache::DirectorySnapshot ResultCache::snapshot(const openstudio::path &t_dir)
+  {
+    DirectorySnapshot result;
+
+    boost::system::error_code ec;
+    if (!boost::filesystem::is_directory(t_dir, ec))
+    {
+      return result;
+    }
+
+    for (boost::filesystem::recursive_directory_iterator itr(t_dir, ec), end; !ec && itr != end; itr.increment(ec))
+    {
+      if (boost::filesystem::is_regular_file(itr->status()))
+      {
+        std::time_t modified = boost::filesystem::last_write_time(itr->path(), ec);
+        boost::uintmax_t size = boost::filesystem::file_size(itr->path(), ec);
+        if (!ec)
+        {
+          result[openstudio::relativePath(itr->path(), t_dir)] = std::make_pair(modified, size);
+        }
+        ec.clear();
+      }
+    }
+
+    return result;
+  }
+
+  std::vector<openstudio::path> ResultCache::changedFiles(const DirectorySnapshot &t_before, const DirectorySnapshot &t_after)
+  {
+    std::vector<openstudio::path> result;
+
+    for (const auto & file : t_after)
+    {
+      auto itr = t_before.find(file.first);
+      if (itr == t_before.end() || itr->second != file.second)
+      {
+        result.push_back(file.first);
+      }
+    }
+
+    return result;
+  }
+
+  openstudio::path ResultCache::entryPath(const std::string &t_manifest) const
+  {
+    return m_location / toPath(openstudio::checksum(t_manifest));
+  }
+
+  boost::optional<CachedResult> ResultCache::restore(const std::string &t_manifest, const openstudio::path &t_outdir) const
+  {
+    if (t_manifest.empty())
+    {
+      return boost::none;
+    }
+
+    openstudio::path entry = entryPath(t_manifest);
+
+    try {
+      if (!boost::filesystem::is_directory(entry) || readFile(entry / toPath("manifest")) != t_manifest)
+      {
+        return boost::none;
+      }
+
+      CachedResult result;
+      result.standardOut = readFile(entry / toPath("stdout"));
+      result.standardErr = readFile(entry / toPath("stderr"));
+
+      openstudio::path files = entry / toPath("files");
+      for (boost::filesystem::recursive_directory_iterator itr(files), end; itr != end; ++itr)
+      {
+        if (!boost::filesystem::is_regular_file(itr->status()))
+        {
+          continue;
+        }
+
+        openstudio::path relative = openstudio::relativePath(itr->path(), files);
+        openstudio::path to = t_outdir / relative;
+        boost::filesystem::create_directories(to.parent_path());
+        boost::filesystem::copy_file(itr->path(), to, boost::filesystem::copy_option::overwrite_if_exists);
+        result.files.push_back(relative);
+      }
+
+      LOG(Info, "Restored " << result.files.size() << " cached output files from " << toString(entry) << " to " << toString(t_outdir));
+      return result;
+    } catch (const std::exception &e) {
+      LOG(Warn, "Unable to restore cached result " << toString(entry) << ": " << e.what());
+      return boost::none;
+    }
+  }
+
+  bool ResultCache::store(const std::string &t_manifest, const openstudio::path &t_outdir, const std::vector<openstudio::path> &t_files,
+      const std::string &t_standardOut, const std::string &t_standardErr) const
+  {
+    if (t_manifest.empty())
+    {
+      return false;
+    }
+
+    openstudio::path entry = entryPath(t_manifest);
+    if (boost::filesystem::is_directory(entry))
+    {
+      return true;
+    }
+
+    // build the entry beside its final location and rename it into place, so concurrent
+    // readers and writers never see a partial entry
+    openstudio::path temp = m_location / toPath(".tmp-" + openstudio::removeBraces(openstudio::createUUID()));
+
+    try {
+      boost::filesystem::create_directories(temp / toPath("files"));
+
+      for (const auto & file : t_files)
+      {
+        openstudio::path to = temp / toPath("files") / file;
+        boost::filesystem::create_directories(to.parent_path());
+        boost::filesystem::copy_file(t_outdir / file, to, boost::filesystem::copy_option::overwrite_if_exists);
+      }
+
+      writeFile(temp / toPath("stdout"), t_standardOut);
+      writeFile(temp / toPath("stderr"), t_standardErr);
+
+      // written last, an entry without a matching manifest is never restored
+      writeFile(temp / toPath("manifest"), t_manifest);
+
+      boost::filesystem::rename(temp, entry);
+      LOG(Info, "Stored " << t_files.size() << " output files from " << toString(t_outdir) << " in result cache " << toString(entry));
+    } catch (const std::exception &e) {
+      // most likely another process stored the same entry first
+      LOG(Debug, "Unable to store result cache entry " << toString(entry) << ": " << e.what());
+      boost::system::error_code ec;
+      boost::filesystem::remove_all(temp, ec);
+    }
+
+    return boost::filesystem::is_directory(entry);
+  }
+
+namespace detail {
+
+  CachedProcess::CachedProcess(const CachedResult &t_result,
+      const std::vector<std::pair<openstudio::path, openstudio::path> > &t_requiredFiles,
+      const openstudio::path &t_outdir)
+    : m_result(t_result), m_requiredFiles(t_requiredFiles), m_outdir(t_outdir), m_running(false)
+  {
+  }
+
+  void CachedProcess::start()
+  {
+    m_running = true;
+    emitStatusChanged(AdvancedStatus(AdvancedStatusEnum::Starting));
+
+    // the job is not yet in its event loop, signals are sent once it is
+    QMetaObject::invokeMethod(this, "replay", Qt::QueuedConnection);
+  }
+
+  void CachedProcess::replay()
+  {
+    emit started();
+    emitStatusChanged(AdvancedStatus(AdvancedStatusEnum::Processing));
+
+    for (const auto & file : m_result.files)
+    {
+      emitOutputFileChanged(RunManager_Util::dirFile(m_outdir / file));
+    }
+
+    if (!m_result.standardOut.empty())
+    {
+      emit standardOutDataAdded(m_result.standardOut);
+    }
+
+    if (!m_result.standardErr.empty())
+    {
+      emit standardErrDataAdded(m_result.standardErr);
+    }
+
+    emitStatusChanged(AdvancedStatus(AdvancedStatusEnum::Finishing));
+    m_running = false;
+    emit finished(0, QProcess::NormalExit);
+    emitStatusChanged(AdvancedStatus(AdvancedStatusEnum::Idle));
+  }
+
+  bool CachedProcess::running() const
+  {
+    return m_running;
+  }
+
+  void CachedProcess::waitForFinished()
+  {
+    // nothing executes, replay happens on the owning thread's event loop
+  }
+
+  void CachedProcess::cleanup(const std::vector<std::string> &t_files)
+  {
+    for (const auto & file : t_files)
+    {
+      QString path = toQString(m_outdir / toPath(file));
+      QFile::remove(path);
+      emitOutputFileChanged(RunManager_Util::dirFile(QFileInfo(path)));
+    }
+  }
+
+  std::vector<FileInfo> CachedProcess::outputFiles() const
+  {
+    std::vector<FileInfo> ret;
+
+    for (const auto & file : m_result.files)
+    {
+      ret.push_back(RunManager_Util::dirFile(m_outdir / file));
+    }
+
+    return ret;
+  }
+
+  std::vector<FileInfo> CachedProcess::inputFiles() const
+  {
+    std::vector<FileInfo> ret;
+
+    for (const auto & requiredFile : m_requiredFiles)
+    {
+      ret.push_back(RunManager_Util::dirFile(QFileInfo(toQString(requiredFile.second))));
+    }
+
+    return ret;
+  }
+
+  void CachedProcess::stopImpl()
+  {
+  }
+
+  void CachedProcess::cleanUpRequiredFiles()
+  {
+  }
+
+} // detail
+
+}
+}
@@ -0,0 +1,158 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#ifndef RUNMANAGER_LIB_RESULTCACHE_HPP
+#define RUNMANAGER_LIB_RESULTCACHE_HPP
+
+#include "RunManagerAPI.hpp"
+#include "Process.hpp"
+#include "ToolInfo.hpp"
+
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/Path.hpp"
+
+#include <boost/cstdint.hpp>
+#include <boost/optional.hpp>
+
+#include <ctime>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace runmanager {
+
+  /// Outputs of a tool execution restored from a ResultCache
+  struct RUNMANAGER_API CachedResult
+  {
+    /// Files restored into the output directory, relative to the output directory
+    std::vector<openstudio::path> files;
+
+    /// Standard output of the original execution
+    std::string standardOut;
+
+    /// Standard error of the original execution
+    std::string standardErr;
+  };
+
+  /// Content addressed store of tool outputs on disk.
+  ///
+  /// Each entry is keyed by a manifest describing everything a tool execution depends on: the tool name,
+  /// version and a checksum of its binary and of the data files installed next to it (such as Energy+.idd
+  /// next to EnergyPlus), the parameters, the checksum and size of each required input
+  /// file and the expected output files. Entries are stored in a directory named by the checksum of the
+  /// manifest, and the full manifest is compared on lookup so checksum collisions can never return
+  /// the outputs of a different execution.
+  class RUNMANAGER_API ResultCache
+  {
+    public:
+      /// Modification time and size of each regular file under a directory, keyed by path relative to it
+      typedef std::map<openstudio::path, std::pair<std::time_t, boost::uintmax_t> > DirectorySnapshot;
+
+      /// \param[in] t_location Directory the cache is stored in, created if it does not exist
+      explicit ResultCache(const openstudio::path &t_location);
+
+      /// \returns the directory the cache is stored in
+      openstudio::path location() const;
+
+      /// \returns the manifest describing a tool execution with the given inputs, or an empty string
+      ///          if the execution cannot be cached, either because an input cannot be read or because
+      ///          the tool may read inputs that are not listed as required files
+      static std::string manifest(const ToolInfo &t_tool,
+          const std::vector<std::pair<openstudio::path, openstudio::path> > &t_requiredFiles,
+          const std::vector<std::string> &t_parameters,
+          const openstudio::path &t_outdir,
+          const std::vector<openstudio::path> &t_expectedOutputFiles,
+          const std::string &t_stdin,
+          const openstudio::path &t_basePath);
+
+      /// Copies the stored outputs for t_manifest into t_outdir
+      /// \returns the restored result, or boost::none if there is no entry for t_manifest
+      boost::optional<CachedResult> restore(const std::string &t_manifest, const openstudio::path &t_outdir) const;
+
+      /// Stores outputs for t_manifest, an existing entry is left in place
+      /// \param[in] t_files output files, relative to t_outdir
+      /// \returns true if the entry exists after the call
+      bool store(const std::string &t_manifest, const openstudio::path &t_outdir, const std::vector<openstudio::path> &t_files,
+          const std::string &t_standardOut, const std::string &t_standardErr) const;
+
+      /// \returns a snapshot of the regular files under t_dir, empty if t_dir does not exist
+      static DirectorySnapshot snapshot(const openstudio::path &t_dir);
+
+      /// \returns the files of t_after that are not in t_before or whose modification time or size differ,
+      ///          which are the files written between the two snapshots
+      static std::vector<openstudio::path> changedFiles(const DirectorySnapshot &t_before, const DirectorySnapshot &t_after);
+
+    private:
+      REGISTER_LOGGER("openstudio.runmanager.ResultCache");
+
+      openstudio::path entryPath(const std::string &t_manifest) const;
+
+      openstudio::path m_location;
+  };
+
+namespace detail {
+
+  /// Process that replays a result restored from a ResultCache instead of executing the tool
+  class CachedProcess : public Process
+  {
+    Q_OBJECT;
+
+    public:
+      /// \param[in] t_result result already restored into t_outdir
+      /// \param[in] t_requiredFiles The vector of files the tool would have needed
+      /// \param[in] t_outdir Output directory of the tool
+      CachedProcess(const CachedResult &t_result,
+          const std::vector<std::pair<openstudio::path, openstudio::path> > &t_requiredFiles,
+          const openstudio::path &t_outdir);
+
+      virtual ~CachedProcess() {}
+
+      virtual void start();
+      virtual bool running() const;
+      virtual void waitForFinished();
+      virtual void cleanup(const std::vector<std::string> &t_files);
+      virtual std::vector<FileInfo> outputFiles() const;
+      virtual std::vector<FileInfo> inputFiles() const;
+
+    protected:
+      virtual void stopImpl();
+      virtual void cleanUpRequiredFiles();
+
+    private slots:
+      /// Emits the signals a LocalProcess would have emitted, called from the event loop after start()
+      void replay();
+
+    private:
+      REGISTER_LOGGER("openstudio.runmanager.CachedProcess");
+
+      const CachedResult m_result;
+      const std::vector<std::pair<openstudio::path, openstudio::path> > m_requiredFiles;
+      const openstudio::path m_outdir;
+
+      bool m_running;
+  };
+
+} // detail
+
+}
+}
+
+#endif // RUNMANAGER_LIB_RESULTCACHE_HPP
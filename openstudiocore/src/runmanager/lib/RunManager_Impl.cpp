@@ -1318,6 +1318,25 @@ namespace detail {
         }
 
         co.setSimpleName(db_co.simpleName);
+        co.setMaxLocalMemory(db_co.maxLocalMemory);
+
+        std::string resultCacheLocation = db_co.resultCacheLocation;
+        boost::trim(resultCacheLocation);
+        if (!resultCacheLocation.empty())
+        {
+          co.setResultCacheLocation(toPath(resultCacheLocation));
+        }
+
+        std::vector<RunManagerDB::JobResourceEstimate> estimates = litesql::select<RunManagerDB::JobResourceEstimate>(t_db).all();
+
+        for (const auto & estimate : estimates)
+        {
+          try {
+            co.setJobResources(JobType(estimate.jobType.value()), JobResources(estimate.cores, estimate.memory));
+          } catch (const std::exception &e) {
+            LOG(Error, "Error loading job resource estimate for " << estimate.jobType.value() << ": " << e.what());
+          }
+        }
 
         std::vector<RunManagerDB::ToolLocations> vers = litesql::select<RunManagerDB::ToolLocations>(t_db).all();
 
@@ -1386,6 +1405,25 @@ namespace detail {
         db_co.simpleName = t_co.getSimpleName();
 
         db_co.maxLocalJobs = t_co.getMaxLocalJobs();
+        db_co.maxLocalMemory = static_cast<float>(t_co.getMaxLocalMemory());
+        db_co.resultCacheLocation = toString(t_co.getResultCacheLocation());
+
+        std::vector<RunManagerDB::JobResourceEstimate> dbestimates = litesql::select<RunManagerDB::JobResourceEstimate>(t_db).all();
+        for (auto & estimate : dbestimates)
+        {
+          estimate.del();
+        }
+
+        std::vector<std::pair<JobType, JobResources> > estimates = t_co.getJobResourceOverrides();
+
+        for (const auto & jobResources : estimates)
+        {
+          RunManagerDB::JobResourceEstimate e(t_db);
+          e.jobType = jobResources.first.valueName();
+          e.cores = jobResources.second.cores;
+          e.memory = static_cast<float>(jobResources.second.memory);
+          e.update();
+        }
 
         db_co.update();
       }
@@ -1434,6 +1472,7 @@ namespace detail {
 
   RunManager_Impl::RunManager_Impl(const openstudio::path &DB, bool t_paused, bool t_initui, bool t_temporaryDB, bool t_useStatusGUI)
     : m_useStatusGUI(t_useStatusGUI && t_initui),
+      m_dispatchRequested(false),
       m_dbholder(new DBHolder(DB)),
       m_dbfile(DB),
       m_processingQueue(false),
@@ -1454,6 +1493,7 @@ namespace detail {
 
     LOG(Info, "Loading config options");
     ConfigOptions co = m_dbholder->getConfigOptions();
+    m_localProcessCreator->setResultCacheLocation(co.getResultCacheLocation());
 
     m_dbholder->fixupData();
 
@@ -1477,10 +1517,6 @@ namespace detail {
     LOG(Info, "Starting Runmanager");
     start();
 
-    connect(&m_timer, &QTimer::timeout, this, &RunManager_Impl::processQueue);
-    m_timer.start(1000);
-
-
     processQueue();
     LOG(Info, "Runmanager Started");
   }
@@ -2108,6 +2144,10 @@ namespace detail {
             SLOT(treeStateChanged(const openstudio::UUID &)), Qt::QueuedConnection);
       }
 
+      // wake the dispatcher from whichever thread the job changes on, without waiting for the event loop
+      job.connect(SIGNAL(stateChanged(const openstudio::UUID &)), this, SLOT(processQueue()), Qt::DirectConnection);
+      job.connect(SIGNAL(finished(const openstudio::UUID &, const openstudio::runmanager::JobErrors &)), this, SLOT(processQueue()), Qt::DirectConnection);
+
       job.connect(SIGNAL(finishedExt(const openstudio::UUID &, const openstudio::runmanager::JobErrors &, const openstudio::DateTime &, const std::vector<openstudio::runmanager::FileInfo> &)), this,
           SLOT(jobFinished(const openstudio::UUID &, const openstudio::runmanager::JobErrors &, const openstudio::DateTime &, const std::vector<openstudio::runmanager::FileInfo> &)), Qt::QueuedConnection);
     }
@@ -2459,6 +2499,7 @@ namespace detail {
   {
     QMutexLocker lock(&m_mutex);
     m_dbholder->setConfigOptions(co);
+    m_localProcessCreator->setResultCacheLocation(co.getResultCacheLocation());
   }
 
   void RunManager_Impl::showConfigGui(QWidget *parent)
@@ -2513,13 +2554,43 @@ namespace detail {
 
   void RunManager_Impl::processQueue()
   {
-    QMutexLocker lock(&m_mutex);
-    const ConfigOptions config = getConfigOptions();
-    //bool paused = m_paused;
-
+    QMutexLocker lock(&m_dispatchMutex);
+    m_dispatchRequested = true;
     m_waitCondition.wakeAll();
   }
 
+  int RunManager_Impl::dispatchJobs(std::deque<openstudio::runmanager::Job> &t_queue, const ConfigOptions &t_config)
+  {
+    std::vector<LocalJobDispatcher::Candidate> candidates;
+    int runningLocally = 0;
+
+    for (const auto & job : t_queue)
+    {
+      bool running = job.running();
+      if (running)
+      {
+        ++runningLocally;
+      }
+      candidates.push_back(LocalJobDispatcher::Candidate(job.uuid(), t_config.getJobResources(job.jobType()), running, job.runnable()));
+    }
+
+    std::vector<openstudio::UUID> toStart = m_localJobDispatcher.selectJobsToStart(candidates,
+        t_config.getMaxLocalJobs(), t_config.getMaxLocalMemory(), QDateTime::currentDateTime());
+    std::set<openstudio::UUID> toStartSet(toStart.begin(), toStart.end());
+
+    for (auto & job : t_queue)
+    {
+      if (toStartSet.count(job.uuid()))
+      {
+        LOG(Info, "Starting job locally: " << toString(job.uuid()) << " " << job.description() );
+        job.start(m_localProcessCreator);
+        ++runningLocally;
+      }
+    }
+
+    return runningLocally;
+  }
+
   std::map<std::string, double> RunManager_Impl::generateStatistics(const std::deque<runmanager::Job> &t_jobs)
   {
     int locallyrunningjobs = 0;
@@ -2748,14 +2819,21 @@ namespace detail {
   {
     while (getContinue())
     {
-      //openstudio::Application::instance().processEvents(1);
+      {
+        // Wait for an enqueue or job state change. A request made while the last pass was running is not lost,
+        // and the timeout keeps statistics current and lets waiting jobs age when nothing signals.
+        QMutexLocker dispatchLock(&m_dispatchMutex);
+        if (!m_dispatchRequested)
+        {
+          m_waitCondition.wait(&m_dispatchMutex, 1000);
+        }
+        m_dispatchRequested = false;
+      }
+
       QMutexLocker lock(&m_mutex);
 
-      if (m_continue) // need to check m_continue while inside of the lock
+      if (!m_continue) // need to check m_continue while inside of the lock
       {
-        // If we are to continue, we can safely wait on the condition
-        m_waitCondition.wait(&m_mutex);
-      } else {
         continue;
       }
 
@@ -2775,30 +2853,11 @@ namespace detail {
 
 
         int running = std::count_if(queue.begin(), queue.end(), std::bind(&openstudio::runmanager::Job::running, std::placeholders::_1));
-        int runningLocally = running;
-
-        auto itr = queue.begin();
-        auto end = queue.end();
-
 
         ConfigOptions config = getConfigOptions();
 
-        const int maxlocaljobs = config.getMaxLocalJobs();
-
-        // Make sure we have as many running as we should have
-        while ((runningLocally < maxlocaljobs) && itr != end)
-        {
-          boost::optional<Job> parent = itr->parent();
-
-          if (itr->runnable())
-          {
-            LOG(Info, "Starting job locally: " << toString(itr->uuid()) << " " << itr->description() );
-            itr->start(m_localProcessCreator);
-            ++runningLocally;
-          }
-
-          ++itr;
-        }
+        // Make sure we have as many running as the local resources allow
+        int runningLocally = dispatchJobs(queue, config);
 
 
         if ((running != m_lastRunning
@@ -26,12 +26,12 @@
 #include <QStandardItemModel>
 #include <QMutex>
 #include <QWaitCondition>
-#include <QTimer>
 #include <QThread>
 #include <QDateTime>
 #include "Job.hpp"
 #include "ConfigOptions.hpp"
 #include "LocalProcessCreator.hpp"
+#include "LocalJobDispatcher.hpp"
 #include "Workflow.hpp"
 #include "RunManagerStatus.hpp"
 
@@ -257,8 +257,6 @@ namespace detail {
 
       class DBHolder;
 
-      QTimer m_timer;
-
 
       /// \param t_job job to raise the priority (list order) of
       void raisePriorityInternal(const openstudio::runmanager::Job &t_job);
@@ -281,7 +279,12 @@ namespace detail {
 
       bool m_useStatusGUI;
       mutable QMutex m_mutex;
+
+      // guards m_dispatchRequested only, so processQueue can be called from job signals on any thread
+      // without risk of deadlocking with code that holds m_mutex while calling into a Job
+      QMutex m_dispatchMutex;
       QWaitCondition m_waitCondition;
+      bool m_dispatchRequested;
 
       std::shared_ptr<DBHolder> m_dbholder;
 
@@ -309,6 +312,13 @@ namespace detail {
       int m_lastRunningLocally;
       QDateTime m_lastStatistics;
 
+      /// Chooses the jobs to start locally, tracking how long jobs have waited for resources
+      LocalJobDispatcher m_localJobDispatcher;
+
+      /// Starts the runnable jobs chosen by m_localJobDispatcher
+      /// \returns the number of jobs that are running locally after dispatching
+      int dispatchJobs(std::deque<openstudio::runmanager::Job> &t_queue, const ConfigOptions &t_config);
+
 
       /// Debugging tool for printing the current queue to standard out
       void print_queue() const;
@@ -20,7 +20,9 @@
 #include <gtest/gtest.h>
 #include "RunManagerTestFixture.hpp"
 #include "../ConfigOptions.hpp"
+#include "../RunManager.hpp"
 #include <QCoreApplication>
+#include <QDir>
 
 #ifdef _WIN32
 std::ostream &operator<<(std::ostream &os, const openstudio::path &ver)
@@ -137,6 +139,8 @@ TEST_F(RunManagerTestFixture, ConfigOptionsQSettingsTest)
   co.setDefaultEPWLocation(openstudio::toPath("b"));
   co.setOutputLocation(openstudio::toPath("c"));
   co.setMaxLocalJobs(10);
+  co.setMaxLocalMemory(8000);
+  co.setJobResources(JobType::EnergyPlus, JobResources(2, 3000));
   co.setSimpleName(true);
   co.saveQSettings();
 
@@ -154,6 +158,87 @@ TEST_F(RunManagerTestFixture, ConfigOptionsQSettingsTest)
   EXPECT_EQ(co.getOutputLocation(), co2.getOutputLocation());
   EXPECT_EQ(co.getMaxLocalJobs(), co2.getMaxLocalJobs());
   EXPECT_EQ(co.getSimpleName(), co2.getSimpleName());
+  EXPECT_EQ(co.getMaxLocalMemory(), co2.getMaxLocalMemory());
+  EXPECT_TRUE(co2.getJobResources(JobType::EnergyPlus) == JobResources(2, 3000));
+  EXPECT_TRUE(co2.getJobResources(JobType::Ruby) == ConfigOptions::defaultJobResources(JobType::Ruby));
 }
 
 
+
+TEST_F(RunManagerTestFixture, ConfigOptionsJobResourcesTest)
+{
+  using namespace openstudio;
+  using namespace openstudio::runmanager;
+
+  ConfigOptions co;
+
+  EXPECT_EQ(0, co.getMaxLocalMemory());
+  co.setMaxLocalMemory(-1);
+  EXPECT_EQ(0, co.getMaxLocalMemory());
+  co.setMaxLocalMemory(4000);
+  EXPECT_EQ(4000, co.getMaxLocalMemory());
+
+  // container jobs do not take a local slot
+  EXPECT_EQ(0, co.getJobResources(JobType::Workflow).cores);
+  EXPECT_EQ(0, co.getJobResources(JobType::Null).cores);
+  EXPECT_EQ(1, co.getJobResources(JobType::EnergyPlus).cores);
+
+  EXPECT_TRUE(co.getJobResources(JobType::EnergyPlus) == ConfigOptions::defaultJobResources(JobType::EnergyPlus));
+  co.setJobResources(JobType::EnergyPlus, JobResources(2, 3000));
+  EXPECT_EQ(2, co.getJobResources(JobType::EnergyPlus).cores);
+  EXPECT_EQ(3000, co.getJobResources(JobType::EnergyPlus).memory);
+  EXPECT_TRUE(co.getJobResources(JobType::Ruby) == ConfigOptions::defaultJobResources(JobType::Ruby));
+}
+
+TEST_F(RunManagerTestFixture, ConfigOptionsJobResourcesPersistenceTest)
+{
+  using namespace openstudio;
+  using namespace openstudio::runmanager;
+
+  openstudio::path db = openstudio::toPath(QDir::tempPath()) / openstudio::toPath("ConfigOptionsJobResourcesDB");
+
+  {
+    RunManager rm(db, true, true, false, false);
+    ConfigOptions co = rm.getConfigOptions();
+    co.setMaxLocalMemory(6000);
+    co.setJobResources(JobType::EnergyPlus, JobResources(2, 3000));
+    rm.setConfigOptions(co);
+  }
+
+  RunManager rm(db, false, true, false, false);
+  ConfigOptions co = rm.getConfigOptions();
+  EXPECT_EQ(6000, co.getMaxLocalMemory());
+  EXPECT_TRUE(co.getJobResources(JobType::EnergyPlus) == JobResources(2, 3000));
+  EXPECT_TRUE(co.getJobResources(JobType::Ruby) == ConfigOptions::defaultJobResources(JobType::Ruby));
+  ASSERT_EQ(1u, co.getJobResourceOverrides().size());
+}
+
+TEST_F(RunManagerTestFixture, ConfigOptionsResultCachePersistenceTest)
+{
+  using namespace openstudio;
+  using namespace openstudio::runmanager;
+
+  openstudio::path db = openstudio::toPath(QDir::tempPath()) / openstudio::toPath("ConfigOptionsResultCacheDB");
+  openstudio::path cache = openstudio::toPath(QDir::tempPath()) / openstudio::toPath("ConfigOptionsResultCache");
+
+  {
+    RunManager rm(db, true, true, false, false);
+    ConfigOptions co = rm.getConfigOptions();
+    EXPECT_TRUE(co.getResultCacheLocation().empty());
+    co.setResultCacheLocation(cache);
+    rm.setConfigOptions(co);
+  }
+
+  {
+    RunManager rm(db, false, true, false, false);
+    EXPECT_EQ(cache, rm.getConfigOptions().getResultCacheLocation());
+
+    // and the cache can be turned off again
+    ConfigOptions co = rm.getConfigOptions();
+    co.setResultCacheLocation(openstudio::path());
+    rm.setConfigOptions(co);
+  }
+
+  RunManager rm(db, false, true, false, false);
+  EXPECT_TRUE(rm.getConfigOptions().getResultCacheLocation().empty());
+}
@@ -0,0 +1,128 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "RunManagerTestFixture.hpp"
+#include "../LocalJobDispatcher.hpp"
+
+using openstudio::UUID;
+using openstudio::runmanager::JobResources;
+using openstudio::runmanager::LocalJobDispatcher;
+
+TEST_F(RunManagerTestFixture, LocalJobDispatcher_ResourceFitting)
+{
+  LocalJobDispatcher dispatcher;
+
+  UUID heavy1 = openstudio::createUUID();
+  UUID heavy2 = openstudio::createUUID();
+  UUID light1 = openstudio::createUUID();
+  UUID light2 = openstudio::createUUID();
+  UUID light3 = openstudio::createUUID();
+  UUID container = openstudio::createUUID();
+  UUID blocked = openstudio::createUUID();
+
+  std::vector<LocalJobDispatcher::Candidate> queue;
+  queue.push_back(LocalJobDispatcher::Candidate(heavy1, JobResources(2, 2000), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(heavy2, JobResources(2, 2000), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(blocked, JobResources(1, 200), false, false));
+  queue.push_back(LocalJobDispatcher::Candidate(light1, JobResources(1, 200), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(light2, JobResources(1, 200), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(light3, JobResources(1, 200), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(container, JobResources(0, 0), false, true));
+
+  // 4 cores and 3000 MB: the second heavy job does not fit in memory, the third light job is out of cores
+  std::vector<UUID> started = dispatcher.selectJobsToStart(queue, 4, 3000, QDateTime::currentDateTime());
+  ASSERT_EQ(4u, started.size());
+  EXPECT_EQ(heavy1, started[0]);
+  EXPECT_EQ(light1, started[1]);
+  EXPECT_EQ(light2, started[2]);
+  EXPECT_EQ(container, started[3]);
+
+  // without a memory limit only cores count
+  started = dispatcher.selectJobsToStart(queue, 4, 0, QDateTime::currentDateTime());
+  ASSERT_EQ(3u, started.size());
+  EXPECT_EQ(heavy1, started[0]);
+  EXPECT_EQ(heavy2, started[1]);
+  EXPECT_EQ(container, started[2]);
+
+  // a job larger than the limits runs by itself
+  queue.clear();
+  queue.push_back(LocalJobDispatcher::Candidate(heavy1, JobResources(8, 16000), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(light1, JobResources(1, 200), false, true));
+  started = dispatcher.selectJobsToStart(queue, 4, 3000, QDateTime::currentDateTime());
+  ASSERT_EQ(1u, started.size());
+  EXPECT_EQ(heavy1, started[0]);
+
+  queue[0].running = true;
+  queue[0].runnable = false;
+  started = dispatcher.selectJobsToStart(queue, 4, 3000, QDateTime::currentDateTime());
+  EXPECT_TRUE(started.empty());
+}
+
+TEST_F(RunManagerTestFixture, LocalJobDispatcher_Reservation)
+{
+  LocalJobDispatcher dispatcher(30);
+
+  UUID heavy = openstudio::createUUID();
+  std::vector<UUID> lights;
+  for (int i = 0; i < 5; ++i) {
+    lights.push_back(openstudio::createUUID());
+  }
+  UUID container = openstudio::createUUID();
+
+  QDateTime start = QDateTime::currentDateTime();
+
+  // one light job running on 2 cores, the heavy job needs both
+  std::vector<LocalJobDispatcher::Candidate> queue;
+  queue.push_back(LocalJobDispatcher::Candidate(lights[0], JobResources(1, 200), true, false));
+  queue.push_back(LocalJobDispatcher::Candidate(heavy, JobResources(2, 2000), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(lights[1], JobResources(1, 200), false, true));
+  std::vector<UUID> started = dispatcher.selectJobsToStart(queue, 2, 0, start);
+  ASSERT_EQ(1u, started.size());
+  EXPECT_EQ(lights[1], started[0]);
+
+  // lights[0] finishes, the freed core goes to the next light job while the heavy job has not waited long
+  queue.clear();
+  queue.push_back(LocalJobDispatcher::Candidate(heavy, JobResources(2, 2000), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(lights[1], JobResources(1, 200), true, false));
+  queue.push_back(LocalJobDispatcher::Candidate(lights[2], JobResources(1, 200), false, true));
+  started = dispatcher.selectJobsToStart(queue, 2, 0, start.addSecs(10));
+  ASSERT_EQ(1u, started.size());
+  EXPECT_EQ(lights[2], started[0]);
+
+  // lights[1] finishes after the heavy job has waited 30 s, so it reserves the freed core;
+  // jobs that use no resources still start
+  queue.clear();
+  queue.push_back(LocalJobDispatcher::Candidate(heavy, JobResources(2, 2000), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(lights[2], JobResources(1, 200), true, false));
+  queue.push_back(LocalJobDispatcher::Candidate(lights[3], JobResources(1, 200), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(container, JobResources(0, 0), false, true));
+  started = dispatcher.selectJobsToStart(queue, 2, 0, start.addSecs(31));
+  ASSERT_EQ(1u, started.size());
+  EXPECT_EQ(container, started[0]);
+
+  // once lights[2] finishes the heavy job starts, ahead of the remaining light jobs
+  queue.clear();
+  queue.push_back(LocalJobDispatcher::Candidate(heavy, JobResources(2, 2000), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(lights[3], JobResources(1, 200), false, true));
+  queue.push_back(LocalJobDispatcher::Candidate(lights[4], JobResources(1, 200), false, true));
+  started = dispatcher.selectJobsToStart(queue, 2, 0, start.addSecs(40));
+  ASSERT_EQ(1u, started.size());
+  EXPECT_EQ(heavy, started[0]);
+}
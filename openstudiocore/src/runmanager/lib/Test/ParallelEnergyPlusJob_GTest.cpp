@@ -25,6 +25,7 @@
 #include "../JobFactory.hpp"
 #include "../RunManager.hpp"
 #include "../Workflow.hpp"
+#include "../ParallelEnergyPlus/ParallelEnergyPlus.hpp"
 
 #include "../../../model/Model.hpp"
 
@@ -33,6 +34,7 @@
 #include "../../../utilities/data/EndUses.hpp"
 #include "../../../utilities/data/Attribute.hpp"
 #include "../../../utilities/sql/SqlFile.hpp"
+#include "../../../utilities/core/System.hpp"
 
 #include <boost/filesystem/path.hpp>
 
@@ -40,6 +42,10 @@
 #include <QElapsedTimer>
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
 using openstudio::Attribute;
 using openstudio::IdfFile;
 using openstudio::IdfObject;
@@ -160,3 +166,77 @@ TEST_F(RunManagerTestFixture, ParallelEnergyPlusJobTest)
 }
 
 
+
+TEST_F(RunManagerTestFixture, ParallelEnergyPlusRecommendedSplits)
+{
+  unsigned numProcessors = openstudio::System::numberOfProcessors();
+
+  int splits = openstudio::runmanager::Workflow::recommendedEnergyPlusSplits(365, 7, 6);
+  EXPECT_GE(splits, 1);
+  EXPECT_LE(splits, static_cast<int>(numProcessors));
+  // never more splits than it takes for overhead (7 lead-in + 6 warmup days) to match the reported days
+  EXPECT_LE(splits, (365 - 7) / 13);
+
+  // short run periods are not worth splitting
+  EXPECT_EQ(1, openstudio::runmanager::Workflow::recommendedEnergyPlusSplits(14, 7, 6));
+  EXPECT_EQ(1, openstudio::runmanager::Workflow::recommendedEnergyPlusSplits(5, 7, 6));
+
+  // more measured warmup means fewer, longer splits
+  EXPECT_GE(openstudio::runmanager::Workflow::recommendedEnergyPlusSplits(365, 1, 1),
+            openstudio::runmanager::Workflow::recommendedEnergyPlusSplits(365, 1, 25));
+
+  openstudio::path outdir = openstudio::toPath(QDir::tempPath()) / openstudio::toPath("ParallelEnergyPlusRecommendedSplits");
+  boost::filesystem::create_directories(outdir);
+  openstudio::path eio = outdir / openstudio::toPath("eplusout.eio");
+  {
+    std::ofstream ofs(openstudio::toString(eio).c_str());
+    ofs << "! <Environment:WarmupDays>, NumberofWarmupDays" << std::endl;
+    ofs << " Environment:WarmupDays,   3" << std::endl;
+    ofs << " Environment:WarmupDays,  11" << std::endl;
+  }
+
+  boost::optional<int> warmupDays = openstudio::runmanager::Workflow::measuredWarmupDays(eio);
+  ASSERT_TRUE(warmupDays);
+  EXPECT_EQ(11, *warmupDays);
+
+  EXPECT_FALSE(openstudio::runmanager::Workflow::measuredWarmupDays(outdir / openstudio::toPath("missing.eio")));
+}
+
+TEST_F(RunManagerTestFixture, ParallelEnergyPlusCreatePartitions)
+{
+  boost::gregorian::date startDate(2010, 1, 1);
+  boost::gregorian::date endDate(2010, 12, 31);
+
+  for (int offset = 0; offset <= 7; offset += 7)
+  {
+    for (int numPartitions = 1; numPartitions <= 16; ++numPartitions)
+    {
+      std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > partitions
+        = ParallelEnergyPlus::createPartitions(startDate, endDate, offset, numPartitions);
+      ASSERT_EQ(static_cast<size_t>(numPartitions), partitions.size());
+
+      // reported days cover the run period exactly, without gaps or overlap
+      boost::gregorian::date nextDay(startDate);
+      int minSimulatedDays = std::numeric_limits<int>::max();
+      int maxSimulatedDays = 0;
+      for (int i = 0; i < numPartitions; ++i)
+      {
+        int leadIn = (i == 0) ? 0 : offset;
+        EXPECT_EQ(nextDay, partitions[i].first + boost::gregorian::date_duration(leadIn));
+        EXPECT_LE(partitions[i].first + boost::gregorian::date_duration(leadIn), partitions[i].second);
+        nextDay = partitions[i].second + boost::gregorian::date_duration(1);
+
+        int simulatedDays = (partitions[i].second - partitions[i].first).days() + 1;
+        minSimulatedDays = std::min(minSimulatedDays, simulatedDays);
+        maxSimulatedDays = std::max(maxSimulatedDays, simulatedDays);
+      }
+      EXPECT_EQ(endDate + boost::gregorian::date_duration(1), nextDay);
+
+      // run time is balanced
+      EXPECT_LE(maxSimulatedDays - minSimulatedDays, 1) << numPartitions << " partitions, offset " << offset;
+    }
+  }
+
+  EXPECT_THROW(ParallelEnergyPlus::createPartitions(startDate, endDate, 7, 0), std::runtime_error);
+  EXPECT_THROW(ParallelEnergyPlus::createPartitions(startDate, startDate + boost::gregorian::date_duration(2), 0, 4), std::runtime_error);
+}
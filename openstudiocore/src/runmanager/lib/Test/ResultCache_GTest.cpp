@@ -0,0 +1,136 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "RunManagerTestFixture.hpp"
+#include "../ResultCache.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <set>
+
+namespace {
+  void writeTestFile(const openstudio::path &t_path, const std::string &t_contents)
+  {
+    boost::filesystem::create_directories(t_path.parent_path());
+    boost::filesystem::ofstream ofs(t_path, std::ios_base::out | std::ios_base::trunc);
+    ofs << t_contents;
+  }
+
+  std::string readTestFile(const openstudio::path &t_path)
+  {
+    boost::filesystem::ifstream ifs(t_path);
+    return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+  }
+}
+
+TEST_F(RunManagerTestFixture, ResultCacheTest)
+{
+  using namespace openstudio;
+  using namespace openstudio::runmanager;
+
+  openstudio::path basedir = openstudio::tempDir() / openstudio::toPath("ResultCacheTest");
+  boost::filesystem::remove_all(basedir);
+
+  openstudio::path bin = basedir / toPath("bin") / toPath("energyplus");
+  writeTestFile(bin, "binary");
+  openstudio::path idd = basedir / toPath("bin") / toPath("Energy+.idd");
+  writeTestFile(idd, "!IDD_Version 8.2.0");
+  openstudio::path idf = basedir / toPath("in.idf");
+  writeTestFile(idf, "Version,8.2;");
+
+  openstudio::path outdir1 = basedir / toPath("run1");
+  openstudio::path outdir2 = basedir / toPath("run2");
+
+  ToolInfo tool("energyplus", ToolVersion(8,2), bin);
+
+  std::vector<std::pair<openstudio::path, openstudio::path> > required1;
+  required1.push_back(std::make_pair(idf, outdir1 / toPath("in.idf")));
+  std::vector<std::pair<openstudio::path, openstudio::path> > required2;
+  required2.push_back(std::make_pair(idf, outdir2 / toPath("in.idf")));
+
+  // the same execution in different output directories has the same manifest
+  std::string manifest1 = ResultCache::manifest(tool, required1, std::vector<std::string>(), outdir1, std::vector<openstudio::path>(), "", basedir);
+  std::string manifest2 = ResultCache::manifest(tool, required2, std::vector<std::string>(), outdir2, std::vector<openstudio::path>(), "", basedir);
+  EXPECT_FALSE(manifest1.empty());
+  EXPECT_EQ(manifest1, manifest2);
+
+  // tools that may read unlisted inputs are not cached
+  ToolInfo ruby("ruby", ToolVersion(2,0), bin);
+  EXPECT_TRUE(ResultCache::manifest(ruby, required1, std::vector<std::string>(), outdir1, std::vector<openstudio::path>(), "", basedir).empty());
+
+  ResultCache cache(basedir / toPath("cache"));
+  EXPECT_FALSE(cache.restore(manifest1, outdir2));
+
+  writeTestFile(outdir1 / toPath("eplusout.sql"), "sql");
+  writeTestFile(outdir1 / toPath("mergedjob-0") / toPath("eplusout.err"), "err");
+  std::vector<openstudio::path> files;
+  files.push_back(toPath("eplusout.sql"));
+  files.push_back(toPath("mergedjob-0") / toPath("eplusout.err"));
+  EXPECT_TRUE(cache.store(manifest1, outdir1, files, "stdout text", ""));
+
+  boost::optional<CachedResult> result = cache.restore(manifest2, outdir2);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(2u, result->files.size());
+  EXPECT_EQ("stdout text", result->standardOut);
+  EXPECT_EQ("sql", readTestFile(outdir2 / toPath("eplusout.sql")));
+  EXPECT_EQ("err", readTestFile(outdir2 / toPath("mergedjob-0") / toPath("eplusout.err")));
+
+  // changing an input changes the manifest
+  writeTestFile(idf, "Version,8.3;");
+  std::string manifest3 = ResultCache::manifest(tool, required1, std::vector<std::string>(), outdir1, std::vector<openstudio::path>(), "", basedir);
+  EXPECT_NE(manifest1, manifest3);
+  EXPECT_FALSE(cache.restore(manifest3, outdir2));
+
+  // so does changing a data file installed with the tool
+  writeTestFile(idd, "!IDD_Version 8.2.0.1");
+  std::string manifest4 = ResultCache::manifest(tool, required1, std::vector<std::string>(), outdir1, std::vector<openstudio::path>(), "", basedir);
+  EXPECT_NE(manifest3, manifest4);
+}
+
+TEST_F(RunManagerTestFixture, ResultCacheChangedFilesTest)
+{
+  using namespace openstudio;
+  using namespace openstudio::runmanager;
+
+  openstudio::path outdir = openstudio::tempDir() / openstudio::toPath("ResultCacheChangedFilesTest");
+  boost::filesystem::remove_all(outdir);
+
+  EXPECT_TRUE(ResultCache::snapshot(outdir).empty());
+
+  // left by an earlier tool of the same job
+  writeTestFile(outdir / toPath("in.idf"), "Version,8.2;");
+  writeTestFile(outdir / toPath("eplusout.err"), "err");
+
+  ResultCache::DirectorySnapshot before = ResultCache::snapshot(outdir);
+  EXPECT_EQ(2u, before.size());
+
+  writeTestFile(outdir / toPath("eplusout.sql"), "sql");
+  writeTestFile(outdir / toPath("mergedjob-0") / toPath("eplusout.err"), "err");
+  writeTestFile(outdir / toPath("eplusout.err"), "longer err");
+
+  std::vector<openstudio::path> changed = ResultCache::changedFiles(before, ResultCache::snapshot(outdir));
+  std::set<openstudio::path> changedSet(changed.begin(), changed.end());
+  EXPECT_EQ(3u, changedSet.size());
+  EXPECT_EQ(1u, changedSet.count(toPath("eplusout.sql")));
+  EXPECT_EQ(1u, changedSet.count(toPath("eplusout.err")));
+  EXPECT_EQ(1u, changedSet.count(toPath("mergedjob-0") / toPath("eplusout.err")));
+  EXPECT_EQ(0u, changedSet.count(toPath("in.idf")));
+}
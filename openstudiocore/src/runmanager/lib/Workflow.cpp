@@ -19,12 +19,14 @@
 #include "Workflow.hpp"
 #include "WorkItem.hpp"
 #include "RubyJobUtils.hpp"
+#include "ParallelEnergyPlus/ParallelEnergyPlus.hpp"
 #include <QCryptographicHash>
 
 #include "../../ruleset/OSArgument.hpp"
 
 #include "../../utilities/core/PathHelpers.hpp"
 #include "../../utilities/core/ApplicationPathHelpers.hpp"
+#include "../../utilities/core/System.hpp"
 
 namespace openstudio {
 namespace runmanager {
@@ -910,6 +912,16 @@ namespace runmanager {
   }
 
 
+  int Workflow::recommendedEnergyPlusSplits(int t_totalDays, int t_offset, double t_warmupDays)
+  {
+    return ParallelEnergyPlus::numberOfPartitions(t_totalDays, t_offset, t_warmupDays, System::numberOfProcessors());
+  }
+
+  boost::optional<int> Workflow::measuredWarmupDays(const openstudio::path &t_eio)
+  {
+    return ParallelEnergyPlus::warmupDays(t_eio);
+  }
+
   void Workflow::parallelizeEnergyPlus(int t_numSplits, int t_offset)
   {
     try {
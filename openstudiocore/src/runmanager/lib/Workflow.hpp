@@ -415,6 +415,17 @@ namespace runmanager {
       /// \param[in] t_offset 
       void parallelizeEnergyPlus(int t_numSplits, int t_offset);
 
+      /// \returns a number of splits for parallelizeEnergyPlus sized to the processors on this machine.
+      /// Splits are not made so short that their lead-in and warmup days outweigh the days they report.
+      ///
+      /// \param[in] t_totalDays number of days in the run period
+      /// \param[in] t_offset number of days each split precalculates
+      /// \param[in] t_warmupDays warmup days EnergyPlus needs for the model, see measuredWarmupDays
+      static int recommendedEnergyPlusSplits(int t_totalDays, int t_offset, double t_warmupDays);
+
+      /// \returns the number of warmup days EnergyPlus reported in the eplusout.eio of a previous run
+      static boost::optional<int> measuredWarmupDays(const openstudio::path &t_eio);
+
     private:
       REGISTER_LOGGER("openstudio.runmanager.Workflow");
 
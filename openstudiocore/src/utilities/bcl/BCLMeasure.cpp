@@ -879,13 +879,25 @@ namespace openstudio{
 
     std::vector<BCLFileReference> filesToRemove;
     std::vector<BCLFileReference> filesToAdd;
-    for (BCLFileReference file : m_bclXML.files()) {
+    std::vector<BCLFileReference> filesToCheck;
+    std::vector<openstudio::path> pathsToCheck;
+    for (const BCLFileReference& file : m_bclXML.files()) {
       if (!exists(file.path())){
         result = true;
         filesToRemove.push_back(file);
-      }else if (file.checkForUpdate()){
+      }else{
+        filesToCheck.push_back(file);
+        pathsToCheck.push_back(file.path());
+      }
+    }
+
+    // hash all existing files at once, same as calling checkForUpdate on each
+    std::vector<std::string> newChecksums = checksums(pathsToCheck);
+    for (size_t i = 0; i < filesToCheck.size(); ++i) {
+      if (filesToCheck[i].checksum() != newChecksums[i]){
         result = true;
-        filesToAdd.push_back(file);
+        filesToCheck[i].setChecksum(newChecksums[i]);
+        filesToAdd.push_back(filesToCheck[i]);
       }
     }
 
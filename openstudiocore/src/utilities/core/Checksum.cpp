@@ -18,12 +18,22 @@
 **********************************************************************/
 
 #include "Checksum.hpp"
+#include "System.hpp"
 
+#include <boost/filesystem/fstream.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
 #include <ios>
+#include <map>
+#include <mutex>
 #include <sstream>
-
-#include <boost/crc.hpp> 
-#include <boost/filesystem/fstream.hpp>
+#include <thread>
+#include <vector>
 
 namespace openstudio {
 
@@ -39,41 +49,158 @@ namespace openstudio {
 
       return result;
     }
+
+    typedef std::uint32_t CrcTable[8][256];
+
+    struct CrcTableHolder {
+      CrcTableHolder()
+      {
+        for (std::uint32_t i = 0; i < 256; ++i) {
+          std::uint32_t crc = i;
+          for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1u) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+          }
+          table[0][i] = crc;
+        }
+        for (std::uint32_t i = 0; i < 256; ++i) {
+          for (int slice = 1; slice < 8; ++slice) {
+            table[slice][i] = (table[slice - 1][i] >> 8) ^ table[0][table[slice - 1][i] & 0xFFu];
+          }
+        }
+      }
+
+      CrcTable table;
+    };
+
+    struct ChecksumCacheEntry {
+      uintmax_t size;
+      std::time_t lastWriteTime;
+      std::string checksum;
+    };
+
+    // These are first used on the worker threads started by checksums, so they are built during
+    // static initialization. Function local statics are not initialized thread safely by all
+    // supported compilers (Visual Studio 2013).
+    namespace {
+      const CrcTableHolder crcTableHolder;
+      std::mutex checksumCacheMutex;
+      std::map<path, ChecksumCacheEntry> checksumCache;
+    }
+
+    /// CRC-32 with the same parameters as boost::crc_32_type, computed eight bytes at a time
+    /// using the slicing-by-8 tables. Characters for which checksumIgnore is true are skipped.
+    class ChecksumCrc {
+     public:
+
+      ChecksumCrc() : m_crc(0xFFFFFFFFu) {}
+
+      void process(const char* data, size_t size)
+      {
+        // checksumIgnore only ignores '\r', find each one instead of copying the good bytes
+        const char* end = data + size;
+        while (data < end) {
+          const char* ignored = static_cast<const char*>(std::memchr(data, '\r', end - data));
+          if (!ignored) {
+            ignored = end;
+          }
+          processBytes(reinterpret_cast<const unsigned char*>(data), ignored - data);
+          data = ignored + 1;
+        }
+      }
+
+      std::string checksum() const
+      {
+        std::stringstream ss;
+        ss << std::hex << std::uppercase << std::setfill('0') << std::setw(8) << (m_crc ^ 0xFFFFFFFFu);
+        return ss.str();
+      }
+
+     private:
+
+      static std::uint32_t load(const unsigned char* p)
+      {
+        return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+               (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+      }
+
+      void processBytes(const unsigned char* p, size_t size)
+      {
+        const CrcTable& t = crcTableHolder.table;
+        std::uint32_t crc = m_crc;
+        for (; size >= 8; p += 8, size -= 8) {
+          std::uint32_t one = crc ^ load(p);
+          std::uint32_t two = load(p + 4);
+          crc = t[7][one & 0xFFu] ^ t[6][(one >> 8) & 0xFFu] ^ t[5][(one >> 16) & 0xFFu] ^ t[4][one >> 24] ^
+                t[3][two & 0xFFu] ^ t[2][(two >> 8) & 0xFFu] ^ t[1][(two >> 16) & 0xFFu] ^ t[0][two >> 24];
+        }
+        for (; size > 0; ++p, --size) {
+          crc = t[0][(crc ^ *p) & 0xFFu] ^ (crc >> 8);
+        }
+        m_crc = crc;
+      }
+
+      std::uint32_t m_crc;
+    };
+
+    // checksum of a file, reusing the last checksum computed by this function for the same path
+    // if the file's size and last write time have not changed since
+    std::string cachedChecksum(const path& p)
+    {
+      boost::system::error_code ec;
+      if (!boost::filesystem::is_regular_file(p, ec)) {
+        return checksum(p);
+      }
+      uintmax_t size = boost::filesystem::file_size(p, ec);
+      if (ec) {
+        return checksum(p);
+      }
+      std::time_t lastWriteTime = boost::filesystem::last_write_time(p, ec);
+      if (ec) {
+        return checksum(p);
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(checksumCacheMutex);
+        auto it = checksumCache.find(p);
+        if ((it != checksumCache.end()) && (it->second.size == size) && (it->second.lastWriteTime == lastWriteTime)) {
+          return it->second.checksum;
+        }
+      }
+
+      std::string result = checksum(p);
+
+      // time stamps have a resolution of a second or more, a file written that recently may be
+      // written again without its time stamp changing so it is not cached until it settles
+      if (lastWriteTime + 2 < std::time(nullptr)) {
+        std::lock_guard<std::mutex> lock(checksumCacheMutex);
+        ChecksumCacheEntry entry = { size, lastWriteTime, result };
+        checksumCache[p] = entry;
+      }
+
+      return result;
+    }
   }
 
   /// return 8 character hex checksum of string
   std::string checksum(const std::string& s)
   {
-    std::stringstream ss(s);
-    return checksum(ss);
+    detail::ChecksumCrc crc;
+    crc.process(s.data(), s.size());
+    return crc.checksum();
   }
 
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
+    detail::ChecksumCrc crc;
+    const std::streamsize n = 65536;
+    std::vector<char> buffer(n);
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
-      std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-      
-      crc.process_bytes(str.c_str(), stringSize);
+      is.read(buffer.data(), n);
+      crc.process(buffer.data(), static_cast<size_t>(is.gcount()));
     } while ( is );
-    
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
 
-    return result;
+    return crc.checksum();
   }
 
   /// return 8 character hex checksum of file contents
@@ -90,4 +217,32 @@ namespace openstudio {
     return result;
   }
 
+  std::vector<std::string> checksums(const std::vector<path>& paths)
+  {
+    std::vector<std::string> result(paths.size());
+
+    unsigned nThreads = std::min<unsigned>(std::max(System::numberOfProcessors(), 1u), paths.size());
+    if (nThreads <= 1){
+      for (size_t i = 0; i < paths.size(); ++i){
+        result[i] = detail::cachedChecksum(paths[i]);
+      }
+    }else{
+      std::atomic<size_t> next(0);
+      auto worker = [&paths, &result, &next](){
+        for (size_t i = next++; i < paths.size(); i = next++){
+          result[i] = detail::cachedChecksum(paths[i]);
+        }
+      };
+      std::vector<std::thread> threads;
+      for (unsigned i = 0; i < nThreads; ++i){
+        threads.push_back(std::thread(worker));
+      }
+      for (std::thread& thread : threads){
+        thread.join();
+      }
+    }
+
+    return result;
+  }
+
 } // openstudio
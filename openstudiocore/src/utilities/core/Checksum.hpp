@@ -25,6 +25,7 @@
 
 #include <string>
 #include <ostream>
+#include <vector>
 
 namespace openstudio {
 
@@ -37,6 +38,11 @@ namespace openstudio {
   /// return 8 character hex checksum of file contents
   UTILITIES_API std::string checksum(const path& p);
 
+  /** Returns checksum(p) for each path in paths, in the same order. Files are hashed on several
+   *  threads, and a file whose size and last write time have not changed since this function last
+   *  hashed it is not read again. */
+  UTILITIES_API std::vector<std::string> checksums(const std::vector<path>& paths);
+
 } // openstudio
 
 
@@ -22,6 +22,11 @@
 
 #include "Assert.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include <QReadWriteLock>
 #include <QWriteLocker>
 
@@ -29,11 +34,142 @@ namespace openstudio{
 
   namespace detail{
 
-    FileLogSink_Impl::FileLogSink_Impl(const openstudio::path& path)
+    /// Output stream that hands each flushed chunk of text to a background thread, which writes
+    /// it to the file. The logging core flushes after every message, so formatting stays on the
+    /// logging thread while file output does not. At most maxQueued chunks wait to be written,
+    /// logging threads block when the queue is full. Writes to the stream are serialized by the
+    /// sink frontend.
+    class AsyncFileLogStream : public std::ostream
+    {
+      public:
+
+      AsyncFileLogStream(const openstudio::path& path, size_t maxQueued)
+        : std::ostream(nullptr), m_buffer(path, maxQueued)
+      {
+        this->rdbuf(&m_buffer);
+      }
+
+      /// wait until all flushed text is written to the file
+      void drain()
+      {
+        m_buffer.drain();
+      }
+
+      private:
+
+      class Buffer : public std::streambuf
+      {
+        public:
+
+        Buffer(const openstudio::path& path, size_t maxQueued)
+          : m_file(path), m_maxQueued(maxQueued), m_writing(false), m_stop(false)
+        {
+          m_thread = std::thread(&Buffer::run, this);
+        }
+
+        ~Buffer()
+        {
+          sync();
+          {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+          }
+          m_queued.notify_all();
+          m_thread.join();
+        }
+
+        void drain()
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_written.wait(lock, [this]{ return m_queue.empty() && !m_writing; });
+        }
+
+        protected:
+
+        virtual int_type overflow(int_type c) override
+        {
+          if (!traits_type::eq_int_type(c, traits_type::eof())){
+            m_pending.push_back(traits_type::to_char_type(c));
+          }
+          return traits_type::not_eof(c);
+        }
+
+        virtual std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+          m_pending.append(s, static_cast<size_t>(n));
+          return n;
+        }
+
+        virtual int sync() override
+        {
+          if (m_pending.empty()){
+            return 0;
+          }
+
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_written.wait(lock, [this]{ return m_queue.size() < m_maxQueued; });
+          m_queue.push_back(std::string());
+          m_queue.back().swap(m_pending);
+          lock.unlock();
+
+          m_queued.notify_one();
+          return 0;
+        }
+
+        private:
+
+        void run()
+        {
+          std::deque<std::string> chunks;
+          std::unique_lock<std::mutex> lock(m_mutex);
+          while (true){
+            m_queued.wait(lock, [this]{ return !m_queue.empty() || m_stop; });
+            if (m_queue.empty()){
+              break;
+            }
+
+            chunks.swap(m_queue);
+            m_writing = true;
+            lock.unlock();
+            m_written.notify_all();
+
+            for (const std::string& chunk : chunks){
+              m_file.write(chunk.data(), chunk.size());
+            }
+            m_file.flush();
+            chunks.clear();
+
+            lock.lock();
+            m_writing = false;
+            m_written.notify_all();
+          }
+        }
+
+        boost::filesystem::ofstream m_file;
+        size_t m_maxQueued;
+        std::string m_pending;
+        std::deque<std::string> m_queue;
+        bool m_writing;
+        bool m_stop;
+        std::mutex m_mutex;
+        std::condition_variable m_queued;
+        std::condition_variable m_written;
+        std::thread m_thread;
+      };
+
+      Buffer m_buffer;
+    };
+
+    FileLogSink_Impl::FileLogSink_Impl(const openstudio::path& path, bool asynchronous)
       : m_path(path)
     {
-      m_ofs = boost::shared_ptr<boost::filesystem::ofstream>(new boost::filesystem::ofstream(path));
-      this->setStream(m_ofs);
+      if (asynchronous){
+        m_asyncStream = boost::shared_ptr<AsyncFileLogStream>(new AsyncFileLogStream(path, 1024));
+        this->setStream(m_asyncStream);
+      }else{
+        m_ofs = boost::shared_ptr<boost::filesystem::ofstream>(new boost::filesystem::ofstream(path));
+        this->setStream(m_ofs);
+      }
       this->enable();
     }
 
@@ -52,6 +188,8 @@ namespace openstudio{
 
     std::vector<LogMessage> FileLogSink_Impl::logMessages() const
     {
+      flush();
+
       boost::filesystem::ifstream ifs(m_path);
       std::string line;
       std::string text;
@@ -60,10 +198,19 @@ namespace openstudio{
       }
       return LogMessage::parseLogText(text);
     }
+    void FileLogSink_Impl::flush() const
+    {
+      if (m_asyncStream){
+        // hand any text not yet flushed by the sink to the writer
+        sink()->flush();
+        m_asyncStream->drain();
+      }
+    }
+
   } // detail
 
-  FileLogSink::FileLogSink(const openstudio::path& path)
-    : LogSink(boost::shared_ptr<detail::FileLogSink_Impl>(new detail::FileLogSink_Impl(path)))
+  FileLogSink::FileLogSink(const openstudio::path& path, bool asynchronous)
+    : LogSink(boost::shared_ptr<detail::FileLogSink_Impl>(new detail::FileLogSink_Impl(path, asynchronous)))
   {
     OS_ASSERT(getImpl<detail::FileLogSink_Impl>());
   }
@@ -78,4 +225,9 @@ namespace openstudio{
     return this->getImpl<detail::FileLogSink_Impl>()->logMessages();
   }
 
+  void FileLogSink::flush()
+  {
+    this->getImpl<detail::FileLogSink_Impl>()->flush();
+  }
+
 } // openstudio
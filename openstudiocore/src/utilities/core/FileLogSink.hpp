@@ -32,8 +32,9 @@ namespace openstudio{
     public:
 
     /// constructor takes path of file, opens in write mode positioned at file beginning
-    /// and registers in the global logger
-    FileLogSink(const openstudio::path& path);
+    /// and registers in the global logger. if asynchronous, messages are queued and written
+    /// to the file by a background thread so logging threads do not wait on file output.
+    FileLogSink(const openstudio::path& path, bool asynchronous = false);
 
     /// returns the path that log messages are written to
     openstudio::path path() const;
@@ -41,6 +42,9 @@ namespace openstudio{
     /// get messages out of the file content
     std::vector<LogMessage> logMessages() const;
 
+    /// wait until all messages logged so far are written to the file
+    void flush();
+
   };
 
 } // openstudio
@@ -30,13 +30,15 @@ namespace openstudio{
 
   namespace detail{
 
+    class AsyncFileLogStream;
+
     class UTILITIES_API FileLogSink_Impl : public LogSink_Impl
     {
       public:
 
       /// constructor takes path of file, opens in write mode positioned at file beginning
       /// and registers in the global logger
-      FileLogSink_Impl(const openstudio::path& path);
+      FileLogSink_Impl(const openstudio::path& path, bool asynchronous);
 
       /// destructor, does not disable log sink
       virtual ~FileLogSink_Impl();
@@ -47,10 +49,14 @@ namespace openstudio{
       /// get messages out of the file content
       std::vector<LogMessage> logMessages() const;
 
+      /// wait until all messages logged so far are written to the file
+      void flush() const;
+
       private:
 
       openstudio::path m_path;
       boost::shared_ptr<boost::filesystem::ofstream> m_ofs;
+      boost::shared_ptr<AsyncFileLogStream> m_asyncStream;
     };
 
 
@@ -209,6 +209,8 @@ namespace openstudio{
         filterLogLevel = *m_logLevel;
       }
 
+      detail::setSinkLogLevel(m_sink, filterLogLevel);
+
       boost::regex filterChannelRegex(".*");
       if (m_channelRegex){
         filterChannelRegex = *m_channelRegex;
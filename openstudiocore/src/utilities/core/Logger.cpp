@@ -34,7 +34,11 @@
 #include <boost/log/support/regex.hpp>
 
 #include <boost/utility/empty_deleter.hpp>
+#include <boost/weak_ptr.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
@@ -80,8 +84,97 @@ namespace openstudio{
     BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
   }
 
+  namespace {
+
+    // filter levels of all sinks, kept outside of LoggerSingleton because the sinks created
+    // in its constructor report their levels before it is constructed
+    struct SinkLogLevels
+    {
+      struct Entry
+      {
+        boost::weak_ptr<LogSinkBackend> sink;
+        LogLevel logLevel;
+        bool enabled;
+      };
+
+      SinkLogLevels()
+        : minimumLogLevel(Fatal + 1)
+      {}
+
+      // recompute the lowest level of any enabled sink, forgetting sinks that no longer exist
+      void update()
+      {
+        int result = Fatal + 1;
+        for (auto it = entries.begin(); it != entries.end(); ){
+          if (it->second.sink.expired()){
+            it = entries.erase(it);
+            continue;
+          }
+          if (it->second.enabled){
+            result = std::min(result, static_cast<int>(it->second.logLevel));
+          }
+          ++it;
+        }
+        minimumLogLevel.store(result);
+      }
+
+      Entry& entry(const boost::shared_ptr<LogSinkBackend>& sink)
+      {
+        Entry& result = entries[sink.get()];
+        if (result.sink.lock() != sink){
+          // new sink, possibly at the address of one that no longer exists
+          // sinks without a filter accept all levels
+          result.sink = sink;
+          result.logLevel = Trace;
+          result.enabled = false;
+        }
+        return result;
+      }
+
+      std::mutex mutex;
+      std::map<const LogSinkBackend*, Entry> entries;
+      std::atomic<int> minimumLogLevel;
+    };
+
+    // never destroyed, messages may be logged during static destruction
+    SinkLogLevels& sinkLogLevels()
+    {
+      static SinkLogLevels* result = new SinkLogLevels();
+      return *result;
+    }
+
+  }
+
+  bool logLevelEnabled(LogLevel level)
+  {
+    // make sure the standard sinks are set up
+    Logger::instance();
+
+    return (static_cast<int>(level) >= sinkLogLevels().minimumLogLevel.load(std::memory_order_relaxed));
+  }
+
+  namespace detail {
+
+    void setSinkLogLevel(const boost::shared_ptr<LogSinkBackend>& sink, LogLevel logLevel)
+    {
+      SinkLogLevels& levels = sinkLogLevels();
+      std::lock_guard<std::mutex> lock(levels.mutex);
+      levels.entry(sink).logLevel = logLevel;
+      levels.update();
+    }
+
+    void setSinkEnabled(const boost::shared_ptr<LogSinkBackend>& sink, bool enabled)
+    {
+      SinkLogLevels& levels = sinkLogLevels();
+      std::lock_guard<std::mutex> lock(levels.mutex);
+      levels.entry(sink).enabled = enabled;
+      levels.update();
+    }
+
+  }
+
   LoggerSingleton::LoggerSingleton()
-    : m_mutex(new QReadWriteLock())
+    : m_mutex(new QReadWriteLock()), m_loggerMap(std::make_shared<LoggerMapType>())
   {
     // Make QThread attribute available to logging
     boost::log::core::get()->add_global_attribute("QThread", boost::log::attributes::make_function(&QThread::currentThread));
@@ -126,27 +219,32 @@ namespace openstudio{
 
   LoggerType& LoggerSingleton::loggerFromChannel(const LogChannel& logChannel)
   {
-    QReadLocker l(m_mutex);
+    std::shared_ptr<const LoggerMapType> loggerMap = std::atomic_load(&m_loggerMap);
 
-    auto it = m_loggerMap.find(logChannel);
-    if (it == m_loggerMap.end()){
-      //LoggerType newLogger(keywords::channel = logChannel, keywords::severity = Debug);
-      LoggerType newLogger(keywords::channel = logChannel);
+    auto it = loggerMap->find(logChannel);
+    if (it == loggerMap->end()){
 
-      std::pair<LogChannel, LoggerType> newPair(logChannel,newLogger);
+      QWriteLocker l(m_mutex);
 
-      // Drop the read lock and grab a write lock - we need to add the new file to the map
-      // this will reduce contention when multiple threads trying to log at once.
-      l.unlock();
-      QWriteLocker l2(m_mutex);
+      // another thread may have added the channel while we waited for the lock
+      loggerMap = std::atomic_load(&m_loggerMap);
+      it = loggerMap->find(logChannel);
+      if (it != loggerMap->end()){
+        return *it->second;
+      }
 
-      std::pair<LoggerMapType::iterator, bool> inserted = m_loggerMap.insert(newPair);
+      //LoggerType newLogger(keywords::channel = logChannel, keywords::severity = Debug);
+      std::shared_ptr<LoggerType> newLogger = std::make_shared<LoggerType>(keywords::channel = logChannel);
 
-      return inserted.first->second;
+      // copy the map so readers of the current map are not disturbed, the loggers are shared
+      std::shared_ptr<LoggerMapType> newLoggerMap = std::make_shared<LoggerMapType>(*loggerMap);
+      newLoggerMap->insert(std::make_pair(logChannel, newLogger));
+      std::atomic_store(&m_loggerMap, std::shared_ptr<const LoggerMapType>(newLoggerMap));
 
+      return *newLogger;
     }
 
-    return it->second;
+    return *it->second;
   }
 
   bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkBackend> sink)
@@ -174,6 +272,8 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->add_sink(sink);
+
+      detail::setSinkEnabled(sink, true);
     }
   }
 
@@ -193,6 +293,8 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->remove_sink(sink);
+
+      detail::setSinkEnabled(sink, false);
     }
   }
 
@@ -29,6 +29,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <memory>
 #include <sstream>
 #include <set>
 #include <map>
@@ -48,12 +49,15 @@ class QWriteLocker;
 #define LOG_AND_THROW(__message__) \
   LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
+/// log a message from outside a registered class, the message is only formatted if some
+/// enabled sink accepts its level
 #define LOG_FREE(__level__, __channel__, __message__) \
   { \
-    std::stringstream _ss1; \
-    _ss1 << __message__; \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    if (openstudio::logLevelEnabled(__level__)){ \
+      std::stringstream _ss1; \
+      _ss1 << __message__; \
+      openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    } \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -70,6 +74,20 @@ namespace openstudio{
   /// convenience function for SWIG, prefer macros in C++
   UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
+  /// returns false if no enabled sink accepts messages at level, used by the macros to skip
+  /// formatting messages that would be dropped
+  UTILITIES_API bool logLevelEnabled(LogLevel level);
+
+  namespace detail {
+
+    /// records the level of a sink's filter, called whenever the filter changes
+    UTILITIES_API void setSinkLogLevel(const boost::shared_ptr<LogSinkBackend>& sink, LogLevel logLevel);
+
+    /// records whether a sink is registered in the logging core
+    UTILITIES_API void setSinkEnabled(const boost::shared_ptr<LogSinkBackend>& sink, bool enabled);
+
+  }
+
   /** Singleton logger class.  Singleton Logger object maintains logging state throughout
    *   program execution.
    */
@@ -118,9 +136,12 @@ namespace openstudio{
     /// standard err logger
     LogSink m_standardErrLogger;
 
-    /// map of std::string to logger
-    typedef std::map<std::string, LoggerType, openstudio::IstringCompare> LoggerMapType;
-    LoggerMapType m_loggerMap;
+    /// map of std::string to logger, loggers are shared between copies of the map
+    typedef std::map<std::string, std::shared_ptr<LoggerType>, openstudio::IstringCompare> LoggerMapType;
+
+    /// current map, never modified in place. lookups read it without locking m_mutex, adding
+    /// a channel replaces it with a copy under the write lock.
+    std::shared_ptr<const LoggerMapType> m_loggerMap;
 
     /// current sinks, kept here so don't destruct when LogSink wrapper goes out of scope
     typedef std::set<boost::shared_ptr<LogSinkBackend> > SinkSetType;
@@ -115,3 +115,44 @@ TEST(Checksum, UUIDs) {
     EXPECT_TRUE(std::find(itStart,itEnd,*it) == itEnd);
   }
 }
+
+TEST(Checksum, LargeInputs)
+{
+  // longer than the stream buffer, with carriage returns on either side of buffer boundaries
+  string s;
+  string withoutCarriageReturns;
+  for (unsigned i = 0; i < 200000; ++i) {
+    char c = static_cast<char>('a' + (i % 26));
+    if (i % 4099 == 0) {
+      s += '\r';
+    }
+    s += c;
+    withoutCarriageReturns += c;
+  }
+  stringstream ss(s);
+  EXPECT_EQ(checksum(withoutCarriageReturns), checksum(s));
+  EXPECT_EQ(checksum(s), checksum(ss));
+}
+
+TEST(Checksum, MultiplePaths)
+{
+  std::vector<path> paths;
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/Checksum.txt"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/Checksum2.txt"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/NotAFile.txt"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/Checksum.txt"));
+
+  StringVector result = openstudio::checksums(paths);
+  ASSERT_EQ(5u, result.size());
+  EXPECT_EQ("1AD514BA", result[0]);
+  EXPECT_EQ("17B88D3A", result[1]);
+  EXPECT_EQ("00000000", result[2]);
+  EXPECT_EQ("00000000", result[3]);
+  EXPECT_EQ("1AD514BA", result[4]);
+
+  // second time through unchanged files may come from the cache
+  EXPECT_TRUE(result == openstudio::checksums(paths));
+
+  EXPECT_TRUE(openstudio::checksums(std::vector<path>()).empty());
+}
@@ -333,4 +333,90 @@ namespace
 
     EXPECT_NO_THROW(boost::filesystem::remove(path));
   }
+
+  int countedMessage(int& count)
+  {
+    ++count;
+    return count;
+  }
+
+  TEST(LoggerTest, level_gate)
+  {
+    // only the sink below may accept messages, the standard sinks are restored at the end
+    LogSink standardOutLogger = openstudio::Logger::instance().standardOutLogger();
+    LogSink standardErrLogger = openstudio::Logger::instance().standardErrLogger();
+    bool standardOutEnabled = standardOutLogger.isEnabled();
+    bool standardErrEnabled = standardErrLogger.isEnabled();
+    standardOutLogger.disable();
+    standardErrLogger.disable();
+
+    int count = 0;
+    {
+      StringStreamLogSink sink;
+      sink.setLogLevel(Error);
+
+      EXPECT_TRUE(openstudio::logLevelEnabled(Error));
+      EXPECT_TRUE(openstudio::logLevelEnabled(Fatal));
+      EXPECT_FALSE(openstudio::logLevelEnabled(Warn));
+      EXPECT_FALSE(openstudio::logLevelEnabled(Trace));
+
+      LOG_FREE(Error, "gate.channel", "Counted " << countedMessage(count));
+      EXPECT_EQ(1, count);
+      ASSERT_EQ(1u, sink.logMessages().size());
+      EXPECT_EQ("Counted 1", sink.logMessages()[0].logMessage());
+
+      // a disabled level is not formatted at all
+      LOG_FREE(Trace, "gate.channel", "Counted " << countedMessage(count));
+      EXPECT_EQ(1, count);
+      EXPECT_EQ(1u, sink.logMessages().size());
+
+      sink.setLogLevel(Trace);
+      EXPECT_TRUE(openstudio::logLevelEnabled(Trace));
+      LOG_FREE(Trace, "gate.channel", "Counted " << countedMessage(count));
+      EXPECT_EQ(2, count);
+      ASSERT_EQ(2u, sink.logMessages().size());
+      EXPECT_EQ("Counted 2", sink.logMessages()[1].logMessage());
+    }
+
+    // the level is raised again once the sink is gone
+    EXPECT_FALSE(openstudio::logLevelEnabled(Trace));
+    LOG_FREE(Trace, "gate.channel", "Counted " << countedMessage(count));
+    EXPECT_EQ(2, count);
+
+    if (standardOutEnabled){
+      standardOutLogger.enable();
+    }
+    if (standardErrEnabled){
+      standardErrLogger.enable();
+    }
+  }
+
+  TEST(LoggerTest, async_file_logger)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    openstudio::path path = toPath("./async_file_logger.log");
+    boost::filesystem::remove(path);
+    ASSERT_FALSE(boost::filesystem::exists(path));
+
+    {
+      FileLogSink sink(path, true);
+      sink.setLogLevel(Error);
+      sink.setChannelRegex(boost::regex("hello\\..*"));
+      ASSERT_TRUE(boost::filesystem::exists(path));
+
+      for (unsigned i = 0; i < 100; ++i){
+        freeLogging();
+        classLogging();
+      }
+
+      std::vector<LogMessage> logMessages = sink.logMessages();
+      ASSERT_EQ(100u, logMessages.size());
+      EXPECT_EQ(Error, logMessages[0].logLevel());
+      EXPECT_EQ("hello.channel", logMessages[0].logChannel());
+      EXPECT_EQ("Hello Error", logMessages[0].logMessage());
+
+      sink.disable();
+    }
+  }
 }
@@ -0,0 +1,515 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "AttributeBinary.hpp"
+
+#include "../core/Assert.hpp"
+
+#include "../units/Quantity.hpp"
+#include "../units/QuantityFactory.hpp"
+#include "../units/Unit.hpp"
+#include "../units/UnitFactory.hpp"
+
+#include <boost/filesystem/fstream.hpp>
+
+#include <QByteArray>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+namespace openstudio {
+
+namespace {
+
+  const char binaryAttributeMagic[4] = {'O','S','A','B'};
+  const unsigned char binaryAttributeFormatVersion = 1;
+
+  const unsigned char hasDisplayNameFlag = 0x01;
+  const unsigned char hasUnitsFlag = 0x02;
+  const unsigned char hasSourceFlag = 0x04;
+
+  // tag byte plus four byte payload length
+  const unsigned recordHeaderSize = 5;
+
+  // record lengths come from the stream, so payloads are read at most this many bytes at a time
+  const std::uint32_t maxReadChunkSize = 1 << 16;
+
+  // nesting of attribute vectors accepted by the reader, guards the recursion in getAttribute
+  const unsigned maxAttributeDepth = 64;
+
+  bool isKnownTag(unsigned char tag) {
+    return tag <= static_cast<unsigned char>(AttributeValueType::AttributeVector);
+  }
+
+  // encoding
+
+  void putU8(std::string& out, unsigned char value) {
+    out.push_back(static_cast<char>(value));
+  }
+
+  void putU32At(std::string& out, std::string::size_type pos, std::uint32_t value) {
+    for (unsigned i = 0; i < 4; ++i) {
+      out[pos + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+  }
+
+  void putVarint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80) {
+      out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+  }
+
+  void putDouble(std::string& out, double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (unsigned i = 0; i < 8; ++i) {
+      out.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+    }
+  }
+
+  void putString(std::string& out, const std::string& value) {
+    putVarint(out, value.size());
+    out.append(value);
+  }
+
+  void putUUID(std::string& out, const openstudio::UUID& uuid) {
+    QByteArray bytes = uuid.toRfc4122();
+    out.append(bytes.constData(), bytes.size());
+  }
+
+  void putRecord(std::string& out, const Attribute& attribute) {
+    AttributeValueType valueType = attribute.valueType();
+    putU8(out, static_cast<unsigned char>(valueType.value()));
+    std::string::size_type lengthPos = out.size();
+    out.append(4, '\0');
+
+    boost::optional<std::string> displayName = attribute.displayName();
+    boost::optional<std::string> units = attribute.units();
+    std::string source = attribute.source();
+    unsigned char flags = 0;
+    if (displayName) { flags |= hasDisplayNameFlag; }
+    if (units) { flags |= hasUnitsFlag; }
+    if (!source.empty()) { flags |= hasSourceFlag; }
+
+    putU8(out, flags);
+    putUUID(out, attribute.uuid());
+    putUUID(out, attribute.versionUUID());
+    putString(out, attribute.name());
+    if (displayName) { putString(out, *displayName); }
+    if (units) { putString(out, *units); }
+    if (!source.empty()) { putString(out, source); }
+
+    switch (valueType.value()) {
+      case AttributeValueType::Boolean :
+        putU8(out, attribute.valueAsBoolean() ? 1 : 0);
+        break;
+      case AttributeValueType::Double :
+        putDouble(out, attribute.valueAsDouble());
+        break;
+      case AttributeValueType::Quantity : {
+        Quantity quantity = attribute.valueAsQuantity();
+        putDouble(out, quantity.value());
+        putString(out, quantity.units().standardString());
+        break;
+      }
+      case AttributeValueType::Unit :
+        putString(out, attribute.valueAsUnit().standardString());
+        break;
+      case AttributeValueType::Integer : {
+        // zig-zag so that small negative numbers stay small
+        std::int64_t value = attribute.valueAsInteger();
+        putVarint(out, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+        break;
+      }
+      case AttributeValueType::Unsigned :
+        putVarint(out, attribute.valueAsUnsigned());
+        break;
+      case AttributeValueType::String :
+        putString(out, attribute.valueAsString());
+        break;
+      case AttributeValueType::AttributeVector : {
+        std::vector<Attribute> children = attribute.valueAsAttributeVector();
+        putVarint(out, children.size());
+        for (const Attribute& child : children) {
+          putRecord(out, child);
+        }
+        break;
+      }
+      default :
+        OS_ASSERT(false);
+    }
+
+    putU32At(out, lengthPos, static_cast<std::uint32_t>(out.size() - lengthPos - 4));
+  }
+
+  // decoding
+
+  std::uint32_t getU32(const char* p) {
+    std::uint32_t result = 0;
+    for (unsigned i = 0; i < 4; ++i) {
+      result |= static_cast<std::uint32_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+    }
+    return result;
+  }
+
+  /** Reads from an in-memory record payload. Any read past the end marks the cursor bad and
+   *  returns a zero value, so callers only need to check ok() once at the end. */
+  class Cursor {
+   public:
+    Cursor(const char* begin, const char* end)
+      : m_p(begin), m_end(end), m_ok(true)
+    {}
+
+    bool ok() const { return m_ok; }
+
+    unsigned char u8() {
+      if (!require(1)) { return 0; }
+      return static_cast<unsigned char>(*m_p++);
+    }
+
+    std::uint64_t varint() {
+      std::uint64_t result = 0;
+      for (unsigned shift = 0; shift < 64; shift += 7) {
+        unsigned char byte = u8();
+        if (!m_ok) { return 0; }
+        result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) { return result; }
+      }
+      m_ok = false;
+      return 0;
+    }
+
+    double f64() {
+      if (!require(8)) { return 0.0; }
+      std::uint64_t bits = 0;
+      for (unsigned i = 0; i < 8; ++i) {
+        bits |= static_cast<std::uint64_t>(static_cast<unsigned char>(m_p[i])) << (8 * i);
+      }
+      m_p += 8;
+      double result;
+      std::memcpy(&result, &bits, sizeof(result));
+      return result;
+    }
+
+    std::string string() {
+      std::uint64_t n = varint();
+      if (!require(n)) { return std::string(); }
+      std::string result(m_p, static_cast<std::string::size_type>(n));
+      m_p += n;
+      return result;
+    }
+
+    openstudio::UUID uuid() {
+      if (!require(16)) { return openstudio::UUID(); }
+      openstudio::UUID result = QUuid::fromRfc4122(QByteArray::fromRawData(m_p, 16));
+      m_p += 16;
+      return result;
+    }
+
+    /** Splits off the next nested record. Returns false at a malformed record. */
+    bool record(unsigned char& tag, Cursor& payload) {
+      if (!require(recordHeaderSize)) { return false; }
+      tag = static_cast<unsigned char>(*m_p);
+      std::uint32_t n = getU32(m_p + 1);
+      m_p += recordHeaderSize;
+      if (!require(n)) { return false; }
+      payload = Cursor(m_p, m_p + n);
+      m_p += n;
+      return true;
+    }
+
+   private:
+    bool require(std::uint64_t n) {
+      if (!m_ok || (static_cast<std::uint64_t>(m_end - m_p) < n)) {
+        m_ok = false;
+        return false;
+      }
+      return true;
+    }
+
+    const char* m_p;
+    const char* m_end;
+    bool m_ok;
+  };
+
+  boost::optional<Attribute> getAttribute(unsigned char tag, Cursor& in, unsigned depth) {
+    unsigned char flags = in.u8();
+    openstudio::UUID uuid = in.uuid();
+    openstudio::UUID versionUUID = in.uuid();
+    std::string name = in.string();
+    boost::optional<std::string> displayName;
+    if (flags & hasDisplayNameFlag) { displayName = in.string(); }
+    boost::optional<std::string> units;
+    if (flags & hasUnitsFlag) { units = in.string(); }
+    std::string source;
+    if (flags & hasSourceFlag) { source = in.string(); }
+
+    boost::optional<Attribute> result;
+    switch (tag) {
+      case AttributeValueType::Boolean : {
+        bool value = (in.u8() != 0);
+        if (in.ok()) {
+          result = Attribute(uuid,versionUUID,name,displayName,value,units,source);
+        }
+        break;
+      }
+      case AttributeValueType::Double : {
+        double value = in.f64();
+        if (in.ok()) {
+          result = Attribute(uuid,versionUUID,name,displayName,value,units,source);
+        }
+        break;
+      }
+      case AttributeValueType::Quantity : {
+        double value = in.f64();
+        std::string quantityUnits = in.string();
+        if (in.ok()) {
+          if (OptionalQuantity quantity = createQuantity(value,quantityUnits)) {
+            result = Attribute(uuid,versionUUID,name,displayName,*quantity,source);
+          }
+        }
+        break;
+      }
+      case AttributeValueType::Unit : {
+        std::string unitString = in.string();
+        if (in.ok()) {
+          if (OptionalUnit unit = createUnit(unitString)) {
+            result = Attribute(uuid,versionUUID,name,displayName,*unit,source);
+          }
+        }
+        break;
+      }
+      case AttributeValueType::Integer : {
+        std::uint64_t zigzag = in.varint();
+        int value = static_cast<int>(static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1));
+        if (in.ok()) {
+          result = Attribute(uuid,versionUUID,name,displayName,value,units,source);
+        }
+        break;
+      }
+      case AttributeValueType::Unsigned : {
+        unsigned value = static_cast<unsigned>(in.varint());
+        if (in.ok()) {
+          result = Attribute(uuid,versionUUID,name,displayName,value,units,source);
+        }
+        break;
+      }
+      case AttributeValueType::String : {
+        std::string value = in.string();
+        if (in.ok()) {
+          result = Attribute(uuid,versionUUID,name,displayName,value,units,source);
+        }
+        break;
+      }
+      case AttributeValueType::AttributeVector : {
+        if (depth >= maxAttributeDepth) {
+          LOG_FREE(Error,"openstudio.BinaryAttributeReader","Attribute '" << name << "' is nested more than "
+                   << maxAttributeDepth << " levels deep.");
+          return boost::none;
+        }
+        std::uint64_t n = in.varint();
+        std::vector<Attribute> children;
+        for (std::uint64_t i = 0; in.ok() && (i < n); ++i) {
+          unsigned char childTag = 0;
+          Cursor childIn(nullptr,nullptr);
+          if (!in.record(childTag,childIn)) {
+            return boost::none;
+          }
+          if (!isKnownTag(childTag)) {
+            continue;
+          }
+          boost::optional<Attribute> child = getAttribute(childTag,childIn,depth + 1);
+          if (!child) {
+            return boost::none;
+          }
+          children.push_back(*child);
+        }
+        if (in.ok()) {
+          result = Attribute(uuid,versionUUID,name,displayName,children,units,source);
+        }
+        break;
+      }
+      default :
+        break;
+    }
+
+    return result;
+  }
+
+} // anonymous namespace
+
+BinaryAttributeWriter::BinaryAttributeWriter(std::ostream& os)
+  : m_os(os)
+{
+  m_os.write(binaryAttributeMagic, sizeof(binaryAttributeMagic));
+  m_os.put(static_cast<char>(binaryAttributeFormatVersion));
+}
+
+bool BinaryAttributeWriter::write(const Attribute& attribute) {
+  m_buffer.clear();
+  putRecord(m_buffer, attribute);
+  m_os.write(m_buffer.data(), m_buffer.size());
+  if (!m_os) {
+    LOG(Error,"Unable to write attribute '" << attribute.name() << "' to binary stream.");
+    return false;
+  }
+  return true;
+}
+
+bool BinaryAttributeWriter::good() const {
+  return m_os.good();
+}
+
+BinaryAttributeReader::BinaryAttributeReader(std::istream& is)
+  : m_is(is), m_good(false)
+{
+  char header[sizeof(binaryAttributeMagic) + 1];
+  if (!m_is.read(header, sizeof(header))) {
+    LOG(Error,"Binary attribute stream is too short to contain a header.");
+    return;
+  }
+  if (std::memcmp(header, binaryAttributeMagic, sizeof(binaryAttributeMagic)) != 0) {
+    LOG(Error,"Stream is not in the binary attribute format.");
+    return;
+  }
+  unsigned version = static_cast<unsigned char>(header[sizeof(binaryAttributeMagic)]);
+  if (version > binaryAttributeFormatVersion) {
+    LOG(Error,"Binary attribute format version " << version << " is newer than the supported "
+        << "version " << static_cast<unsigned>(binaryAttributeFormatVersion) << ".");
+    return;
+  }
+  m_good = true;
+}
+
+bool BinaryAttributeReader::good() const {
+  return m_good;
+}
+
+boost::optional<Attribute> BinaryAttributeReader::next() {
+  while (m_good) {
+    char recordHeader[recordHeaderSize];
+    m_is.read(recordHeader, recordHeaderSize);
+    if (m_is.gcount() == 0) {
+      // clean end of stream
+      return boost::none;
+    }
+    if (m_is.gcount() != static_cast<std::streamsize>(recordHeaderSize)) {
+      LOG(Error,"Binary attribute stream ends in the middle of a record header.");
+      m_good = false;
+      return boost::none;
+    }
+
+    unsigned char tag = static_cast<unsigned char>(recordHeader[0]);
+    std::uint32_t n = getU32(recordHeader + 1);
+    // a corrupt length fails at the end of the stream instead of allocating up to 4 GB up front
+    m_buffer.clear();
+    for (std::uint32_t remaining = n; remaining > 0; ) {
+      std::uint32_t chunk = std::min(remaining, maxReadChunkSize);
+      std::string::size_type pos = m_buffer.size();
+      m_buffer.resize(pos + chunk);
+      m_is.read(&m_buffer[pos], chunk);
+      if (m_is.gcount() != static_cast<std::streamsize>(chunk)) {
+        LOG(Error,"Binary attribute stream ends in the middle of a record.");
+        m_good = false;
+        return boost::none;
+      }
+      remaining -= chunk;
+    }
+
+    if (!isKnownTag(tag)) {
+      LOG(Debug,"Skipping binary attribute record with unknown tag " << static_cast<unsigned>(tag) << ".");
+      continue;
+    }
+
+    Cursor in(m_buffer.data(), m_buffer.data() + m_buffer.size());
+    boost::optional<Attribute> result = getAttribute(tag, in, 0);
+    if (!result) {
+      LOG(Error,"Unable to parse binary attribute record.");
+      m_good = false;
+    }
+    return result;
+  }
+  return boost::none;
+}
+
+bool saveBinary(const std::vector<Attribute>& attributes,
+                const openstudio::path& p,
+                bool overwrite)
+{
+  if (boost::filesystem::exists(p) && !overwrite) {
+    LOG_FREE(Error,"openstudio.Attribute","Binary attribute file " << toString(p)
+             << " already exists and overwrite is false.");
+    return false;
+  }
+
+  boost::filesystem::ofstream ofs(p, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!ofs) {
+    LOG_FREE(Error,"openstudio.Attribute","Could not open file " << toString(p) << " for writing.");
+    return false;
+  }
+
+  toBinary(attributes, ofs);
+  ofs.close();
+  return !ofs.fail();
+}
+
+std::ostream& toBinary(const std::vector<Attribute>& attributes, std::ostream& os) {
+  BinaryAttributeWriter writer(os);
+  for (const Attribute& attribute : attributes) {
+    if (!writer.write(attribute)) {
+      break;
+    }
+  }
+  return os;
+}
+
+std::string toBinary(const std::vector<Attribute>& attributes) {
+  std::stringstream ss;
+  toBinary(attributes, ss);
+  return ss.str();
+}
+
+std::vector<Attribute> attributesFromBinary(const openstudio::path& p) {
+  boost::filesystem::ifstream ifs(p, std::ios_base::in | std::ios_base::binary);
+  if (!ifs) {
+    LOG_FREE(Error,"openstudio.Attribute","Could not open file " << toString(p) << " for reading.");
+    return std::vector<Attribute>();
+  }
+  return attributesFromBinary(ifs);
+}
+
+std::vector<Attribute> attributesFromBinary(std::istream& is) {
+  std::vector<Attribute> result;
+  BinaryAttributeReader reader(is);
+  while (boost::optional<Attribute> attribute = reader.next()) {
+    result.push_back(*attribute);
+  }
+  return result;
+}
+
+std::vector<Attribute> attributesFromBinary(const std::string& bytes) {
+  std::stringstream ss(bytes);
+  return attributesFromBinary(ss);
+}
+
+} // openstudio
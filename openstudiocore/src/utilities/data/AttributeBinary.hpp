@@ -0,0 +1,113 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_DATA_ATTRIBUTEBINARY_HPP
+#define UTILITIES_DATA_ATTRIBUTEBINARY_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "Attribute.hpp"
+
+#include "../core/Logger.hpp"
+#include "../core/Path.hpp"
+
+#include <boost/optional.hpp>
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+/** BinaryAttributeWriter writes \link Attribute Attributes\endlink to a stream in the compact
+ *  binary attribute format. A stream starts with a short header (magic bytes and format
+ *  version) and is followed by any number of top-level attribute records. Each record is a
+ *  one byte AttributeValueType tag, a four byte little-endian payload length, and the payload
+ *  (uuids, name, optional display name, units and source, and the value). AttributeVector
+ *  payloads hold their children as nested records. Unlike the XML and JSON serializations,
+ *  uuid and version_uuid information is preserved, and numbers are stored without loss. */
+class UTILITIES_API BinaryAttributeWriter {
+ public:
+  /** Writes the format header to os. */
+  explicit BinaryAttributeWriter(std::ostream& os);
+
+  /** Appends attribute and all of its children to the stream as one top-level record. Returns
+   *  false if the stream is in a failed state. */
+  bool write(const Attribute& attribute);
+
+  bool good() const;
+
+ private:
+  REGISTER_LOGGER("openstudio.BinaryAttributeWriter");
+
+  std::ostream& m_os;
+  std::string m_buffer;
+};
+
+/** BinaryAttributeReader reads top-level \link Attribute Attributes\endlink one at a time from
+ *  a stream written by BinaryAttributeWriter, so that large result sets can be ingested
+ *  without holding the whole set in memory. Records with unknown tags are skipped. */
+class UTILITIES_API BinaryAttributeReader {
+ public:
+  /** Reads and checks the format header. */
+  explicit BinaryAttributeReader(std::istream& is);
+
+  /** Returns false if the header was not recognized or a record could not be parsed. Reaching
+   *  the end of the stream does not make the reader bad. */
+  bool good() const;
+
+  /** Returns the next top-level attribute, or boost::none at the end of the stream or on
+   *  error (in which case good() returns false). Attribute vectors nested more than 64 levels
+   *  deep are treated as errors. */
+  boost::optional<Attribute> next();
+
+ private:
+  REGISTER_LOGGER("openstudio.BinaryAttributeReader");
+
+  std::istream& m_is;
+  bool m_good;
+  std::string m_buffer;
+};
+
+/** Saves attributes to p in the compact binary attribute format. Returns false if p exists
+ *  and !overwrite, or if the file cannot be written. \relates Attribute */
+UTILITIES_API bool saveBinary(const std::vector<Attribute>& attributes,
+                              const openstudio::path& p,
+                              bool overwrite=false);
+
+/** Writes attributes to os in the compact binary attribute format. \relates Attribute */
+UTILITIES_API std::ostream& toBinary(const std::vector<Attribute>& attributes,
+                                     std::ostream& os);
+
+/** Returns attributes encoded in the compact binary attribute format. \relates Attribute */
+UTILITIES_API std::string toBinary(const std::vector<Attribute>& attributes);
+
+/** Deserializes the compact binary attribute format. Returns the attributes read before any
+ *  error. \relates Attribute */
+UTILITIES_API std::vector<Attribute> attributesFromBinary(const openstudio::path& p);
+
+/** Deserializes the compact binary attribute format. \relates Attribute */
+UTILITIES_API std::vector<Attribute> attributesFromBinary(std::istream& is);
+
+/** Deserializes the compact binary attribute format. \relates Attribute */
+UTILITIES_API std::vector<Attribute> attributesFromBinary(const std::string& bytes);
+
+} // openstudio
+
+#endif // UTILITIES_DATA_ATTRIBUTEBINARY_HPP
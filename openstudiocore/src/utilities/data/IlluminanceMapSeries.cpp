@@ -0,0 +1,181 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "IlluminanceMapSeries.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace openstudio {
+
+IlluminanceMapSeries::IlluminanceMapSeries()
+{}
+
+IlluminanceMapSeries::IlluminanceMapSeries(const Vector& x, const Vector& y)
+  : m_x(x), m_y(y)
+{}
+
+const Vector& IlluminanceMapSeries::x() const {
+  return m_x;
+}
+
+const Vector& IlluminanceMapSeries::y() const {
+  return m_y;
+}
+
+unsigned IlluminanceMapSeries::numPoints() const {
+  return m_x.size() * m_y.size();
+}
+
+unsigned IlluminanceMapSeries::numDateTimes() const {
+  return m_dateTimes.size();
+}
+
+const std::vector<DateTime>& IlluminanceMapSeries::dateTimes() const {
+  return m_dateTimes;
+}
+
+boost::optional<unsigned> IlluminanceMapSeries::dateTimeIndex(const DateTime& dateTime) const {
+  auto it = m_dateTimeIndices.find(dateTime);
+  if (it == m_dateTimeIndices.end()) {
+    return boost::none;
+  }
+  return it->second;
+}
+
+float* IlluminanceMapSeries::append(const DateTime& dateTime) {
+  unsigned timeIndex = m_dateTimes.size();
+  m_dateTimes.push_back(dateTime);
+  m_dateTimeIndices.insert(std::make_pair(dateTime, timeIndex));
+  m_values.resize(m_values.size() + numPoints(), 0.0f);
+  return values(timeIndex);
+}
+
+void IlluminanceMapSeries::reserve(unsigned numDateTimes) {
+  m_dateTimes.reserve(numDateTimes);
+  m_values.reserve(static_cast<size_t>(numDateTimes) * numPoints());
+}
+
+const float* IlluminanceMapSeries::values(unsigned timeIndex) const {
+  return m_values.data() + static_cast<size_t>(timeIndex) * numPoints();
+}
+
+float* IlluminanceMapSeries::values(unsigned timeIndex) {
+  return m_values.data() + static_cast<size_t>(timeIndex) * numPoints();
+}
+
+double IlluminanceMapSeries::value(unsigned timeIndex, unsigned i, unsigned j) const {
+  return values(timeIndex)[i * m_y.size() + j];
+}
+
+Matrix IlluminanceMapSeries::illuminanceMap(unsigned timeIndex) const {
+  if (timeIndex >= numDateTimes()) {
+    return Matrix();
+  }
+  Matrix result(m_x.size(), m_y.size());
+  std::copy(values(timeIndex), values(timeIndex) + numPoints(), result.data().begin());
+  return result;
+}
+
+Matrix IlluminanceMapSeries::illuminanceMap(const DateTime& dateTime) const {
+  boost::optional<unsigned> timeIndex = dateTimeIndex(dateTime);
+  if (!timeIndex) {
+    return Matrix();
+  }
+  return illuminanceMap(*timeIndex);
+}
+
+Matrix IlluminanceMapSeries::minimum() const {
+  if (m_dateTimes.empty()) {
+    return Matrix();
+  }
+  unsigned n = numPoints();
+  std::vector<float> result(values(0), values(0) + n);
+  for (unsigned t = 1; t < numDateTimes(); ++t) {
+    const float* v = values(t);
+    for (unsigned p = 0; p < n; ++p) {
+      result[p] = std::min(result[p], v[p]);
+    }
+  }
+  return toMatrix(std::vector<double>(result.begin(), result.end()));
+}
+
+Matrix IlluminanceMapSeries::maximum() const {
+  if (m_dateTimes.empty()) {
+    return Matrix();
+  }
+  unsigned n = numPoints();
+  std::vector<float> result(values(0), values(0) + n);
+  for (unsigned t = 1; t < numDateTimes(); ++t) {
+    const float* v = values(t);
+    for (unsigned p = 0; p < n; ++p) {
+      result[p] = std::max(result[p], v[p]);
+    }
+  }
+  return toMatrix(std::vector<double>(result.begin(), result.end()));
+}
+
+Matrix IlluminanceMapSeries::mean() const {
+  if (m_dateTimes.empty()) {
+    return Matrix();
+  }
+  unsigned n = numPoints();
+  std::vector<double> result(n, 0.0);
+  for (unsigned t = 0; t < numDateTimes(); ++t) {
+    const float* v = values(t);
+    for (unsigned p = 0; p < n; ++p) {
+      result[p] += v[p];
+    }
+  }
+  for (double& r : result) {
+    r /= numDateTimes();
+  }
+  return toMatrix(result);
+}
+
+Matrix IlluminanceMapSeries::fractionAtLeast(double threshold) const {
+  return fractionWithin(threshold, std::numeric_limits<double>::infinity());
+}
+
+Matrix IlluminanceMapSeries::fractionWithin(double lower, double upper) const {
+  if (m_dateTimes.empty()) {
+    return Matrix();
+  }
+  unsigned n = numPoints();
+  std::vector<unsigned> counts(n, 0);
+  for (unsigned t = 0; t < numDateTimes(); ++t) {
+    const float* v = values(t);
+    for (unsigned p = 0; p < n; ++p) {
+      counts[p] += ((v[p] >= lower) && (v[p] <= upper)) ? 1 : 0;
+    }
+  }
+  std::vector<double> result(n);
+  for (unsigned p = 0; p < n; ++p) {
+    result[p] = static_cast<double>(counts[p]) / numDateTimes();
+  }
+  return toMatrix(result);
+}
+
+Matrix IlluminanceMapSeries::toMatrix(const std::vector<double>& values) const {
+  Matrix result(m_x.size(), m_y.size());
+  std::copy(values.begin(), values.end(), result.data().begin());
+  return result;
+}
+
+} // openstudio
@@ -0,0 +1,123 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_DATA_ILLUMINANCEMAPSERIES_HPP
+#define UTILITIES_DATA_ILLUMINANCEMAPSERIES_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "Matrix.hpp"
+#include "Vector.hpp"
+#include "../time/DateTime.hpp"
+
+#include <boost/optional.hpp>
+
+#include <map>
+#include <vector>
+
+namespace openstudio {
+
+/** IlluminanceMapSeries stores a series of illuminance maps on one fixed grid of points. All
+ *  values are kept in a single contiguous array of floats with one block of x().size()*y().size()
+ *  values per date and time, within a block the value at x(i), y(j) is at index i*y().size() + j.
+ *  This is the same layout as a Matrix returned by SqlFile::illuminanceMap, so a block can be
+ *  used as a view of one map without copying. Aggregations over the whole series make one pass
+ *  over the array and return a Matrix with one value per point. */
+class UTILITIES_API IlluminanceMapSeries {
+ public:
+
+  IlluminanceMapSeries();
+
+  /** Grid with x.size() by y.size() points and no maps. */
+  IlluminanceMapSeries(const Vector& x, const Vector& y);
+
+  /** x positions of the grid, corresponding to the first index of each map */
+  const Vector& x() const;
+
+  /** y positions of the grid, corresponding to the second index of each map */
+  const Vector& y() const;
+
+  /** number of points in each map */
+  unsigned numPoints() const;
+
+  /** number of maps */
+  unsigned numDateTimes() const;
+
+  const std::vector<DateTime>& dateTimes() const;
+
+  /** index of the map at dateTime, if any */
+  boost::optional<unsigned> dateTimeIndex(const DateTime& dateTime) const;
+
+  /** Appends a map at dateTime with all values zero, returns a pointer to its numPoints()
+   *  values. Invalidates pointers previously returned by values. */
+  float* append(const DateTime& dateTime);
+
+  /** reserve storage for numDateTimes maps */
+  void reserve(unsigned numDateTimes);
+
+  /** pointer to the numPoints() values of the map at timeIndex */
+  const float* values(unsigned timeIndex) const;
+  float* values(unsigned timeIndex);
+
+  /** value at x(i), y(j) of the map at timeIndex */
+  double value(unsigned timeIndex, unsigned i, unsigned j) const;
+
+  /** copy of the map at timeIndex, empty if timeIndex is out of range */
+  Matrix illuminanceMap(unsigned timeIndex) const;
+
+  /** copy of the map at dateTime, empty if there is no map at dateTime */
+  Matrix illuminanceMap(const DateTime& dateTime) const;
+
+  /** @name Aggregations
+   *  Each aggregation returns a x().size() by y().size() Matrix, empty if there are no maps. */
+  //@{
+
+  /** minimum illuminance at each point */
+  Matrix minimum() const;
+
+  /** maximum illuminance at each point */
+  Matrix maximum() const;
+
+  /** mean illuminance at each point */
+  Matrix mean() const;
+
+  /** Fraction of maps with illuminance of at least threshold at each point, with threshold set
+   *  to the design illuminance this is the daylight autonomy. */
+  Matrix fractionAtLeast(double threshold) const;
+
+  /** Fraction of maps with illuminance from lower to upper inclusive at each point, with lower
+   *  of 100 lux and upper of 2000 lux this is the useful daylight illuminance. */
+  Matrix fractionWithin(double lower, double upper) const;
+
+  //@}
+
+ private:
+
+  Matrix toMatrix(const std::vector<double>& values) const;
+
+  Vector m_x;
+  Vector m_y;
+  std::vector<DateTime> m_dateTimes;
+  std::map<DateTime, unsigned> m_dateTimeIndices;
+  std::vector<float> m_values;
+};
+
+} // openstudio
+
+#endif // UTILITIES_DATA_ILLUMINANCEMAPSERIES_HPP
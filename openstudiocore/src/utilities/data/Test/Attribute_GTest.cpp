@@ -21,6 +21,9 @@
 #include "DataFixture.hpp"
 
 #include "../Attribute.hpp"
+#include "../AttributeBinary.hpp"
+#include "../../units/QuantityFactory.hpp"
+#include "../../units/UnitFactory.hpp"
 
 #include "../../core/Json.hpp"
 
@@ -29,6 +32,7 @@
 #include <boost/regex.hpp>
 
 #include <limits>
+#include <sstream>
 
 #include <OpenStudio.hxx>
 
@@ -469,3 +473,97 @@ TEST_F(DataFixture, Attribute_Source) {
   // order is not guaranteed
 
 }
+
+TEST_F(DataFixture, Attribute_BinarySerialization) {
+  openstudio::path binaryPath = openstudio::toPath("./report_attributes.osab");
+  if(boost::filesystem::exists(binaryPath)){
+    boost::filesystem::remove(binaryPath);
+  }
+
+  AttributeVector children;
+  children.push_back(Attribute("bool",true,std::string("flag")));
+  children.push_back(Attribute("double",0.1 + 0.2,std::string("W")));
+  children.push_back(Attribute("integer",-12345));
+  children.push_back(Attribute("unsigned",4000000000u));
+  children.push_back(Attribute("string","EnergyPlus-Windows-64 8.0.0.008, YMD=2013.10.02 16:22"));
+  children.push_back(Attribute("quantity",createQuantity(3.5,"m^2").get()));
+  children.push_back(Attribute("unit",createUnit("kg").get()));
+  children[1].setDisplayName("A Double");
+  children[2].setSource("measure");
+
+  AttributeVector attributes;
+  attributes.push_back(Attribute("Results",children));
+  attributes.push_back(Attribute("count",7));
+
+  // in memory and back
+  std::string bytes = toBinary(attributes);
+  AttributeVector attributesCopy = attributesFromBinary(bytes);
+  ASSERT_EQ(attributes.size(),attributesCopy.size());
+  for (unsigned i = 0; i < attributes.size(); ++i) {
+    EXPECT_TRUE(attributes[i] == attributesCopy[i]);
+    EXPECT_EQ(attributes[i].uuid(),attributesCopy[i].uuid());
+    EXPECT_EQ(attributes[i].versionUUID(),attributesCopy[i].versionUUID());
+  }
+  AttributeVector childrenCopy = attributesCopy[0].valueAsAttributeVector();
+  ASSERT_EQ(children.size(),childrenCopy.size());
+  for (unsigned i = 0; i < children.size(); ++i) {
+    EXPECT_EQ(children[i].valueType().value(),childrenCopy[i].valueType().value());
+    EXPECT_TRUE(children[i] == childrenCopy[i]);
+    EXPECT_EQ(children[i].uuid(),childrenCopy[i].uuid());
+    EXPECT_EQ(children[i].versionUUID(),childrenCopy[i].versionUUID());
+  }
+  EXPECT_DOUBLE_EQ(0.1 + 0.2,childrenCopy[1].valueAsDouble());
+  EXPECT_EQ(0.1 + 0.2,childrenCopy[1].valueAsDouble()); // bit-exact
+  ASSERT_TRUE(childrenCopy[1].displayName());
+  EXPECT_EQ("A Double",childrenCopy[1].displayName().get());
+  EXPECT_EQ("measure",childrenCopy[2].source());
+
+  // binary is smaller than xml
+  QDomDocument doc = Attribute("Results",attributes).toXml();
+  EXPECT_LT(bytes.size(),static_cast<size_t>(doc.toByteArray(-1).size()));
+
+  // file and back
+  EXPECT_TRUE(saveBinary(attributes,binaryPath));
+  EXPECT_FALSE(saveBinary(attributes,binaryPath));
+  EXPECT_TRUE(saveBinary(attributes,binaryPath,true));
+  attributesCopy = attributesFromBinary(binaryPath);
+  ASSERT_EQ(attributes.size(),attributesCopy.size());
+  EXPECT_TRUE(attributes[0] == attributesCopy[0]);
+
+  // streaming reader stops cleanly on truncated input
+  std::stringstream truncated(bytes.substr(0,bytes.size() - 2));
+  BinaryAttributeReader reader(truncated);
+  EXPECT_TRUE(reader.good());
+  OptionalAttribute first = reader.next();
+  ASSERT_TRUE(first);
+  EXPECT_EQ("Results",first->name());
+  EXPECT_FALSE(reader.next());
+  EXPECT_FALSE(reader.good());
+
+  // not a binary attribute stream
+  std::stringstream notBinary("<Attribute/>");
+  BinaryAttributeReader badReader(notBinary);
+  EXPECT_FALSE(badReader.good());
+  EXPECT_FALSE(badReader.next());
+
+  // record claiming a 4 GB payload in a short stream
+  std::string oversized = bytes.substr(0,5);
+  oversized += std::string(1,static_cast<char>(AttributeValueType::String));
+  oversized += std::string(4,static_cast<char>(0xFF));
+  oversized += "short";
+  std::stringstream oversizedStream(oversized);
+  BinaryAttributeReader oversizedReader(oversizedStream);
+  EXPECT_TRUE(oversizedReader.good());
+  EXPECT_FALSE(oversizedReader.next());
+  EXPECT_FALSE(oversizedReader.good());
+
+  // nesting is limited
+  Attribute nested("level",0);
+  for (unsigned i = 0; i < 100; ++i) {
+    nested = Attribute("level",AttributeVector(1,nested));
+  }
+  std::stringstream nestedStream(toBinary(AttributeVector(1,nested)));
+  BinaryAttributeReader nestedReader(nestedStream);
+  EXPECT_FALSE(nestedReader.next());
+  EXPECT_FALSE(nestedReader.good());
+}
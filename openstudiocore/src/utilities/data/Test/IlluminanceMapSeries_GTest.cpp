@@ -0,0 +1,78 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "DataFixture.hpp"
+
+#include "../IlluminanceMapSeries.hpp"
+
+using namespace openstudio;
+
+TEST_F(DataFixture,IlluminanceMapSeries)
+{
+  Vector x(3);
+  x[0] = 0.0; x[1] = 1.0; x[2] = 2.0;
+  Vector y(2);
+  y[0] = 0.0; y[1] = 1.0;
+
+  IlluminanceMapSeries series(x, y);
+  EXPECT_EQ(6u, series.numPoints());
+  EXPECT_EQ(0u, series.numDateTimes());
+  EXPECT_EQ(0u, series.minimum().size1());
+
+  // illuminance is 100*t + 10*i + j
+  std::vector<DateTime> dateTimes;
+  for (unsigned t = 0; t < 4; ++t) {
+    dateTimes.push_back(DateTime(Date(MonthOfYear::Jan, 1), Time(0, t + 1, 0, 0)));
+    float* values = series.append(dateTimes.back());
+    for (unsigned i = 0; i < 3; ++i) {
+      for (unsigned j = 0; j < 2; ++j) {
+        values[i*2 + j] = static_cast<float>(100*t + 10*i + j);
+      }
+    }
+  }
+  EXPECT_EQ(4u, series.numDateTimes());
+  EXPECT_TRUE(dateTimes == series.dateTimes());
+
+  ASSERT_TRUE(series.dateTimeIndex(dateTimes[2]));
+  EXPECT_EQ(2u, *series.dateTimeIndex(dateTimes[2]));
+  EXPECT_FALSE(series.dateTimeIndex(DateTime(Date(MonthOfYear::Feb, 1), Time(0, 1, 0, 0))));
+
+  Matrix map = series.illuminanceMap(dateTimes[2]);
+  ASSERT_EQ(3u, map.size1());
+  ASSERT_EQ(2u, map.size2());
+  EXPECT_DOUBLE_EQ(221.0, map(2, 1));
+  EXPECT_DOUBLE_EQ(210.0, series.value(2, 1, 0));
+  EXPECT_EQ(0u, series.illuminanceMap(4).size1());
+
+  Matrix minimum = series.minimum();
+  Matrix maximum = series.maximum();
+  Matrix mean = series.mean();
+  Matrix autonomy = series.fractionAtLeast(200.0);
+  Matrix udi = series.fractionWithin(100.0, 210.0);
+  for (unsigned i = 0; i < 3; ++i) {
+    for (unsigned j = 0; j < 2; ++j) {
+      EXPECT_DOUBLE_EQ(10*i + j, minimum(i, j));
+      EXPECT_DOUBLE_EQ(300 + 10*i + j, maximum(i, j));
+      EXPECT_DOUBLE_EQ(150 + 10*i + j, mean(i, j));
+      EXPECT_DOUBLE_EQ(0.5, autonomy(i, j));
+      EXPECT_DOUBLE_EQ((10*i + j <= 10) ? 0.5 : 0.25, udi(i, j));
+    }
+  }
+}
@@ -45,35 +45,35 @@ EpwDataPoint::EpwDataPoint() :
   m_hour(1),
   m_minute(0),
   m_dataSourceandUncertaintyFlags(""),
-  m_dryBulbTemperature("99.9"),
-  m_dewPointTemperature("99.9"),
-  m_relativeHumidity("999"),
-  m_atmosphericStationPressure("999999"),
-  m_extraterrestrialHorizontalRadiation("9999"),
-  m_extraterrestrialDirectNormalRadiation("9999"),
-  m_horizontalInfraredRadiationIntensity("9999"),
-  m_globalHorizontalRadiation("9999"),
-  m_directNormalRadiation("9999"),
-  m_diffuseHorizontalRadiation("9999"),
-  m_globalHorizontalIlluminance("999999"),
-  m_directNormalIlluminance("999999"),
-  m_diffuseHorizontalIlluminance("999999"),
-  m_zenithLuminance("9999"),
-  m_windDirection("999"),
-  m_windSpeed("999"),
+  m_dryBulbTemperature(99.9),
+  m_dewPointTemperature(99.9),
+  m_relativeHumidity(999),
+  m_atmosphericStationPressure(999999),
+  m_extraterrestrialHorizontalRadiation(9999),
+  m_extraterrestrialDirectNormalRadiation(9999),
+  m_horizontalInfraredRadiationIntensity(9999),
+  m_globalHorizontalRadiation(9999),
+  m_directNormalRadiation(9999),
+  m_diffuseHorizontalRadiation(9999),
+  m_globalHorizontalIlluminance(999999),
+  m_directNormalIlluminance(999999),
+  m_diffuseHorizontalIlluminance(999999),
+  m_zenithLuminance(9999),
+  m_windDirection(999),
+  m_windSpeed(999),
   m_totalSkyCover(99),
   m_opaqueSkyCover(99),
-  m_visibility("9999"),
-  m_ceilingHeight("99999"),
+  m_visibility(9999),
+  m_ceilingHeight(99999),
   m_presentWeatherObservation(0),
   m_presentWeatherCodes(0),
-  m_precipitableWater("999"),
-  m_aerosolOpticalDepth(".999"),
-  m_snowDepth("999"),
-  m_daysSinceLastSnowfall("99"),
-  m_albedo("999"),
-  m_liquidPrecipitationDepth("999"),
-  m_liquidPrecipitationQuantity("99")
+  m_precipitableWater(999),
+  m_aerosolOpticalDepth(0.999),
+  m_snowDepth(999),
+  m_daysSinceLastSnowfall(99),
+  m_albedo(999),
+  m_liquidPrecipitationDepth(999),
+  m_liquidPrecipitationQuantity(99)
 {}
 
 EpwDataPoint::EpwDataPoint(int year,int month,int day,int hour,int minute,
@@ -134,7 +134,18 @@ EpwDataPoint::EpwDataPoint(int year,int month,int day,int hour,int minute,
 boost::optional<EpwDataPoint> EpwDataPoint::fromEpwString(std::string line)
 {
   EpwDataPoint pt;
-  QStringList list = QString().fromStdString(line).split(',');
+  std::vector<std::string> list;
+  list.reserve(35);
+  std::string::size_type begin = 0;
+  while(true) {
+    std::string::size_type end = line.find(',', begin);
+    if(end == std::string::npos) {
+      list.push_back(line.substr(begin));
+      break;
+    }
+    list.push_back(line.substr(begin, end - begin));
+    begin = end + 1;
+  }
   // Require 35 items in the list
   if(list.size() < 35) {
     // JWD: Should this just use the entries that are there and fill in the rest as unavailable?
@@ -145,49 +156,49 @@ boost::optional<EpwDataPoint> EpwDataPoint::fromEpwString(std::string line)
     return boost::optional<EpwDataPoint>();
   }
   // Use the appropriate setter on each field
-  if(!pt.setYear(list[EpwDataField::Year].toStdString())) {
+  if(!pt.setYear(list[EpwDataField::Year])) {
     return boost::optional<EpwDataPoint>();
   }
-  if(!pt.setMonth(list[EpwDataField::Month].toStdString())) {
+  if(!pt.setMonth(list[EpwDataField::Month])) {
     return boost::optional<EpwDataPoint>();
   }
-  if(!pt.setDay(list[EpwDataField::Day].toStdString())) {
+  if(!pt.setDay(list[EpwDataField::Day])) {
     return boost::optional<EpwDataPoint>();
   }
-  if(!pt.setHour(list[EpwDataField::Hour].toStdString())) {
+  if(!pt.setHour(list[EpwDataField::Hour])) {
     return boost::optional<EpwDataPoint>();
   }
   // The minute field is not set here - it is set based upon the header data
-  pt.setDataSourceandUncertaintyFlags(list[EpwDataField::DataSourceandUncertaintyFlags].toStdString());
-  pt.setDryBulbTemperature(list[EpwDataField::DryBulbTemperature].toStdString());
-  pt.setDewPointTemperature(list[EpwDataField::DewPointTemperature].toStdString());
-  pt.setRelativeHumidity(list[EpwDataField::RelativeHumidity].toStdString());
-  pt.setAtmosphericStationPressure(list[EpwDataField::AtmosphericStationPressure].toStdString());
-  pt.setExtraterrestrialHorizontalRadiation(list[EpwDataField::ExtraterrestrialHorizontalRadiation].toStdString());
-  pt.setExtraterrestrialDirectNormalRadiation(list[EpwDataField::ExtraterrestrialDirectNormalRadiation].toStdString());
-  pt.setHorizontalInfraredRadiationIntensity(list[EpwDataField::HorizontalInfraredRadiationIntensity].toStdString());
-  pt.setGlobalHorizontalRadiation(list[EpwDataField::GlobalHorizontalRadiation].toStdString());
-  pt.setDirectNormalRadiation(list[EpwDataField::DirectNormalRadiation].toStdString());
-  pt.setDiffuseHorizontalRadiation(list[EpwDataField::DiffuseHorizontalRadiation].toStdString());
-  pt.setGlobalHorizontalIlluminance(list[EpwDataField::GlobalHorizontalIlluminance].toStdString());
-  pt.setDirectNormalIlluminance(list[EpwDataField::DirectNormalIlluminance].toStdString());
-  pt.setDiffuseHorizontalIlluminance(list[EpwDataField::DiffuseHorizontalIlluminance].toStdString());
-  pt.setZenithLuminance(list[EpwDataField::ZenithLuminance].toStdString());
-  pt.setWindDirection(list[EpwDataField::WindDirection].toStdString());
-  pt.setWindSpeed(list[EpwDataField::WindSpeed].toStdString());
-  pt.setTotalSkyCover(list[EpwDataField::TotalSkyCover].toStdString());
-  pt.setOpaqueSkyCover(list[EpwDataField::OpaqueSkyCover].toStdString());
-  pt.setVisibility(list[EpwDataField::Visibility].toStdString());
-  pt.setCeilingHeight(list[EpwDataField::CeilingHeight].toStdString());
-  pt.setPresentWeatherObservation(list[EpwDataField::PresentWeatherObservation].toStdString());
-  pt.setPresentWeatherCodes(list[EpwDataField::PresentWeatherCodes].toStdString());
-  pt.setPrecipitableWater(list[EpwDataField::PrecipitableWater].toStdString());
-  pt.setAerosolOpticalDepth(list[EpwDataField::AerosolOpticalDepth].toStdString());
-  pt.setSnowDepth(list[EpwDataField::SnowDepth].toStdString());
-  pt.setDaysSinceLastSnowfall(list[EpwDataField::DaysSinceLastSnowfall].toStdString());
-  pt.setAlbedo(list[EpwDataField::Albedo].toStdString());
-  pt.setLiquidPrecipitationDepth(list[EpwDataField::LiquidPrecipitationDepth].toStdString());
-  pt.setLiquidPrecipitationQuantity(list[EpwDataField::LiquidPrecipitationQuantity].toStdString());
+  pt.setDataSourceandUncertaintyFlags(list[EpwDataField::DataSourceandUncertaintyFlags]);
+  pt.setDryBulbTemperature(list[EpwDataField::DryBulbTemperature]);
+  pt.setDewPointTemperature(list[EpwDataField::DewPointTemperature]);
+  pt.setRelativeHumidity(list[EpwDataField::RelativeHumidity]);
+  pt.setAtmosphericStationPressure(list[EpwDataField::AtmosphericStationPressure]);
+  pt.setExtraterrestrialHorizontalRadiation(list[EpwDataField::ExtraterrestrialHorizontalRadiation]);
+  pt.setExtraterrestrialDirectNormalRadiation(list[EpwDataField::ExtraterrestrialDirectNormalRadiation]);
+  pt.setHorizontalInfraredRadiationIntensity(list[EpwDataField::HorizontalInfraredRadiationIntensity]);
+  pt.setGlobalHorizontalRadiation(list[EpwDataField::GlobalHorizontalRadiation]);
+  pt.setDirectNormalRadiation(list[EpwDataField::DirectNormalRadiation]);
+  pt.setDiffuseHorizontalRadiation(list[EpwDataField::DiffuseHorizontalRadiation]);
+  pt.setGlobalHorizontalIlluminance(list[EpwDataField::GlobalHorizontalIlluminance]);
+  pt.setDirectNormalIlluminance(list[EpwDataField::DirectNormalIlluminance]);
+  pt.setDiffuseHorizontalIlluminance(list[EpwDataField::DiffuseHorizontalIlluminance]);
+  pt.setZenithLuminance(list[EpwDataField::ZenithLuminance]);
+  pt.setWindDirection(list[EpwDataField::WindDirection]);
+  pt.setWindSpeed(list[EpwDataField::WindSpeed]);
+  pt.setTotalSkyCover(list[EpwDataField::TotalSkyCover]);
+  pt.setOpaqueSkyCover(list[EpwDataField::OpaqueSkyCover]);
+  pt.setVisibility(list[EpwDataField::Visibility]);
+  pt.setCeilingHeight(list[EpwDataField::CeilingHeight]);
+  pt.setPresentWeatherObservation(list[EpwDataField::PresentWeatherObservation]);
+  pt.setPresentWeatherCodes(list[EpwDataField::PresentWeatherCodes]);
+  pt.setPrecipitableWater(list[EpwDataField::PrecipitableWater]);
+  pt.setAerosolOpticalDepth(list[EpwDataField::AerosolOpticalDepth]);
+  pt.setSnowDepth(list[EpwDataField::SnowDepth]);
+  pt.setDaysSinceLastSnowfall(list[EpwDataField::DaysSinceLastSnowfall]);
+  pt.setAlbedo(list[EpwDataField::Albedo]);
+  pt.setLiquidPrecipitationDepth(list[EpwDataField::LiquidPrecipitationDepth]);
+  pt.setLiquidPrecipitationQuantity(list[EpwDataField::LiquidPrecipitationQuantity]);
   return boost::optional<EpwDataPoint>(pt);
 }
 
@@ -503,19 +514,19 @@ boost::optional<std::string> EpwDataPoint::toWthString()
     return boost::optional<std::string>();
   }
   double p = value.get();
-  output << m_atmosphericStationPressure;
+  output << QString("%1").arg(m_atmosphericStationPressure);
   if(!windSpeed())
   {
     LOG_FREE(Error,"openstudio.EpwFile",QString("Missing wind speed on %1 at %2").arg(date).arg(hms).toStdString());
     return boost::optional<std::string>();
   }
-  output << m_windSpeed;
+  output << QString("%1").arg(m_windSpeed);
   if(!windDirection())
   {
     LOG_FREE(Error,"openstudio.EpwFile",QString("Missing wind direction on %1 at %2").arg(date).arg(hms).toStdString());
     return boost::optional<std::string>();
   }
-  output << m_windDirection;
+  output << QString("%1").arg(m_windDirection);
   double pw;
   value = relativeHumidity();
   if(!value) // Don't have relative humidity - this has not been tested
@@ -719,7 +730,7 @@ void EpwDataPoint::setDataSourceandUncertaintyFlags(std::string dataSourceandUnc
 
 boost::optional<double> EpwDataPoint::dryBulbTemperature() const
 {
-  double value = m_dryBulbTemperature.toDouble();
+  double value = m_dryBulbTemperature;
   if(value == 99.9)
   {
     return boost::optional<double>();
@@ -731,10 +742,10 @@ bool EpwDataPoint::setDryBulbTemperature(double dryBulbTemperature)
 {
   if(-70 >= dryBulbTemperature)
   {
-    m_dryBulbTemperature = "99.9";
+    m_dryBulbTemperature = 99.9;
     return false;
   }
-  m_dryBulbTemperature = QString("%1").arg(dryBulbTemperature);
+  m_dryBulbTemperature = dryBulbTemperature;
   return true;
 }
 
@@ -744,7 +755,7 @@ bool EpwDataPoint::setDryBulbTemperature(std::string dryBulbTemperature)
   double value = QString().fromStdString(dryBulbTemperature).toDouble(&ok);
   if(!ok)
   {
-    m_dryBulbTemperature = "99.9";
+    m_dryBulbTemperature = 99.9;
     return false;
   }
   return setDryBulbTemperature(value);
@@ -752,7 +763,7 @@ bool EpwDataPoint::setDryBulbTemperature(std::string dryBulbTemperature)
 
 boost::optional<double> EpwDataPoint::dewPointTemperature() const
 {
-  double value = m_dewPointTemperature.toDouble();
+  double value = m_dewPointTemperature;
   if(value == 99.9)
   {
     return boost::optional<double>();
@@ -764,10 +775,10 @@ bool EpwDataPoint::setDewPointTemperature(double dewPointTemperature)
 {
   if(-70 >= dewPointTemperature)
   {
-    m_dewPointTemperature = "99.9";
+    m_dewPointTemperature = 99.9;
     return false;
   }
-  m_dewPointTemperature = QString("%1").arg(dewPointTemperature);
+  m_dewPointTemperature = dewPointTemperature;
   return true;
 }
 
@@ -777,7 +788,7 @@ bool EpwDataPoint::setDewPointTemperature(std::string dewPointTemperature)
   double value = QString().fromStdString(dewPointTemperature).toDouble(&ok);
   if(!ok)
   {
-    m_dewPointTemperature = "99.9";
+    m_dewPointTemperature = 99.9;
     return false;
   }
   return setDewPointTemperature(value);
@@ -785,7 +796,7 @@ bool EpwDataPoint::setDewPointTemperature(std::string dewPointTemperature)
 
 boost::optional<double> EpwDataPoint::relativeHumidity() const
 {
-  double value = m_relativeHumidity.toDouble();
+  double value = m_relativeHumidity;
   if(value == 999)
   {
     return boost::optional<double>();
@@ -797,10 +808,10 @@ bool EpwDataPoint::setRelativeHumidity(double relativeHumidity)
 {
   if(0 > relativeHumidity || 110 < relativeHumidity)
   {
-    m_relativeHumidity = "999";
+    m_relativeHumidity = 999;
     return false;
   }
-  m_relativeHumidity = QString("%1").arg(relativeHumidity);
+  m_relativeHumidity = relativeHumidity;
   return true;
 }
 
@@ -810,7 +821,7 @@ bool EpwDataPoint::setRelativeHumidity(std::string relativeHumidity)
   double value = QString().fromStdString(relativeHumidity).toDouble(&ok);
   if(!ok)
   {
-    m_relativeHumidity = "999";
+    m_relativeHumidity = 999;
     return false;
   }
   return setRelativeHumidity(value);
@@ -818,7 +829,7 @@ bool EpwDataPoint::setRelativeHumidity(std::string relativeHumidity)
 
 boost::optional<double> EpwDataPoint::atmosphericStationPressure() const
 {
-  double value = m_atmosphericStationPressure.toDouble();
+  double value = m_atmosphericStationPressure;
   if(value == 999999)
   {
     return boost::optional<double>();
@@ -830,10 +841,10 @@ bool EpwDataPoint::setAtmosphericStationPressure(double atmosphericStationPressu
 {
   if(31000 >= atmosphericStationPressure)
   {
-    m_atmosphericStationPressure = "999999";
+    m_atmosphericStationPressure = 999999;
     return false;
   }
-  m_atmosphericStationPressure = QString("%1").arg(atmosphericStationPressure);
+  m_atmosphericStationPressure = atmosphericStationPressure;
   return true;
 }
 
@@ -843,7 +854,7 @@ bool EpwDataPoint::setAtmosphericStationPressure(std::string atmosphericStationP
   double value = QString().fromStdString(atmosphericStationPressure).toDouble(&ok);
   if(!ok)
   {
-    m_atmosphericStationPressure = "999999";
+    m_atmosphericStationPressure = 999999;
     return false;
   }
   return setAtmosphericStationPressure(value);
@@ -851,7 +862,7 @@ bool EpwDataPoint::setAtmosphericStationPressure(std::string atmosphericStationP
 
 boost::optional<double> EpwDataPoint::extraterrestrialHorizontalRadiation() const
 {
-  double value = m_extraterrestrialHorizontalRadiation.toDouble();
+  double value = m_extraterrestrialHorizontalRadiation;
   if(value == 9999)
   {
     return boost::optional<double>();
@@ -863,10 +874,10 @@ bool EpwDataPoint::setExtraterrestrialHorizontalRadiation(double extraterrestria
 {
   if(0 > extraterrestrialHorizontalRadiation)
   {
-    m_extraterrestrialHorizontalRadiation = "9999";
+    m_extraterrestrialHorizontalRadiation = 9999;
     return false;
   }
-  m_extraterrestrialHorizontalRadiation = QString("%1").arg(extraterrestrialHorizontalRadiation);
+  m_extraterrestrialHorizontalRadiation = extraterrestrialHorizontalRadiation;
   return true;
 }
 
@@ -876,7 +887,7 @@ bool EpwDataPoint::setExtraterrestrialHorizontalRadiation(std::string extraterre
   double value = QString().fromStdString(extraterrestrialHorizontalRadiation).toDouble(&ok);
   if(!ok)
   {
-    m_extraterrestrialHorizontalRadiation = "9999";
+    m_extraterrestrialHorizontalRadiation = 9999;
     return false;
   }
   return setExtraterrestrialHorizontalRadiation(value);
@@ -884,7 +895,7 @@ bool EpwDataPoint::setExtraterrestrialHorizontalRadiation(std::string extraterre
 
 boost::optional<double> EpwDataPoint::extraterrestrialDirectNormalRadiation() const
 {
-  double value = m_extraterrestrialDirectNormalRadiation.toDouble();
+  double value = m_extraterrestrialDirectNormalRadiation;
   if(value == 9999)
   {
     return boost::optional<double>();
@@ -896,10 +907,10 @@ bool EpwDataPoint::setExtraterrestrialDirectNormalRadiation(double extraterrestr
 {
   if(0 > extraterrestrialDirectNormalRadiation)
   {
-    m_extraterrestrialDirectNormalRadiation = "9999";
+    m_extraterrestrialDirectNormalRadiation = 9999;
     return false;
   }
-  m_extraterrestrialDirectNormalRadiation = QString("%1").arg(extraterrestrialDirectNormalRadiation);
+  m_extraterrestrialDirectNormalRadiation = extraterrestrialDirectNormalRadiation;
   return true;
 }
 
@@ -909,7 +920,7 @@ bool EpwDataPoint::setExtraterrestrialDirectNormalRadiation(std::string extrater
   double value = QString().fromStdString(extraterrestrialDirectNormalRadiation).toDouble(&ok);
   if(!ok)
   {
-    m_extraterrestrialDirectNormalRadiation = "9999";
+    m_extraterrestrialDirectNormalRadiation = 9999;
     return false;
   }
   return setExtraterrestrialDirectNormalRadiation(value);
@@ -917,7 +928,7 @@ bool EpwDataPoint::setExtraterrestrialDirectNormalRadiation(std::string extrater
 
 boost::optional<double> EpwDataPoint::horizontalInfraredRadiationIntensity() const
 {
-  double value = m_horizontalInfraredRadiationIntensity.toDouble();
+  double value = m_horizontalInfraredRadiationIntensity;
   if(value == 9999)
   {
     return boost::optional<double>();
@@ -929,10 +940,10 @@ bool EpwDataPoint::setHorizontalInfraredRadiationIntensity(double horizontalInfr
 {
   if(0 > horizontalInfraredRadiationIntensity)
   {
-    m_horizontalInfraredRadiationIntensity = "9999";
+    m_horizontalInfraredRadiationIntensity = 9999;
     return false;
   }
-  m_horizontalInfraredRadiationIntensity = QString("%1").arg(horizontalInfraredRadiationIntensity);
+  m_horizontalInfraredRadiationIntensity = horizontalInfraredRadiationIntensity;
   return true;
 }
 
@@ -942,7 +953,7 @@ bool EpwDataPoint::setHorizontalInfraredRadiationIntensity(std::string horizonta
   double value = QString().fromStdString(horizontalInfraredRadiationIntensity).toDouble(&ok);
   if(!ok)
   {
-    m_horizontalInfraredRadiationIntensity = "9999";
+    m_horizontalInfraredRadiationIntensity = 9999;
     return false;
   }
   return setHorizontalInfraredRadiationIntensity(value);
@@ -950,7 +961,7 @@ bool EpwDataPoint::setHorizontalInfraredRadiationIntensity(std::string horizonta
 
 boost::optional<double> EpwDataPoint::globalHorizontalRadiation() const
 {
-  double value = m_globalHorizontalRadiation.toDouble();
+  double value = m_globalHorizontalRadiation;
   if(value == 9999)
   {
     return boost::optional<double>();
@@ -962,10 +973,10 @@ bool EpwDataPoint::setGlobalHorizontalRadiation(double globalHorizontalRadiation
 {
   if(0 > globalHorizontalRadiation)
   {
-    m_globalHorizontalRadiation = "9999";
+    m_globalHorizontalRadiation = 9999;
     return false;
   }
-  m_globalHorizontalRadiation = QString("%1").arg(globalHorizontalRadiation);
+  m_globalHorizontalRadiation = globalHorizontalRadiation;
   return true;
 }
 
@@ -975,7 +986,7 @@ bool EpwDataPoint::setGlobalHorizontalRadiation(std::string globalHorizontalRadi
   double value = QString().fromStdString(globalHorizontalRadiation).toDouble(&ok);
   if(!ok)
   {
-    m_globalHorizontalRadiation = "9999";
+    m_globalHorizontalRadiation = 9999;
     return false;
   }
   return setGlobalHorizontalRadiation(value);
@@ -983,7 +994,7 @@ bool EpwDataPoint::setGlobalHorizontalRadiation(std::string globalHorizontalRadi
 
 boost::optional<double> EpwDataPoint::directNormalRadiation() const
 {
-  double value = m_directNormalRadiation.toDouble();
+  double value = m_directNormalRadiation;
   if(value == 9999)
   {
     return boost::optional<double>();
@@ -995,10 +1006,10 @@ bool EpwDataPoint::setDirectNormalRadiation(double directNormalRadiation)
 {
   if(0 > directNormalRadiation)
   {
-    m_directNormalRadiation = "9999";
+    m_directNormalRadiation = 9999;
     return false;
   }
-  m_directNormalRadiation = QString("%1").arg(directNormalRadiation);
+  m_directNormalRadiation = directNormalRadiation;
   return true;
 }
 
@@ -1008,7 +1019,7 @@ bool EpwDataPoint::setDirectNormalRadiation(std::string directNormalRadiation)
   double value = QString().fromStdString(directNormalRadiation).toDouble(&ok);
   if(!ok)
   {
-    m_directNormalRadiation = "9999";
+    m_directNormalRadiation = 9999;
     return false;
   }
   return setDirectNormalRadiation(value);
@@ -1016,7 +1027,7 @@ bool EpwDataPoint::setDirectNormalRadiation(std::string directNormalRadiation)
 
 boost::optional<double> EpwDataPoint::diffuseHorizontalRadiation() const
 {
-  double value = m_diffuseHorizontalRadiation.toDouble();
+  double value = m_diffuseHorizontalRadiation;
   if(value == 9999)
   {
     return boost::optional<double>();
@@ -1028,10 +1039,10 @@ bool EpwDataPoint::setDiffuseHorizontalRadiation(double diffuseHorizontalRadiati
 {
   if(0 > diffuseHorizontalRadiation)
   {
-    m_diffuseHorizontalRadiation = "9999";
+    m_diffuseHorizontalRadiation = 9999;
     return false;
   }
-  m_diffuseHorizontalRadiation = QString("%1").arg(diffuseHorizontalRadiation);
+  m_diffuseHorizontalRadiation = diffuseHorizontalRadiation;
   return true;
 }
 
@@ -1041,7 +1052,7 @@ bool EpwDataPoint::setDiffuseHorizontalRadiation(std::string diffuseHorizontalRa
   double value = QString().fromStdString(diffuseHorizontalRadiation).toDouble(&ok);
   if(!ok)
   {
-    m_diffuseHorizontalRadiation = "9999";
+    m_diffuseHorizontalRadiation = 9999;
     return false;
   }
   return setDiffuseHorizontalRadiation(value);
@@ -1049,7 +1060,7 @@ bool EpwDataPoint::setDiffuseHorizontalRadiation(std::string diffuseHorizontalRa
 
 boost::optional<double> EpwDataPoint::globalHorizontalIlluminance() const
 {
-  double value = m_globalHorizontalIlluminance.toDouble();
+  double value = m_globalHorizontalIlluminance;
   if(value == 999999)
   {
     return boost::optional<double>();
@@ -1061,10 +1072,10 @@ bool EpwDataPoint::setGlobalHorizontalIlluminance(double globalHorizontalIllumin
 {
   if(0 > globalHorizontalIlluminance)
   {
-    m_globalHorizontalIlluminance = "999999";
+    m_globalHorizontalIlluminance = 999999;
     return false;
   }
-  m_globalHorizontalIlluminance = QString("%1").arg(globalHorizontalIlluminance);
+  m_globalHorizontalIlluminance = globalHorizontalIlluminance;
   return true;
 }
 
@@ -1074,7 +1085,7 @@ bool EpwDataPoint::setGlobalHorizontalIlluminance(std::string globalHorizontalIl
   double value = QString().fromStdString(globalHorizontalIlluminance).toDouble(&ok);
   if(!ok)
   {
-    m_globalHorizontalIlluminance = "999999";
+    m_globalHorizontalIlluminance = 999999;
     return false;
   }
   return setGlobalHorizontalIlluminance(value);
@@ -1082,7 +1093,7 @@ bool EpwDataPoint::setGlobalHorizontalIlluminance(std::string globalHorizontalIl
 
 boost::optional<double> EpwDataPoint::directNormalIlluminance() const
 {
-  double value = m_directNormalIlluminance.toDouble();
+  double value = m_directNormalIlluminance;
   if(value == 999999)
   {
     return boost::optional<double>();
@@ -1094,10 +1105,10 @@ bool EpwDataPoint::setDirectNormalIlluminance(double directNormalIlluminance)
 {
   if(0 > directNormalIlluminance)
   {
-    m_directNormalIlluminance = "999999";
+    m_directNormalIlluminance = 999999;
     return false;
   }
-  m_directNormalIlluminance = QString("%1").arg(directNormalIlluminance);
+  m_directNormalIlluminance = directNormalIlluminance;
   return true;
 }
 
@@ -1107,7 +1118,7 @@ bool EpwDataPoint::setDirectNormalIlluminance(std::string directNormalIlluminanc
   double value = QString().fromStdString(directNormalIlluminance).toDouble(&ok);
   if(!ok)
   {
-    m_directNormalIlluminance = "999999";
+    m_directNormalIlluminance = 999999;
     return false;
   }
   return setDirectNormalIlluminance(value);
@@ -1115,7 +1126,7 @@ bool EpwDataPoint::setDirectNormalIlluminance(std::string directNormalIlluminanc
 
 boost::optional<double> EpwDataPoint::diffuseHorizontalIlluminance() const
 {
-  double value = m_diffuseHorizontalIlluminance.toDouble();
+  double value = m_diffuseHorizontalIlluminance;
   if(value == 999999)
   {
     return boost::optional<double>();
@@ -1127,10 +1138,10 @@ bool EpwDataPoint::setDiffuseHorizontalIlluminance(double diffuseHorizontalIllum
 {
   if(0 > diffuseHorizontalIlluminance)
   {
-    m_diffuseHorizontalIlluminance = "999999";
+    m_diffuseHorizontalIlluminance = 999999;
     return false;
   }
-  m_diffuseHorizontalIlluminance = QString("%1").arg(diffuseHorizontalIlluminance);
+  m_diffuseHorizontalIlluminance = diffuseHorizontalIlluminance;
   return true;
 }
 
@@ -1140,7 +1151,7 @@ bool EpwDataPoint::setDiffuseHorizontalIlluminance(std::string diffuseHorizontal
   double value = QString().fromStdString(diffuseHorizontalIlluminance).toDouble(&ok);
   if(!ok)
   {
-    m_diffuseHorizontalIlluminance = "999999";
+    m_diffuseHorizontalIlluminance = 999999;
     return false;
   }
   return setDiffuseHorizontalIlluminance(value);
@@ -1148,7 +1159,7 @@ bool EpwDataPoint::setDiffuseHorizontalIlluminance(std::string diffuseHorizontal
 
 boost::optional<double> EpwDataPoint::zenithLuminance() const
 {
-  double value = m_zenithLuminance.toDouble();
+  double value = m_zenithLuminance;
   if(value == 9999)
   {
     return boost::optional<double>();
@@ -1160,10 +1171,10 @@ bool EpwDataPoint::setZenithLuminance(double zenithLuminance)
 {
   if(0 > zenithLuminance)
   {
-    m_zenithLuminance = "9999";
+    m_zenithLuminance = 9999;
     return false;
   }
-  m_zenithLuminance = QString("%1").arg(zenithLuminance);
+  m_zenithLuminance = zenithLuminance;
   return true;
 }
 
@@ -1173,7 +1184,7 @@ bool EpwDataPoint::setZenithLuminance(std::string zenithLuminance)
   double value = QString().fromStdString(zenithLuminance).toDouble(&ok);
   if(!ok)
   {
-    m_zenithLuminance = "9999";
+    m_zenithLuminance = 9999;
     return false;
   }
   return setZenithLuminance(value);
@@ -1181,7 +1192,7 @@ bool EpwDataPoint::setZenithLuminance(std::string zenithLuminance)
 
 boost::optional<double> EpwDataPoint::windDirection() const
 {
-  double value = m_windDirection.toDouble();
+  double value = m_windDirection;
   if(value == 999)
   {
     return boost::optional<double>();
@@ -1193,10 +1204,10 @@ bool EpwDataPoint::setWindDirection(double windDirection)
 {
   if(0 > windDirection || 360 < windDirection)
   {
-    m_windDirection = "999";
+    m_windDirection = 999;
     return false;
   }
-  m_windDirection = QString("%1").arg(windDirection);
+  m_windDirection = windDirection;
   return true;
 }
 
@@ -1206,7 +1217,7 @@ bool EpwDataPoint::setWindDirection(std::string windDirection)
   double value = QString().fromStdString(windDirection).toDouble(&ok);
   if(!ok)
   {
-    m_windDirection = "999";
+    m_windDirection = 999;
     return false;
   }
   return setWindDirection(value);
@@ -1214,7 +1225,7 @@ bool EpwDataPoint::setWindDirection(std::string windDirection)
 
 boost::optional<double> EpwDataPoint::windSpeed() const
 {
-  double value = m_windSpeed.toDouble();
+  double value = m_windSpeed;
   if(value == 999)
   {
     return boost::optional<double>();
@@ -1226,10 +1237,10 @@ bool EpwDataPoint::setWindSpeed(double windSpeed)
 {
   if(0 > windSpeed || 40 < windSpeed)
   {
-    m_windSpeed = "999";
+    m_windSpeed = 999;
     return false;
   }
-  m_windSpeed = QString("%1").arg(windSpeed);
+  m_windSpeed = windSpeed;
   return true;
 }
 
@@ -1239,7 +1250,7 @@ bool EpwDataPoint::setWindSpeed(std::string windSpeed)
   double value = QString().fromStdString(windSpeed).toDouble(&ok);
   if(!ok)
   {
-    m_windSpeed = "999";
+    m_windSpeed = 999;
     return false;
   }
   return setWindSpeed(value);
@@ -1303,7 +1314,7 @@ bool EpwDataPoint::setOpaqueSkyCover(std::string opaqueSkyCover)
 
 boost::optional<double> EpwDataPoint::visibility() const
 {
-  double value = m_visibility.toDouble();
+  double value = m_visibility;
   if(value == 9999)
   {
     return boost::optional<double>();
@@ -1313,25 +1324,25 @@ boost::optional<double> EpwDataPoint::visibility() const
 
 void EpwDataPoint::setVisibility(double visibility)
 {
-  m_visibility = QString("%1").arg(visibility);
+  m_visibility = visibility;
 }
 
 bool EpwDataPoint::setVisibility(std::string visibility)
 {
   bool ok;
-  QString().fromStdString(visibility).toDouble(&ok);
+  double value = QString().fromStdString(visibility).toDouble(&ok);
   if(!ok)
   {
-    m_visibility = "9999";
+    m_visibility = 9999;
     return false;
   }
-  m_visibility = QString().fromStdString(visibility);
+  m_visibility = value;
   return true;
 }
 
 boost::optional<double> EpwDataPoint::ceilingHeight() const
 {
-  double value = m_ceilingHeight.toDouble();
+  double value = m_ceilingHeight;
   if(value == 99999)
   {
     return boost::optional<double>();
@@ -1341,19 +1352,19 @@ boost::optional<double> EpwDataPoint::ceilingHeight() const
 
 void EpwDataPoint::setCeilingHeight(double ceilingHeight)
 {
-  m_ceilingHeight = QString("%1").arg(ceilingHeight);
+  m_ceilingHeight = ceilingHeight;
 }
 
 bool EpwDataPoint::setCeilingHeight(std::string ceilingHeight)
 {
   bool ok;
-  QString().fromStdString(ceilingHeight).toDouble(&ok);
+  double value = QString().fromStdString(ceilingHeight).toDouble(&ok);
   if(!ok)
   {
-    m_ceilingHeight = "99999";
+    m_ceilingHeight = 99999;
     return false;
   }
-  m_ceilingHeight = QString().fromStdString(ceilingHeight);
+  m_ceilingHeight = value;
   return true;
 }
 
@@ -1403,7 +1414,7 @@ bool EpwDataPoint::setPresentWeatherCodes(std::string presentWeatherCodes)
 
 boost::optional<double> EpwDataPoint::precipitableWater() const
 {
-  double value = m_precipitableWater.toDouble();
+  double value = m_precipitableWater;
   if(value == 999)
   {
     return boost::optional<double>();
@@ -1413,25 +1424,25 @@ boost::optional<double> EpwDataPoint::precipitableWater() const
 
 void EpwDataPoint::setPrecipitableWater(double precipitableWater)
 {
-  m_precipitableWater = QString("%1").arg(precipitableWater);
+  m_precipitableWater = precipitableWater;
 }
 
 bool EpwDataPoint::setPrecipitableWater(std::string precipitableWater)
 {
   bool ok;
-  QString().fromStdString(precipitableWater).toDouble(&ok);
+  double value = QString().fromStdString(precipitableWater).toDouble(&ok);
   if(!ok)
   {
-    m_precipitableWater = "999";
+    m_precipitableWater = 999;
     return false;
   }
-  m_precipitableWater = QString().fromStdString(precipitableWater);
+  m_precipitableWater = value;
   return true;
 }
 
 boost::optional<double> EpwDataPoint::aerosolOpticalDepth() const
 {
-  double value = m_aerosolOpticalDepth.toDouble();
+  double value = m_aerosolOpticalDepth;
   if(value == .999)
   {
     return boost::optional<double>();
@@ -1441,25 +1452,25 @@ boost::optional<double> EpwDataPoint::aerosolOpticalDepth() const
 
 void EpwDataPoint::setAerosolOpticalDepth(double aerosolOpticalDepth)
 {
-  m_aerosolOpticalDepth = QString("%1").arg(aerosolOpticalDepth);
+  m_aerosolOpticalDepth = aerosolOpticalDepth;
 }
 
 bool EpwDataPoint::setAerosolOpticalDepth(std::string aerosolOpticalDepth)
 {
   bool ok;
-  QString().fromStdString(aerosolOpticalDepth).toDouble(&ok);
+  double value = QString().fromStdString(aerosolOpticalDepth).toDouble(&ok);
   if(!ok)
   {
-    m_aerosolOpticalDepth = ".999";
+    m_aerosolOpticalDepth = 0.999;
     return false;
   }
-  m_aerosolOpticalDepth = QString().fromStdString(aerosolOpticalDepth);
+  m_aerosolOpticalDepth = value;
   return true;
 }
 
 boost::optional<double> EpwDataPoint::snowDepth() const
 {
-  double value = m_snowDepth.toDouble();
+  double value = m_snowDepth;
   if(value == 999)
   {
     return boost::optional<double>();
@@ -1469,25 +1480,25 @@ boost::optional<double> EpwDataPoint::snowDepth() const
 
 void EpwDataPoint::setSnowDepth(double snowDepth)
 {
-  m_snowDepth = QString("%1").arg(snowDepth);
+  m_snowDepth = snowDepth;
 }
 
 bool EpwDataPoint::setSnowDepth(std::string snowDepth)
 {
   bool ok;
-  QString().fromStdString(snowDepth).toDouble(&ok);
+  double value = QString().fromStdString(snowDepth).toDouble(&ok);
   if(!ok)
   {
-    m_snowDepth = "999";
+    m_snowDepth = 999;
     return false;
   }
-  m_snowDepth = QString().fromStdString(snowDepth);
+  m_snowDepth = value;
   return true;
 }
 
 boost::optional<double> EpwDataPoint::daysSinceLastSnowfall() const
 {
-  double value = m_daysSinceLastSnowfall.toDouble();
+  double value = m_daysSinceLastSnowfall;
   if(value == 99)
   {
     return boost::optional<double>();
@@ -1497,25 +1508,25 @@ boost::optional<double> EpwDataPoint::daysSinceLastSnowfall() const
 
 void EpwDataPoint::setDaysSinceLastSnowfall(double daysSinceLastSnowfall)
 {
-  m_daysSinceLastSnowfall = QString("%1").arg(daysSinceLastSnowfall);
+  m_daysSinceLastSnowfall = daysSinceLastSnowfall;
 }
 
 bool EpwDataPoint::setDaysSinceLastSnowfall(std::string daysSinceLastSnowfall)
 {
   bool ok;
-  QString().fromStdString(daysSinceLastSnowfall).toDouble(&ok);
+  double value = QString().fromStdString(daysSinceLastSnowfall).toDouble(&ok);
   if(!ok)
   {
-    m_daysSinceLastSnowfall = "99";
+    m_daysSinceLastSnowfall = 99;
     return false;
   }
-  m_daysSinceLastSnowfall = QString().fromStdString(daysSinceLastSnowfall);
+  m_daysSinceLastSnowfall = value;
   return true;
 }
 
 boost::optional<double> EpwDataPoint::albedo() const
 {
-  double value = m_albedo.toDouble();
+  double value = m_albedo;
   if(value == 999)
   {
     return boost::optional<double>();
@@ -1525,25 +1536,25 @@ boost::optional<double> EpwDataPoint::albedo() const
 
 void EpwDataPoint::setAlbedo(double albedo)
 {
-  m_albedo = QString("%1").arg(albedo);
+  m_albedo = albedo;
 }
 
 bool EpwDataPoint::setAlbedo(std::string albedo)
 {
   bool ok;
-  QString().fromStdString(albedo).toDouble(&ok);
+  double value = QString().fromStdString(albedo).toDouble(&ok);
   if(!ok)
   {
-    m_albedo = "999";
+    m_albedo = 999;
     return false;
   }
-  m_albedo = QString().fromStdString(albedo);
+  m_albedo = value;
   return true;
 }
 
 boost::optional<double> EpwDataPoint::liquidPrecipitationDepth() const
 {
-  double value = m_liquidPrecipitationDepth.toDouble();
+  double value = m_liquidPrecipitationDepth;
   if(value == 999)
   {
     return boost::optional<double>();
@@ -1553,25 +1564,25 @@ boost::optional<double> EpwDataPoint::liquidPrecipitationDepth() const
 
 void EpwDataPoint::setLiquidPrecipitationDepth(double liquidPrecipitationDepth)
 {
-  m_liquidPrecipitationDepth = QString("%1").arg(liquidPrecipitationDepth);
+  m_liquidPrecipitationDepth = liquidPrecipitationDepth;
 }
 
 bool EpwDataPoint::setLiquidPrecipitationDepth(std::string liquidPrecipitationDepth)
 {
   bool ok;
-  QString().fromStdString(liquidPrecipitationDepth).toDouble(&ok);
+  double value = QString().fromStdString(liquidPrecipitationDepth).toDouble(&ok);
   if(!ok)
   {
-    m_liquidPrecipitationDepth = "999";
+    m_liquidPrecipitationDepth = 999;
     return false;
   }
-  m_liquidPrecipitationDepth = QString().fromStdString(liquidPrecipitationDepth);
+  m_liquidPrecipitationDepth = value;
   return true;
 }
 
 boost::optional<double> EpwDataPoint::liquidPrecipitationQuantity() const
 {
-  double value = m_liquidPrecipitationQuantity.toDouble();
+  double value = m_liquidPrecipitationQuantity;
   if(value == 99)
   {
     return boost::optional<double>();
@@ -1581,24 +1592,37 @@ boost::optional<double> EpwDataPoint::liquidPrecipitationQuantity() const
 
 void EpwDataPoint::setLiquidPrecipitationQuantity(double liquidPrecipitationQuantity)
 {
-  m_liquidPrecipitationQuantity = QString("%1").arg(liquidPrecipitationQuantity);
+  m_liquidPrecipitationQuantity = liquidPrecipitationQuantity;
 }
 
 bool EpwDataPoint::setLiquidPrecipitationQuantity(std::string liquidPrecipitationQuantity)
 {
   bool ok;
-  QString().fromStdString(liquidPrecipitationQuantity).toDouble(&ok);
+  double value = QString().fromStdString(liquidPrecipitationQuantity).toDouble(&ok);
   if(!ok)
   {
-    m_liquidPrecipitationQuantity = "99";
+    m_liquidPrecipitationQuantity = 99;
     return false;
   }
-  m_liquidPrecipitationQuantity = QString().fromStdString(liquidPrecipitationQuantity);
+  m_liquidPrecipitationQuantity = value;
   return true;
 }
 
+// EPW missing value codes indexed by EpwDataField, integer fields and the date fields are never missing
+static const double epwMissingValues[] = {
+  0, 0, 0, 0, 0, 0,                   // Year through DataSourceandUncertaintyFlags
+  99.9, 99.9, 999, 999999,            // DryBulbTemperature through AtmosphericStationPressure
+  9999, 9999, 9999, 9999, 9999, 9999, // ExtraterrestrialHorizontalRadiation through DiffuseHorizontalRadiation
+  999999, 999999, 999999, 9999,       // GlobalHorizontalIlluminance through ZenithLuminance
+  999, 999, 99, 99,                   // WindDirection through OpaqueSkyCover
+  9999, 99999, 0, 0,                  // Visibility through PresentWeatherCodes
+  999, .999, 999, 99,                 // PrecipitableWater through DaysSinceLastSnowfall
+  999, 999, 99                        // Albedo through LiquidPrecipitationQuantity
+};
+
 EpwFile::EpwFile(const openstudio::path& p, bool storeData)
-  : m_path(p), m_latitude(0), m_longitude(0), m_timeZone(0), m_elevation(0)
+  : m_path(p), m_latitude(0), m_longitude(0), m_timeZone(0), m_elevation(0),
+    m_columns(EpwDataField::getValues().size()), m_missing(EpwDataField::getValues().size())
 {
   if (!parse(storeData)){
     LOG_AND_THROW("EpwFile '" << toString(p) << "' cannot be processed");
@@ -1708,21 +1732,41 @@ boost::optional<int> EpwFile::endDateActualYear() const
 
 std::vector<EpwDataPoint> EpwFile::data()
 {
-  if(m_data.size()==0){
-    if (!parse(true)){
-      LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
+  std::vector<EpwDataPoint> result;
+  if (ensureData()){
+    unsigned n = numDataRecords();
+    result.reserve(n);
+    for (unsigned i = 0; i < n; ++i){
+      result.push_back(dataPoint(i));
     }
   }
-  return m_data;
+  return result;
+}
+
+unsigned EpwFile::numDataRecords()
+{
+  if (!ensureData()){
+    return 0;
+  }
+  return m_dataSourceandUncertaintyFlags.size();
+}
+
+const std::vector<double>& EpwFile::column(EpwDataField field)
+{
+  ensureData();
+  return m_columns[field.value()];
+}
+
+const std::vector<bool>& EpwFile::missingValues(EpwDataField field)
+{
+  ensureData();
+  return m_missing[field.value()];
 }
 
 boost::optional<TimeSeries> EpwFile::getTimeSeries(std::string name)
 {
-  if(m_data.size()==0){
-    if (!parse(true)){
-      LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
-      return boost::optional<TimeSeries>();
-    }
+  if (!ensureData()){
+    return boost::optional<TimeSeries>();
   }
   EpwDataField id;
   try
@@ -1734,20 +1778,32 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(std::string name)
     // Could do a warning message here
     return boost::optional<TimeSeries>();
   }
-  if(m_data.size())
+  unsigned n = numDataRecords();
+  if(n)
   {
     std::string units = EpwDataPoint::units(id);
+    // the date fields and the flags are not weather data
+    if (id.value() <= EpwDataField::DataSourceandUncertaintyFlags){
+      return boost::optional<TimeSeries>();
+    }
+    const std::vector<double>& months = column(EpwDataField::Month);
+    const std::vector<double>& days = column(EpwDataField::Day);
+    const std::vector<double>& hours = column(EpwDataField::Hour);
+    const std::vector<double>& minutes = column(EpwDataField::Minute);
+    const std::vector<double>& fieldValues = column(id);
+    const std::vector<bool>& fieldMissing = missingValues(id);
     DateTimeVector dates;
     std::vector<double> values;
-    for(unsigned int i=0;i<m_data.size();i++)
+    dates.reserve(n);
+    values.reserve(n);
+    for(unsigned int i=0;i<n;i++)
     {
-      Date date=m_data[i].date();
-      Time time=m_data[i].time();
-      boost::optional<double> value = m_data[i].field(id);
-      if(value)
+      if(!fieldMissing[i])
       {
+        Date date(MonthOfYear(static_cast<int>(months[i])),static_cast<int>(days[i]));
+        Time time(0,static_cast<int>(hours[i]),static_cast<int>(minutes[i]));
         dates.push_back(DateTime(date,time));
-        values.push_back(value.get());
+        values.push_back(fieldValues[i]);
       }
     }
     if(dates.size())
@@ -1760,13 +1816,9 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(std::string name)
 
 bool EpwFile::translateToWth(openstudio::path path, std::string description)
 {
-  if(m_data.size()==0)
+  if(!ensureData())
   {
-    if (!parse(true))
-    {
-      LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
-      return false;
-    }
+    return false;
   }
 
   if(description.empty())
@@ -1774,7 +1826,8 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description)
     description = "Translated from " + openstudio::toString(this->path());
   }
 
-  if(!data().size())
+  std::vector<EpwDataPoint> points = data();
+  if(!points.size())
   {
     LOG(Error, "EPW file contains no data to translate");
     return false;
@@ -1810,8 +1863,8 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description)
   }
 
   // Cheat to get data at the start time - this will need to change
-  openstudio::EpwDataPoint firstPt = data()[data().size()-1];
-  openstudio::DateTime dateTime = data()[0].dateTime();
+  openstudio::EpwDataPoint firstPt = points[points.size()-1];
+  openstudio::DateTime dateTime = points[0].dateTime();
   openstudio::Time dt = timeStep();
   dateTime -= dt;
   firstPt.setDateTime(dateTime);
@@ -1824,8 +1877,8 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description)
     return false;
   }
   stream << output.get() << '\n';
-  for(unsigned int i=0;i<data().size();i++) {
-    output = data()[i].toWthString();
+  for(unsigned int i=0;i<points.size();i++) {
+    output = points[i].toWthString();
     if(!output) {
       LOG(Error, "Translation to WTH has failed");
       fp.close();
@@ -1898,14 +1951,20 @@ bool EpwFile::parse(bool storeData)
   OS_ASSERT((60 % m_recordsPerHour) == 0);
   int minutesPerRecord = 60/m_recordsPerHour;
   int currentMinute = 0;
+  if(storeData)
+  {
+    clearData();
+  }
   while(std::getline(ifs, line)){
     lineNumber++;
-    boost::regex dateRegex("^(.*?),(.*?),(.*?),.*");
-    boost::smatch matches;
-    if (boost::regex_search(line, matches, dateRegex)){
-      std::string year = std::string(matches[1].first, matches[1].second); boost::trim(year);
-      std::string month = std::string(matches[2].first, matches[2].second); boost::trim(month);
-      std::string day = std::string(matches[3].first, matches[3].second); boost::trim(day);
+    // only the year, month, and day are needed unless data is stored
+    std::string::size_type yearEnd = line.find(',');
+    std::string::size_type monthEnd = (yearEnd == std::string::npos) ? yearEnd : line.find(',', yearEnd + 1);
+    std::string::size_type dayEnd = (monthEnd == std::string::npos) ? monthEnd : line.find(',', monthEnd + 1);
+    if (dayEnd != std::string::npos){
+      std::string year = line.substr(0, yearEnd); boost::trim(year);
+      std::string month = line.substr(yearEnd + 1, monthEnd - yearEnd - 1); boost::trim(month);
+      std::string day = line.substr(monthEnd + 1, dayEnd - monthEnd - 1); boost::trim(day);
 
       try{
         Date date(boost::lexical_cast<int>(month), boost::lexical_cast<int>(day), boost::lexical_cast<int>(year));
@@ -1929,30 +1988,37 @@ bool EpwFile::parse(bool storeData)
       }catch(...){
         LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
         ifs.close();
+        if(storeData) {
+          clearData();
+        }
         return false;
       }
       if(storeData)
       {
         boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwString(line);
-        if(m_recordsPerHour!=1)
-        {
-          currentMinute += minutesPerRecord;
-          if(currentMinute >= 60) { // This could really be ==, but >= is used for safety
-            currentMinute = 0;
-          }
-          pt->setMinute(currentMinute);
-        }
         if(pt) {
-          m_data.push_back(pt.get());
+          if(m_recordsPerHour!=1)
+          {
+            currentMinute += minutesPerRecord;
+            if(currentMinute >= 60) { // This could really be ==, but >= is used for safety
+              currentMinute = 0;
+            }
+            pt->setMinute(currentMinute);
+          }
+          appendDataPoint(pt.get());
         } else {
           LOG(Error,"Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
           ifs.close();
+          clearData();
           return false;
         }
       }
     }else{
       LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
       ifs.close();
+      if(storeData) {
+        clearData();
+      }
       return false;
     }
   }
@@ -2000,6 +2066,92 @@ bool EpwFile::parse(bool storeData)
   return result;
 }
 
+bool EpwFile::ensureData()
+{
+  if(m_dataSourceandUncertaintyFlags.empty()){
+    if (!parse(true)){
+      LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
+      return false;
+    }
+  }
+  return true;
+}
+
+void EpwFile::clearData()
+{
+  for(unsigned i = 0; i < m_columns.size(); ++i){
+    m_columns[i].clear();
+    m_missing[i].clear();
+  }
+  m_dataSourceandUncertaintyFlags.clear();
+}
+
+void EpwFile::appendDataPoint(EpwDataPoint& dataPoint)
+{
+  m_columns[EpwDataField::Year].push_back(dataPoint.year());
+  m_columns[EpwDataField::Month].push_back(dataPoint.month());
+  m_columns[EpwDataField::Day].push_back(dataPoint.day());
+  m_columns[EpwDataField::Hour].push_back(dataPoint.hour());
+  m_columns[EpwDataField::Minute].push_back(dataPoint.minute());
+  for(int i = EpwDataField::Year; i <= EpwDataField::Minute; ++i){
+    m_missing[i].push_back(false);
+  }
+
+  m_columns[EpwDataField::DataSourceandUncertaintyFlags].push_back(0);
+  m_missing[EpwDataField::DataSourceandUncertaintyFlags].push_back(true);
+  m_dataSourceandUncertaintyFlags.push_back(dataPoint.dataSourceandUncertaintyFlags());
+
+  for(unsigned i = EpwDataField::DryBulbTemperature; i < m_columns.size(); ++i){
+    boost::optional<double> value = dataPoint.field(EpwDataField(i));
+    m_columns[i].push_back(value ? value.get() : epwMissingValues[i]);
+    m_missing[i].push_back(!value);
+  }
+}
+
+EpwDataPoint EpwFile::dataPoint(unsigned record) const
+{
+  // missing values are stored as their missing value code, which the setters keep as missing
+  std::vector<double> values(m_columns.size());
+  for(unsigned i = 0; i < m_columns.size(); ++i){
+    values[i] = m_columns[i][record];
+  }
+  return EpwDataPoint(static_cast<int>(values[EpwDataField::Year]),
+    static_cast<int>(values[EpwDataField::Month]),
+    static_cast<int>(values[EpwDataField::Day]),
+    static_cast<int>(values[EpwDataField::Hour]),
+    static_cast<int>(values[EpwDataField::Minute]),
+    m_dataSourceandUncertaintyFlags[record],
+    values[EpwDataField::DryBulbTemperature],
+    values[EpwDataField::DewPointTemperature],
+    values[EpwDataField::RelativeHumidity],
+    values[EpwDataField::AtmosphericStationPressure],
+    values[EpwDataField::ExtraterrestrialHorizontalRadiation],
+    values[EpwDataField::ExtraterrestrialDirectNormalRadiation],
+    values[EpwDataField::HorizontalInfraredRadiationIntensity],
+    values[EpwDataField::GlobalHorizontalRadiation],
+    values[EpwDataField::DirectNormalRadiation],
+    values[EpwDataField::DiffuseHorizontalRadiation],
+    values[EpwDataField::GlobalHorizontalIlluminance],
+    values[EpwDataField::DirectNormalIlluminance],
+    values[EpwDataField::DiffuseHorizontalIlluminance],
+    values[EpwDataField::ZenithLuminance],
+    values[EpwDataField::WindDirection],
+    values[EpwDataField::WindSpeed],
+    static_cast<int>(values[EpwDataField::TotalSkyCover]),
+    static_cast<int>(values[EpwDataField::OpaqueSkyCover]),
+    values[EpwDataField::Visibility],
+    values[EpwDataField::CeilingHeight],
+    static_cast<int>(values[EpwDataField::PresentWeatherObservation]),
+    static_cast<int>(values[EpwDataField::PresentWeatherCodes]),
+    values[EpwDataField::PrecipitableWater],
+    values[EpwDataField::AerosolOpticalDepth],
+    values[EpwDataField::SnowDepth],
+    values[EpwDataField::DaysSinceLastSnowfall],
+    values[EpwDataField::Albedo],
+    values[EpwDataField::LiquidPrecipitationDepth],
+    values[EpwDataField::LiquidPrecipitationQuantity]);
+}
+
 bool EpwFile::parseLocation(const std::string& line)
 {
   bool result = true;
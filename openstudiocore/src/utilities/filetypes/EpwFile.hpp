@@ -72,8 +72,8 @@ OPENSTUDIO_ENUM(EpwDataField,
   ((LiquidPrecipitationQuantity)(Liquid Precipitation Quantity))
 );
 
-/** EpwDataPoint is one line from the EPW file. All floating point numbers are stored as strings,
-* but are checked as numbers.
+/** EpwDataPoint is one line from the EPW file. All floating point numbers are stored as doubles,
+* missing values are stored as the EPW missing value code of the field.
 */
 class UTILITIES_API EpwDataPoint
 {
@@ -217,35 +217,35 @@ private:
   int m_hour;
   int m_minute;
   std::string m_dataSourceandUncertaintyFlags;
-  QString m_dryBulbTemperature; // units C, minimum> -70, maximum< 70, missing 99.9
-  QString m_dewPointTemperature; // units C, minimum> -70, maximum< 70, missing 99.9
-  QString m_relativeHumidity; // missing 999., minimum 0, maximum 110
-  QString m_atmosphericStationPressure; // units Pa, missing 999999.,  minimum> 31000, maximum< 120000
-  QString m_extraterrestrialHorizontalRadiation; // units Wh/m2, missing 9999., minimum 0
-  QString m_extraterrestrialDirectNormalRadiation; //units Wh/m2, missing 9999., minimum 0
-  QString m_horizontalInfraredRadiationIntensity; // units Wh/m2, missing 9999., minimum 0
-  QString m_globalHorizontalRadiation; // units Wh/m2, missing 9999., minimum 0
-  QString m_directNormalRadiation; // units Wh/m2, missing 9999., minimum 0
-  QString m_diffuseHorizontalRadiation; // units Wh/m2, missing 9999., minimum 0
-  QString m_globalHorizontalIlluminance; // units lux, missing 999999., note will be missing if >= 999900, minimum 0
-  QString m_directNormalIlluminance; // units lux, missing 999999., will be missing if >= 999900, minimum 0
-  QString m_diffuseHorizontalIlluminance; // units lux, missing 999999., will be missing if >= 999900, minimum 0
-  QString m_zenithLuminance; // units Cd/m2, missing 9999., will be missing if >= 9999, minimum 0
-  QString m_windDirection; // units degrees, missing 999., minimum 0, maximum 360
-  QString m_windSpeed; // units m/s, missing 999., minimum 0, maximum 40
+  double m_dryBulbTemperature; // units C, minimum> -70, maximum< 70, missing 99.9
+  double m_dewPointTemperature; // units C, minimum> -70, maximum< 70, missing 99.9
+  double m_relativeHumidity; // missing 999., minimum 0, maximum 110
+  double m_atmosphericStationPressure; // units Pa, missing 999999.,  minimum> 31000, maximum< 120000
+  double m_extraterrestrialHorizontalRadiation; // units Wh/m2, missing 9999., minimum 0
+  double m_extraterrestrialDirectNormalRadiation; //units Wh/m2, missing 9999., minimum 0
+  double m_horizontalInfraredRadiationIntensity; // units Wh/m2, missing 9999., minimum 0
+  double m_globalHorizontalRadiation; // units Wh/m2, missing 9999., minimum 0
+  double m_directNormalRadiation; // units Wh/m2, missing 9999., minimum 0
+  double m_diffuseHorizontalRadiation; // units Wh/m2, missing 9999., minimum 0
+  double m_globalHorizontalIlluminance; // units lux, missing 999999., note will be missing if >= 999900, minimum 0
+  double m_directNormalIlluminance; // units lux, missing 999999., will be missing if >= 999900, minimum 0
+  double m_diffuseHorizontalIlluminance; // units lux, missing 999999., will be missing if >= 999900, minimum 0
+  double m_zenithLuminance; // units Cd/m2, missing 9999., will be missing if >= 9999, minimum 0
+  double m_windDirection; // units degrees, missing 999., minimum 0, maximum 360
+  double m_windSpeed; // units m/s, missing 999., minimum 0, maximum 40
   int m_totalSkyCover; // missing 99, minimum 0, maximum 10
   int m_opaqueSkyCover; // used if Horizontal IR Intensity missing, missing 99, minimum 0, maximum 10
-  QString m_visibility; // units km, missing 9999
-  QString m_ceilingHeight; // units m, missing 99999
+  double m_visibility; // units km, missing 9999
+  double m_ceilingHeight; // units m, missing 99999
   int m_presentWeatherObservation;
   int m_presentWeatherCodes;
-  QString m_precipitableWater; // units mm, missing 999
-  QString m_aerosolOpticalDepth; // units thousandths, missing .999
-  QString m_snowDepth; // units cm, missing 999
-  QString m_daysSinceLastSnowfall; // missing 99
-  QString m_albedo; //missing 999
-  QString m_liquidPrecipitationDepth; // units mm, missing 999
-  QString m_liquidPrecipitationQuantity; // units hr, missing 99
+  double m_precipitableWater; // units mm, missing 999
+  double m_aerosolOpticalDepth; // units thousandths, missing .999
+  double m_snowDepth; // units cm, missing 999
+  double m_daysSinceLastSnowfall; // missing 99
+  double m_albedo; //missing 999
+  double m_liquidPrecipitationDepth; // units mm, missing 999
+  double m_liquidPrecipitationQuantity; // units hr, missing 99
 };
 
 /** EpwFile parses a weather file in EPW format.  Later it may provide
@@ -318,6 +318,16 @@ public:
   /// get the weather data
   std::vector<EpwDataPoint> data();
 
+  /// get the number of data records, parsing the data if it has not been stored
+  unsigned numDataRecords();
+
+  /// get the values of a weather field, one per data record, parsing the data if it has not been stored
+  /// records where the field is missing hold the EPW missing value code and are flagged in missingValues
+  const std::vector<double>& column(EpwDataField field);
+
+  /// get the flags marking data records where a weather field is missing
+  const std::vector<bool>& missingValues(EpwDataField field);
+
   /// get a time series of a particular weather field
   // This will probably need to include the period at some point, but for now just dump everything into a time series
   boost::optional<TimeSeries> getTimeSeries(std::string field);
@@ -331,6 +341,12 @@ private:
   bool parseLocation(const std::string& line);
   bool parseDataPeriod(const std::string& line);
 
+  // parse the data if it has not been stored
+  bool ensureData();
+  void appendDataPoint(EpwDataPoint& dataPoint);
+  void clearData();
+  EpwDataPoint dataPoint(unsigned record) const;
+
   // configure logging
   REGISTER_LOGGER("openstudio.EpwFile");
 
@@ -351,7 +367,10 @@ private:
   Date m_endDate;
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
-  std::vector<EpwDataPoint> m_data;
+  // weather data, one contiguous column of values and missing flags per EpwDataField
+  std::vector<std::vector<double> > m_columns;
+  std::vector<std::vector<bool> > m_missing;
+  std::vector<std::string> m_dataSourceandUncertaintyFlags;
 };
 
 UTILITIES_API IdfObject toIdfObject(const EpwFile& epwFile);
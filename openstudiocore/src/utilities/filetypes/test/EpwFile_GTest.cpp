@@ -134,6 +134,40 @@ TEST(Filetypes, EpwFile_Data)
   }
 }
 
+TEST(Filetypes, EpwFile_Columns)
+{
+  try{
+    path p = resourcesPath() / toPath("runmanager/USA_CO_Golden-NREL.724666_TMY3.epw");
+    EpwFile epwFile(p);
+    // Asking for a column parses the data
+    ASSERT_EQ(8760,epwFile.numDataRecords());
+    const std::vector<double>& dryBulb = epwFile.column(EpwDataField::DryBulbTemperature);
+    const std::vector<bool>& dryBulbMissing = epwFile.missingValues(EpwDataField::DryBulbTemperature);
+    ASSERT_EQ(8760,dryBulb.size());
+    ASSERT_EQ(8760,dryBulbMissing.size());
+    EXPECT_EQ(4.0,dryBulb[8759]);
+    EXPECT_FALSE(dryBulbMissing[8759]);
+    EXPECT_EQ(81100,epwFile.column(EpwDataField::AtmosphericStationPressure)[8759]);
+    EXPECT_EQ(12,epwFile.column(EpwDataField::Month)[8759]);
+    EXPECT_EQ(31,epwFile.column(EpwDataField::Day)[8759]);
+    // Missing values keep their missing value code
+    EXPECT_TRUE(epwFile.missingValues(EpwDataField::LiquidPrecipitationDepth)[8759]);
+    EXPECT_EQ(999,epwFile.column(EpwDataField::LiquidPrecipitationDepth)[8759]);
+    // Columns are views of the same data the data points are built from
+    std::vector<EpwDataPoint> data = epwFile.data();
+    ASSERT_EQ(8760,data.size());
+    const std::vector<double>& windSpeed = epwFile.column(EpwDataField::WindSpeed);
+    EXPECT_EQ(&windSpeed,&epwFile.column(EpwDataField::WindSpeed));
+    for(unsigned i=0;i<8760;i++) {
+      EXPECT_EQ(dryBulb[i],data[i].dryBulbTemperature().get());
+      EXPECT_EQ(windSpeed[i],data[i].windSpeed().get());
+    }
+    EXPECT_FALSE(data[8759].liquidPrecipitationDepth());
+  }catch(...){
+    ASSERT_TRUE(false);
+  }
+}
+
 TEST(Filetypes, EpwFile_International_Data)
 {
   try{
@@ -21,6 +21,8 @@
 
 #include "Point3d.hpp"
 
+#include <algorithm>
+
 namespace openstudio{
 
   BoundingBox::BoundingBox()
@@ -60,7 +62,7 @@ namespace openstudio{
     }
   }
 
-  bool BoundingBox::intersects(const BoundingBox& other, double tol)
+  bool BoundingBox::intersects(const BoundingBox& other, double tol) const
   {
     if (isEmpty() || other.isEmpty()){
       return false;
@@ -132,4 +134,40 @@ namespace openstudio{
     return result;
   }
 
+  std::vector<std::pair<unsigned, unsigned> > intersectingPairs(const std::vector<BoundingBox>& boxes, double tol)
+  {
+    std::vector<std::pair<unsigned, unsigned> > result;
+
+    // sort non-empty boxes by minimum x, ties keep index order
+    std::vector<unsigned> order;
+    order.reserve(boxes.size());
+    for (unsigned i = 0; i < boxes.size(); ++i){
+      if (!boxes[i].isEmpty()){
+        order.push_back(i);
+      }
+    }
+    std::stable_sort(order.begin(), order.end(), [&boxes](unsigned a, unsigned b){
+      return boxes[a].minX().get() < boxes[b].minX().get();
+    });
+
+    // boxes later in order have minimum x at least as large, so sweep until they start past this box
+    for (unsigned a = 0; a < order.size(); ++a){
+      const BoundingBox& box = boxes[order[a]];
+      double maxX = box.maxX().get() + tol;
+      for (unsigned b = a + 1; b < order.size(); ++b){
+        const BoundingBox& other = boxes[order[b]];
+        if (other.minX().get() > maxX){
+          break;
+        }
+        if (box.intersects(other, tol)){
+          result.push_back(std::make_pair(std::min(order[a], order[b]), std::max(order[a], order[b])));
+        }
+      }
+    }
+
+    std::sort(result.begin(), result.end());
+
+    return result;
+  }
+
 }
@@ -26,6 +26,8 @@
 
 #include <boost/optional.hpp>
 
+#include <vector>
+
 namespace openstudio{
 
   // forward declaration
@@ -50,7 +52,7 @@ namespace openstudio{
     void addPoints(const std::vector<Point3d>& points);
 
     /// test for intersection
-    bool intersects(const BoundingBox& other, double tol = 0.001);
+    bool intersects(const BoundingBox& other, double tol = 0.001) const;
 
     bool isEmpty() const;
 
@@ -83,6 +85,11 @@ namespace openstudio{
   // vector of BoundingBox
   typedef std::vector<BoundingBox> BoundingBoxVector;
 
+  /** Returns the index pairs (i, j), with i < j, of all boxes that intersect each other, sorted by i then j.
+   *  Boxes are swept in order of increasing minimum x so only boxes that overlap in x are tested against
+   *  each other, the result is the same as testing every pair with BoundingBox::intersects. */
+  UTILITIES_API std::vector<std::pair<unsigned, unsigned> > intersectingPairs(const std::vector<BoundingBox>& boxes, double tol = 0.001);
+
 } // openstudio
 
 #endif //UTILITIES_GEOMETRY_BOUNDINGBOX_HPP
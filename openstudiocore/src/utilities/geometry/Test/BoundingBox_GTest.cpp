@@ -139,3 +139,39 @@ TEST_F(GeometryFixture, BoundingBox_NoIntersection)
   EXPECT_FALSE(b1.intersects(b2));
   EXPECT_FALSE(b2.intersects(b1));
 }
+
+TEST_F(GeometryFixture, BoundingBox_IntersectingPairs)
+{
+  // a grid of unit boxes with gaps, boxes in the same row touch, plus an empty box
+  std::vector<BoundingBox> boxes;
+  for (unsigned i = 0; i < 5; ++i){
+    for (unsigned j = 0; j < 5; ++j){
+      BoundingBox box;
+      box.addPoint(Point3d(j, 2*i, 0));
+      box.addPoint(Point3d(j+1, 2*i+1, 1));
+      boxes.push_back(box);
+    }
+  }
+  boxes.push_back(BoundingBox());
+
+  // a box that spans the first column
+  BoundingBox column;
+  column.addPoint(Point3d(0.25, 0, 0));
+  column.addPoint(Point3d(0.75, 9, 1));
+  boxes.insert(boxes.begin() + 3, column);
+
+  std::vector<std::pair<unsigned, unsigned> > expected;
+  for (unsigned i = 0; i < boxes.size(); ++i){
+    for (unsigned j = i+1; j < boxes.size(); ++j){
+      if (boxes[i].intersects(boxes[j])){
+        expected.push_back(std::make_pair(i, j));
+      }
+    }
+  }
+
+  std::vector<std::pair<unsigned, unsigned> > pairs = intersectingPairs(boxes);
+  EXPECT_EQ(4u*5u + 5u, expected.size());
+  EXPECT_EQ(expected, pairs);
+
+  EXPECT_TRUE(intersectingPairs(std::vector<BoundingBox>()).empty());
+}
@@ -0,0 +1,180 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "IddBinary.hpp"
+
+#include <boost/cstdint.hpp>
+
+#include <stdexcept>
+
+namespace openstudio{
+namespace iddBinary{
+
+  namespace {
+
+    // guards against allocating absurd amounts of memory when reading a corrupt file
+    const boost::uint32_t maxLength = 1u << 26;
+
+    const boost::uint32_t byteOrderMarker = 0x01020304u;
+
+    template<typename T>
+    void writeRaw(std::ostream& os, const T& value) {
+      os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    T readRaw(std::istream& is) {
+      T result;
+      if (!is.read(reinterpret_cast<char*>(&result), sizeof(T))) {
+        throw std::runtime_error("Unexpected end of binary IDD data.");
+      }
+      return result;
+    }
+
+    boost::uint32_t readLength(std::istream& is) {
+      boost::uint32_t result = readRaw<boost::uint32_t>(is);
+      if (result > maxLength) {
+        throw std::runtime_error("Corrupt length in binary IDD data.");
+      }
+      return result;
+    }
+
+  }
+
+  const std::string& signature() {
+    static const std::string result("OpenStudioIddBinary");
+    return result;
+  }
+
+  unsigned formatVersion() {
+    return 1u;
+  }
+
+  void writeHeader(std::ostream& os) {
+    os.write(signature().data(), signature().size());
+    writeRaw(os, boost::uint32_t(formatVersion()));
+    writeRaw(os, byteOrderMarker);
+  }
+
+  bool readHeader(std::istream& is) {
+    std::string candidate(signature().size(), '\0');
+    if (!is.read(&candidate[0], candidate.size()) || (candidate != signature())) {
+      return false;
+    }
+    try {
+      if (readRaw<boost::uint32_t>(is) != formatVersion()) {
+        return false;
+      }
+      if (readRaw<boost::uint32_t>(is) != byteOrderMarker) {
+        return false;
+      }
+    }
+    catch (...) {
+      return false;
+    }
+    return true;
+  }
+
+  void writeUnsigned(std::ostream& os, unsigned value) {
+    writeRaw(os, boost::uint32_t(value));
+  }
+
+  unsigned readUnsigned(std::istream& is) {
+    return readRaw<boost::uint32_t>(is);
+  }
+
+  void writeBool(std::ostream& os, bool value) {
+    writeRaw(os, boost::uint8_t(value ? 1 : 0));
+  }
+
+  bool readBool(std::istream& is) {
+    return (readRaw<boost::uint8_t>(is) != 0);
+  }
+
+  void writeDouble(std::ostream& os, double value) {
+    writeRaw(os, value);
+  }
+
+  double readDouble(std::istream& is) {
+    return readRaw<double>(is);
+  }
+
+  void writeString(std::ostream& os, const std::string& value) {
+    writeRaw(os, boost::uint32_t(value.size()));
+    os.write(value.data(), value.size());
+  }
+
+  std::string readString(std::istream& is) {
+    std::string result(readLength(is), '\0');
+    if (!result.empty() && !is.read(&result[0], result.size())) {
+      throw std::runtime_error("Unexpected end of binary IDD data.");
+    }
+    return result;
+  }
+
+  void writeOptionalUnsigned(std::ostream& os, const boost::optional<unsigned>& value) {
+    writeBool(os, bool(value));
+    if (value) { writeUnsigned(os, *value); }
+  }
+
+  boost::optional<unsigned> readOptionalUnsigned(std::istream& is) {
+    boost::optional<unsigned> result;
+    if (readBool(is)) { result = readUnsigned(is); }
+    return result;
+  }
+
+  void writeOptionalDouble(std::ostream& os, const boost::optional<double>& value) {
+    writeBool(os, bool(value));
+    if (value) { writeDouble(os, *value); }
+  }
+
+  boost::optional<double> readOptionalDouble(std::istream& is) {
+    boost::optional<double> result;
+    if (readBool(is)) { result = readDouble(is); }
+    return result;
+  }
+
+  void writeOptionalString(std::ostream& os, const boost::optional<std::string>& value) {
+    writeBool(os, bool(value));
+    if (value) { writeString(os, *value); }
+  }
+
+  boost::optional<std::string> readOptionalString(std::istream& is) {
+    boost::optional<std::string> result;
+    if (readBool(is)) { result = readString(is); }
+    return result;
+  }
+
+  void writeStringVector(std::ostream& os, const std::vector<std::string>& values) {
+    writeRaw(os, boost::uint32_t(values.size()));
+    for (const std::string& value : values) {
+      writeString(os, value);
+    }
+  }
+
+  std::vector<std::string> readStringVector(std::istream& is) {
+    std::vector<std::string> result(readLength(is));
+    for (std::string& value : result) {
+      value = readString(is);
+    }
+    return result;
+  }
+
+} // iddBinary
+} // openstudio
@@ -0,0 +1,79 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_IDD_IDDBINARY_HPP
+#define UTILITIES_IDD_IDDBINARY_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <boost/optional.hpp>
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace openstudio{
+namespace iddBinary{
+
+  /** Primitive readers and writers for the compact binary IDD format written by
+   *  IddFile::saveBinary. Values are written in native byte order; the file header records a
+   *  byte order marker so that a file produced on a different architecture is rejected rather
+   *  than misread. All readers throw std::runtime_error on truncated or corrupt input. */
+
+  /// signature at the top of every binary IDD file
+  UTILITIES_API const std::string& signature();
+
+  /// binary layout version, bump whenever the layout of any Idd*_Impl::printBinary changes
+  UTILITIES_API unsigned formatVersion();
+
+  /// write the file signature, format version, and byte order marker
+  UTILITIES_API void writeHeader(std::ostream& os);
+
+  /// returns true if is starts with a header written by writeHeader
+  UTILITIES_API bool readHeader(std::istream& is);
+
+  UTILITIES_API void writeUnsigned(std::ostream& os, unsigned value);
+  UTILITIES_API unsigned readUnsigned(std::istream& is);
+
+  UTILITIES_API void writeBool(std::ostream& os, bool value);
+  UTILITIES_API bool readBool(std::istream& is);
+
+  UTILITIES_API void writeDouble(std::ostream& os, double value);
+  UTILITIES_API double readDouble(std::istream& is);
+
+  UTILITIES_API void writeString(std::ostream& os, const std::string& value);
+  UTILITIES_API std::string readString(std::istream& is);
+
+  UTILITIES_API void writeOptionalUnsigned(std::ostream& os, const boost::optional<unsigned>& value);
+  UTILITIES_API boost::optional<unsigned> readOptionalUnsigned(std::istream& is);
+
+  UTILITIES_API void writeOptionalDouble(std::ostream& os, const boost::optional<double>& value);
+  UTILITIES_API boost::optional<double> readOptionalDouble(std::istream& is);
+
+  UTILITIES_API void writeOptionalString(std::ostream& os, const boost::optional<std::string>& value);
+  UTILITIES_API boost::optional<std::string> readOptionalString(std::istream& is);
+
+  UTILITIES_API void writeStringVector(std::ostream& os, const std::vector<std::string>& values);
+  UTILITIES_API std::vector<std::string> readStringVector(std::istream& is);
+
+} // iddBinary
+} // openstudio
+
+#endif // UTILITIES_IDD_IDDBINARY_HPP
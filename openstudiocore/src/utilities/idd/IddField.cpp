@@ -21,6 +21,7 @@
 #include "IddField_Impl.hpp"
 
 #include "IddRegex.hpp"
+#include "IddBinary.hpp"
 #include "CommentRegex.hpp"
 #include <utilities/idd/IddFactory.hxx>
 
@@ -251,6 +252,90 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IddField_Impl> IddField_Impl::loadBinary(std::istream& is) {
+
+    std::shared_ptr<IddField_Impl> result;
+    IddField_Impl iddFieldImpl;
+
+    try {
+      iddFieldImpl.m_name = iddBinary::readString(is);
+      iddFieldImpl.m_fieldId = iddBinary::readString(is);
+      iddFieldImpl.m_objectName = iddBinary::readString(is);
+
+      IddFieldProperties& properties = iddFieldImpl.m_properties;
+      properties.type = IddFieldType(int(iddBinary::readUnsigned(is)));
+      properties.note = iddBinary::readString(is);
+      properties.required = iddBinary::readBool(is);
+      properties.autosizable = iddBinary::readBool(is);
+      properties.autocalculatable = iddBinary::readBool(is);
+      properties.retaincase = iddBinary::readBool(is);
+      properties.deprecated = iddBinary::readBool(is);
+      properties.beginExtensible = iddBinary::readBool(is);
+      properties.units = iddBinary::readOptionalString(is);
+      properties.ipUnits = iddBinary::readOptionalString(is);
+      properties.minBoundType = IddFieldProperties::BoundTypes(iddBinary::readUnsigned(is));
+      properties.minBoundValue = iddBinary::readOptionalDouble(is);
+      properties.minBoundText = iddBinary::readOptionalString(is);
+      properties.maxBoundType = IddFieldProperties::BoundTypes(iddBinary::readUnsigned(is));
+      properties.maxBoundValue = iddBinary::readOptionalDouble(is);
+      properties.maxBoundText = iddBinary::readOptionalString(is);
+      properties.stringDefault = iddBinary::readOptionalString(is);
+      properties.numericDefault = iddBinary::readOptionalDouble(is);
+      properties.objectLists = iddBinary::readStringVector(is);
+      properties.references = iddBinary::readStringVector(is);
+      properties.externalLists = iddBinary::readStringVector(is);
+
+      unsigned numKeys = iddBinary::readUnsigned(is);
+      for (unsigned i = 0; i < numKeys; ++i) {
+        OptionalIddKey key = IddKey::loadBinary(is);
+        if (!key) {
+          return result;
+        }
+        iddFieldImpl.m_keys.push_back(*key);
+      }
+    }
+    catch (...) { return result; }
+
+    result = std::shared_ptr<IddField_Impl>(new IddField_Impl(iddFieldImpl));
+    return result;
+  }
+
+  std::ostream& IddField_Impl::printBinary(std::ostream& os) const
+  {
+    iddBinary::writeString(os, m_name);
+    iddBinary::writeString(os, m_fieldId);
+    iddBinary::writeString(os, m_objectName);
+
+    iddBinary::writeUnsigned(os, m_properties.type.value());
+    iddBinary::writeString(os, m_properties.note);
+    iddBinary::writeBool(os, m_properties.required);
+    iddBinary::writeBool(os, m_properties.autosizable);
+    iddBinary::writeBool(os, m_properties.autocalculatable);
+    iddBinary::writeBool(os, m_properties.retaincase);
+    iddBinary::writeBool(os, m_properties.deprecated);
+    iddBinary::writeBool(os, m_properties.beginExtensible);
+    iddBinary::writeOptionalString(os, m_properties.units);
+    iddBinary::writeOptionalString(os, m_properties.ipUnits);
+    iddBinary::writeUnsigned(os, m_properties.minBoundType);
+    iddBinary::writeOptionalDouble(os, m_properties.minBoundValue);
+    iddBinary::writeOptionalString(os, m_properties.minBoundText);
+    iddBinary::writeUnsigned(os, m_properties.maxBoundType);
+    iddBinary::writeOptionalDouble(os, m_properties.maxBoundValue);
+    iddBinary::writeOptionalString(os, m_properties.maxBoundText);
+    iddBinary::writeOptionalString(os, m_properties.stringDefault);
+    iddBinary::writeOptionalDouble(os, m_properties.numericDefault);
+    iddBinary::writeStringVector(os, m_properties.objectLists);
+    iddBinary::writeStringVector(os, m_properties.references);
+    iddBinary::writeStringVector(os, m_properties.externalLists);
+
+    iddBinary::writeUnsigned(os, m_keys.size());
+    for (const IddKey& key : m_keys) {
+      key.printBinary(os);
+    }
+
+    return os;
+  }
+
   std::ostream& IddField_Impl::print(std::ostream& os, bool lastField) const
   {
     std::string separator = (lastField ? std::string(";") : std::string(","));
@@ -720,6 +805,17 @@ std::ostream& IddField::print(std::ostream& os, bool lastField) const
   return m_impl->print(os, lastField);
 }
 
+OptionalIddField IddField::loadBinary(std::istream& is) {
+  std::shared_ptr<detail::IddField_Impl> p = detail::IddField_Impl::loadBinary(is);
+  if (p) { return IddField(p); }
+  else { return boost::none; }
+}
+
+std::ostream& IddField::printBinary(std::ostream& os) const
+{
+  return m_impl->printBinary(os);
+}
+
 IddField::IddField(const std::shared_ptr<detail::IddField_Impl>& impl) : m_impl(impl) {}
 
 bool referencesEqual(const IddField& field1, const IddField& field2) {
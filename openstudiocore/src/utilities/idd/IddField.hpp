@@ -133,6 +133,12 @@ class UTILITIES_API IddField {
    *  comma will be used (consistent with IDD formatting). */
   std::ostream& print(std::ostream& os, bool lastField) const;
 
+  /** Load from the compact binary format written by printBinary. */
+  static boost::optional<IddField> loadBinary(std::istream& is);
+
+  /** Print the IddField to os in the compact binary format used by IddFile::saveBinary. */
+  std::ostream& printBinary(std::ostream& os) const;
+
   //@}
  private:
   ///@cond
@@ -126,6 +126,12 @@ namespace detail {
      *  comma will be used (consistent with IDD formatting). */
     std::ostream& print(std::ostream& os, bool lastField) const;
 
+    /** Load from the binary format written by printBinary. */
+    static std::shared_ptr<IddField_Impl> loadBinary(std::istream& is);
+
+    /** Print compact binary representation, including all keys. */
+    std::ostream& printBinary(std::ostream& os) const;
+
     //@}
    private:
     std::string m_name;              
@@ -21,10 +21,12 @@
 #include "IddFile_Impl.hpp"
 
 #include "IddRegex.hpp"
+#include "IddBinary.hpp"
 #include "IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../core/PathHelpers.hpp"
+#include "../core/Checksum.hpp"
 #include "../core/Assert.hpp"
 
 #include "../core/Containers.hpp"
@@ -33,8 +35,15 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <QDir>
+
 #include <sstream>
 
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace openstudio {
 
 namespace detail {
@@ -196,6 +205,49 @@ namespace detail {
   }
 
 
+  std::shared_ptr<IddFile_Impl> IddFile_Impl::loadBinary(std::istream& is) {
+    std::shared_ptr<IddFile_Impl> result;
+    IddFile_Impl iddFileImpl;
+
+    try {
+      if (!iddBinary::readHeader(is)) {
+        LOG(Debug,"Binary IDD data was written by an incompatible version of the format.");
+        return result;
+      }
+
+      iddFileImpl.m_version = iddBinary::readString(is);
+      iddFileImpl.m_build = iddBinary::readString(is);
+      iddFileImpl.m_header = iddBinary::readString(is);
+
+      unsigned numObjects = iddBinary::readUnsigned(is);
+      iddFileImpl.m_objects.reserve(numObjects);
+      for (unsigned i = 0; i < numObjects; ++i) {
+        OptionalIddObject object = IddObject::loadBinary(is);
+        if (!object) {
+          return result;
+        }
+        iddFileImpl.m_objects.push_back(*object);
+      }
+    }
+    catch (...) { return result; }
+
+    result = std::shared_ptr<IddFile_Impl>(new IddFile_Impl(iddFileImpl));
+    return result;
+  }
+
+  std::ostream& IddFile_Impl::printBinary(std::ostream& os) const
+  {
+    iddBinary::writeHeader(os);
+    iddBinary::writeString(os, m_version);
+    iddBinary::writeString(os, m_build);
+    iddBinary::writeString(os, m_header);
+    iddBinary::writeUnsigned(os, m_objects.size());
+    for (const IddObject& object : m_objects) {
+      object.printBinary(os);
+    }
+    return os;
+  }
+
   std::ostream& IddFile_Impl::print(std::ostream& os) const
   {
     os << m_header << std::endl;
@@ -464,11 +516,102 @@ OptionalIddFile IddFile::load(const openstudio::path& p) {
   return load(inFile);
 }
 
+OptionalIddFile IddFile::loadBinary(std::istream& is)
+{
+  std::shared_ptr<detail::IddFile_Impl> p = detail::IddFile_Impl::loadBinary(is);
+  if (p) { return IddFile(p); }
+  return boost::none;
+}
+
+OptionalIddFile IddFile::loadBinary(const openstudio::path& p) {
+  openstudio::path wp = completePathToFile(p,path(),"iddb",true);
+  if (wp.empty()) { return boost::none; }
+  boost::filesystem::ifstream inFile(wp, std::ios_base::binary);
+  if (!inFile) { return boost::none; }
+  return loadBinary(inFile);
+}
+
+namespace {
+
+  // cache entries are only read if no other user could have written them
+  bool trustedCacheEntry(const openstudio::path& p) {
+    boost::system::error_code ec;
+    boost::filesystem::file_status status = boost::filesystem::status(p, ec);
+    if (ec || !boost::filesystem::is_regular_file(status)) {
+      return false;
+    }
+    if ((status.permissions() & (boost::filesystem::group_write | boost::filesystem::others_write)) != 0) {
+      return false;
+    }
+#ifndef _WIN32
+    struct stat info;
+    if ((::stat(p.string().c_str(), &info) != 0) || (info.st_uid != ::geteuid())) {
+      return false;
+    }
+#endif
+    return true;
+  }
+
+}
+
+OptionalIddFile IddFile::loadCached(const openstudio::path& p, const openstudio::path& cacheDir) {
+  openstudio::path wp = completePathToFile(p,path(),"idd",true);
+  if (wp.empty()) { return boost::none; }
+
+  openstudio::path dir = cacheDir;
+  if (dir.empty()) {
+    dir = toPath(QDir::homePath()) / toPath(".openstudio_idd_cache");
+  }
+  openstudio::path cachePath = dir / toPath(checksum(wp) + ".iddb");
+
+  if (boost::filesystem::exists(cachePath)) {
+    if (!trustedCacheEntry(cachePath)) {
+      LOG(Warn,"Ignoring IDD cache entry '" << toString(cachePath)
+          << "', it is not owned by the current user or is writable by others.");
+    }
+    else if (OptionalIddFile result = loadBinary(cachePath)) {
+      return result;
+    }
+    else {
+      LOG(Debug,"Ignoring unreadable IDD cache entry '" << toString(cachePath) << "'.");
+    }
+  }
+
+  OptionalIddFile result = load(wp);
+  if (!result) { return result; }
+
+  // write to a unique name and rename, so concurrent processes never see a partial cache entry
+  openstudio::path tempPath = dir / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+  try {
+    if (makeParentFolder(cachePath,path(),true)) {
+      {
+        boost::filesystem::ofstream outFile(tempPath, std::ios_base::binary);
+        result->printBinary(outFile);
+      }
+      boost::filesystem::permissions(tempPath, boost::filesystem::owner_read | boost::filesystem::owner_write |
+                                               boost::filesystem::group_read | boost::filesystem::others_read);
+      boost::filesystem::rename(tempPath, cachePath);
+    }
+  }
+  catch (...) {
+    LOG(Debug,"Unable to write IDD cache entry '" << toString(cachePath) << "'.");
+    boost::system::error_code ec;
+    boost::filesystem::remove(tempPath, ec);
+  }
+
+  return result;
+}
+
 std::ostream& IddFile::print(std::ostream& os) const
 {
   return m_impl->print(os);
 }
 
+std::ostream& IddFile::printBinary(std::ostream& os) const
+{
+  return m_impl->printBinary(os);
+}
+
 std::pair<VersionString, std::string> IddFile::parseVersionBuild(const openstudio::path &p)
 {
   std::ifstream ifs(openstudio::toString(p));
@@ -527,6 +670,33 @@ bool IddFile::save(const openstudio::path& p, bool overwrite) {
   return false;
 }
 
+bool IddFile::saveBinary(const openstudio::path& p, bool overwrite) {
+  path wp = setFileExtension(p,"iddb",false,true);
+  if (boost::filesystem::exists(wp) && (overwrite == false)) {
+    LOG(Info,"IddFile saveBinary method failed because instructed not to overwrite path '"
+        << toString(wp) << "'.");
+    return false;
+  }
+  if (makeParentFolder(wp)) {
+    boost::filesystem::ofstream outFile(wp, std::ios_base::binary);
+    if (outFile) {
+      try {
+        printBinary(outFile);
+        outFile.close();
+        return true;
+      }
+      catch (...) {
+        LOG(Error,"Unable to write IddFile to path '" << toString(wp) << "'.");
+        return false;
+      }
+    }
+  }
+
+  LOG(Error,"Unable to write IddFile to path '" << toString(wp)
+      << "', because parent directory could not be created.");
+  return false;
+}
+
 // PROTECTED
 
 void IddFile::setVersion(const std::string& version)
@@ -122,6 +122,29 @@ class UTILITIES_API IddFile {
    *  extension is provided will use 'idd'. */
   bool save(const openstudio::path& p, bool overwrite=false);
 
+  /** Load an IddFile from the compact binary format written by saveBinary, if possible. Returns
+   *  an empty optional if the data was written by an incompatible version of the binary format. */
+  static boost::optional<IddFile> loadBinary(std::istream& is);
+
+  /** Load an IddFile from a binary file at path p, if possible. */
+  static boost::optional<IddFile> loadBinary(const openstudio::path& p);
+
+  /** Load the IddFile at text path p, if possible, going through a binary cache of previously
+   *  parsed files. Cache entries live in cacheDir (a folder under the user's home directory if
+   *  cacheDir is empty) and are keyed on the checksum of the text at p, so edits to p are always
+   *  picked up. Entries not owned by the current user, or writable by other users, are ignored.
+   *  If the cache cannot be read or written this is equivalent to load(p). */
+  static boost::optional<IddFile> loadCached(const openstudio::path& p,
+                                             const openstudio::path& cacheDir = openstudio::path());
+
+  /** Prints this file to os in the compact binary format. */
+  std::ostream& printBinary(std::ostream& os) const;
+
+  /** Saves file to path p in the compact binary format. Will only overwrite an existing file if
+   *  overwrite==true. If no extension is provided will use 'iddb'. Binary files are a cache
+   *  format, they are only guaranteed to be readable by the build of OpenStudio that wrote them. */
+  bool saveBinary(const openstudio::path& p, bool overwrite=false);
+
   /** Returns the version and build SHA from the given Idd. If build SHA is not present .second will be empty.
    *
    *  \throws an exception with a meaningful error message if something goes wrong
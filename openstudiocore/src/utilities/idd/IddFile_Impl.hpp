@@ -106,6 +106,12 @@ namespace detail{
     /// print
     std::ostream& print(std::ostream& os) const;
 
+    /// read the binary format written by printBinary to construct an IddFile_Impl
+    static std::shared_ptr<IddFile_Impl> loadBinary(std::istream& is);
+
+    /// print compact binary representation
+    std::ostream& printBinary(std::ostream& os) const;
+
     //@}
 
    private:
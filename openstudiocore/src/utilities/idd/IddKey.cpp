@@ -22,6 +22,7 @@
 
 #include "IddKeyProperties.hpp"
 #include "IddRegex.hpp"
+#include "IddBinary.hpp"
 
 #include <boost/algorithm/string.hpp>
 
@@ -69,6 +70,27 @@ namespace detail {
     return os;
   }
 
+  std::shared_ptr<IddKey_Impl> IddKey_Impl::loadBinary(std::istream& is) {
+    std::shared_ptr<IddKey_Impl> result;
+    IddKey_Impl iddKeyImpl;
+
+    try {
+      iddKeyImpl.m_name = iddBinary::readString(is);
+      iddKeyImpl.m_properties.note = iddBinary::readString(is);
+    }
+    catch (...) { return result; }
+
+    result = std::shared_ptr<IddKey_Impl>(new IddKey_Impl(iddKeyImpl));
+    return result;
+  }
+
+  std::ostream& IddKey_Impl::printBinary(std::ostream& os) const
+  {
+    iddBinary::writeString(os, m_name);
+    iddBinary::writeString(os, m_properties.note);
+    return os;
+  }
+
   // PRIVATE
 
   IddKey_Impl::IddKey_Impl(const std::string& name) : m_name(name) {}
@@ -129,6 +151,17 @@ std::ostream& IddKey::print(std::ostream& os) const
   return m_impl->print(os);
 }
 
+OptionalIddKey IddKey::loadBinary(std::istream& is) {
+  std::shared_ptr<detail::IddKey_Impl> p = detail::IddKey_Impl::loadBinary(is);
+  if (p) { return IddKey(p); }
+  else { return boost::none; }
+}
+
+std::ostream& IddKey::printBinary(std::ostream& os) const
+{
+  return m_impl->printBinary(os);
+}
+
 // PRIVATE
 
 IddKey::IddKey(const std::shared_ptr<detail::IddKey_Impl>& impl) : m_impl(impl) {}
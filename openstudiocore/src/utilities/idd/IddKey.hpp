@@ -80,6 +80,12 @@ class UTILITIES_API IddKey {
   /** Print to os in standard IDD format */
   std::ostream& print(std::ostream& os) const;
 
+  /** Load from the compact binary format written by printBinary. */
+  static boost::optional<IddKey> loadBinary(std::istream& is);
+
+  /** Print to os in the compact binary format used by IddFile::saveBinary. */
+  std::ostream& printBinary(std::ostream& os) const;
+
   //@}
  private:
   ///@cond
@@ -56,6 +56,12 @@ namespace detail {
     /// print idd 
     std::ostream& print(std::ostream& os) const;
 
+    /// load from the binary format written by printBinary
+    static std::shared_ptr<IddKey_Impl> loadBinary(std::istream& is);
+
+    /// print compact binary representation
+    std::ostream& printBinary(std::ostream& os) const;
+
    private:
 
     /// partial constructor used by load
@@ -22,6 +22,7 @@
 
 #include "ExtensibleIndex.hpp"
 #include "IddRegex.hpp"
+#include "IddBinary.hpp"
 #include <utilities/idd/IddFactory.hxx>
 #include <utilities/idd/IddEnums.hxx>
 #include "IddKey.hpp"
@@ -410,6 +411,73 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IddObject_Impl> IddObject_Impl::loadBinary(std::istream& is)
+  {
+    std::shared_ptr<IddObject_Impl> result;
+
+    try {
+      std::string name = iddBinary::readString(is);
+      std::string group = iddBinary::readString(is);
+      IddObjectType type(iddBinary::readString(is));
+      result = std::shared_ptr<IddObject_Impl>(new IddObject_Impl(name,group,type));
+
+      IddObjectProperties& properties = result->m_properties;
+      properties.memo = iddBinary::readString(is);
+      properties.unique = iddBinary::readBool(is);
+      properties.required = iddBinary::readBool(is);
+      properties.obsolete = iddBinary::readBool(is);
+      properties.hasURL = iddBinary::readBool(is);
+      properties.extensible = iddBinary::readBool(is);
+      properties.numExtensible = iddBinary::readUnsigned(is);
+      properties.numExtensibleGroupsRequired = iddBinary::readUnsigned(is);
+      properties.format = iddBinary::readString(is);
+      properties.minFields = iddBinary::readUnsigned(is);
+      properties.maxFields = iddBinary::readOptionalUnsigned(is);
+
+      for (IddFieldVector* fields : { &result->m_fields, &result->m_extensibleFields }) {
+        unsigned numFields = iddBinary::readUnsigned(is);
+        for (unsigned i = 0; i < numFields; ++i) {
+          OptionalIddField field = IddField::loadBinary(is);
+          if (!field) {
+            return std::shared_ptr<IddObject_Impl>();
+          }
+          fields->push_back(*field);
+        }
+      }
+    }
+    catch (...) { return std::shared_ptr<IddObject_Impl>(); }
+
+    return result;
+  }
+
+  std::ostream& IddObject_Impl::printBinary(std::ostream& os) const
+  {
+    iddBinary::writeString(os, m_name);
+    iddBinary::writeString(os, m_group);
+    iddBinary::writeString(os, m_type.valueName());
+
+    iddBinary::writeString(os, m_properties.memo);
+    iddBinary::writeBool(os, m_properties.unique);
+    iddBinary::writeBool(os, m_properties.required);
+    iddBinary::writeBool(os, m_properties.obsolete);
+    iddBinary::writeBool(os, m_properties.hasURL);
+    iddBinary::writeBool(os, m_properties.extensible);
+    iddBinary::writeUnsigned(os, m_properties.numExtensible);
+    iddBinary::writeUnsigned(os, m_properties.numExtensibleGroupsRequired);
+    iddBinary::writeString(os, m_properties.format);
+    iddBinary::writeUnsigned(os, m_properties.minFields);
+    iddBinary::writeOptionalUnsigned(os, m_properties.maxFields);
+
+    for (const IddFieldVector* fields : { &m_fields, &m_extensibleFields }) {
+      iddBinary::writeUnsigned(os, fields->size());
+      for (const IddField& field : *fields) {
+        field.printBinary(os);
+      }
+    }
+
+    return os;
+  }
+
   /// print
   std::ostream& IddObject_Impl::print(std::ostream& os) const
   {
@@ -818,6 +886,18 @@ std::ostream& IddObject::print(std::ostream& os) const
   return m_impl->print(os);
 }
 
+boost::optional<IddObject> IddObject::loadBinary(std::istream& is)
+{
+  std::shared_ptr<detail::IddObject_Impl> p = detail::IddObject_Impl::loadBinary(is);
+  if (p) { return IddObject(p); }
+  else { return boost::none; }
+}
+
+std::ostream& IddObject::printBinary(std::ostream& os) const
+{
+  return m_impl->printBinary(os);
+}
+
 // PRIVATE
 
 IddObject::IddObject(const std::shared_ptr<detail::IddObject_Impl>& impl) : m_impl(impl) {}
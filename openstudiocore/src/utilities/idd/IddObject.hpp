@@ -198,6 +198,13 @@ class UTILITIES_API IddObject {
   /** Print this object to os, in standard IDD format. */
   std::ostream& print(std::ostream& os) const;
 
+  /** Load from the compact binary format written by printBinary. Type is restored by name, so
+   *  the load fails if the data refers to an IddObjectType this build does not know about. */
+  static boost::optional<IddObject> loadBinary(std::istream& is);
+
+  /** Print this object to os in the compact binary format used by IddFile::saveBinary. */
+  std::ostream& printBinary(std::ostream& os) const;
+
   //@}
  private:
   ///@cond
@@ -172,6 +172,12 @@ namespace detail {
     // print
     std::ostream& print(std::ostream& os) const;
 
+    /** Load from the binary format written by printBinary. */
+    static std::shared_ptr<IddObject_Impl> loadBinary(std::istream& is);
+
+    // print compact binary representation, including all fields
+    std::ostream& printBinary(std::ostream& os) const;
+
     //@}
 
    private:
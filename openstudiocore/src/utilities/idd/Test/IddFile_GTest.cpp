@@ -29,6 +29,7 @@
 #include "../../core/Path.hpp"
 #include "../../core/Containers.hpp"
 #include "../../core/Compare.hpp"
+#include "../../core/Checksum.hpp"
 
 #include <resources.hxx>
 
@@ -292,3 +293,54 @@ TEST_F(IddFixture, IddFile_EpGroups) {
       << " object groups, including the first, unnamed group: " << std::endl << ss.str());
 }
 
+
+TEST_F(IddFixture, IddFile_Binary) {
+  // round trip through the binary format
+  std::stringstream ss;
+  osIddFile.printBinary(ss);
+  OptionalIddFile binaryIddFile = IddFile::loadBinary(ss);
+  ASSERT_TRUE(binaryIddFile);
+  EXPECT_EQ(osIddFile.version(),binaryIddFile->version());
+  EXPECT_EQ(osIddFile.header(),binaryIddFile->header());
+  IddObjectVector objects = osIddFile.objects();
+  IddObjectVector binaryObjects = binaryIddFile->objects();
+  ASSERT_EQ(objects.size(),binaryObjects.size());
+  for (unsigned i = 0, n = objects.size(); i < n; ++i) {
+    EXPECT_TRUE(objects[i] == binaryObjects[i]) << objects[i].name();
+    EXPECT_EQ(objects[i].type(),binaryObjects[i].type());
+  }
+
+  // truncated and foreign data are rejected rather than misread
+  std::string data = ss.str();
+  std::stringstream truncated(data.substr(0,data.size() / 2));
+  EXPECT_FALSE(IddFile::loadBinary(truncated));
+  std::stringstream text;
+  osIddFile.print(text);
+  EXPECT_FALSE(IddFile::loadBinary(text));
+
+  // the cache is populated on first load and used thereafter
+  path iddPath = resourcesPath()/toPath("model/OpenStudio.idd");
+  path cacheDir = toPath("IddFile_Binary_Cache");
+  if (boost::filesystem::exists(cacheDir)) {
+    boost::filesystem::remove_all(cacheDir);
+  }
+  OptionalIddFile textIddFile = IddFile::loadCached(iddPath,cacheDir);
+  ASSERT_TRUE(textIddFile);
+  EXPECT_TRUE(boost::filesystem::exists(cacheDir / toPath(checksum(iddPath) + ".iddb")));
+  OptionalIddFile cachedIddFile = IddFile::loadCached(iddPath,cacheDir);
+  ASSERT_TRUE(cachedIddFile);
+  EXPECT_EQ(textIddFile->version(),cachedIddFile->version());
+  EXPECT_TRUE(textIddFile->objects() == cachedIddFile->objects());
+
+  // entries other users could have written are ignored
+  path cachePath = cacheDir / toPath(checksum(iddPath) + ".iddb");
+  {
+    boost::filesystem::ofstream outFile(cachePath, std::ios_base::binary | std::ios_base::trunc);
+    epIddFile.printBinary(outFile);
+  }
+  boost::filesystem::permissions(cachePath, boost::filesystem::add_perms | boost::filesystem::others_write);
+  cachedIddFile = IddFile::loadCached(iddPath,cacheDir);
+  ASSERT_TRUE(cachedIddFile);
+  EXPECT_EQ(textIddFile->version(),cachedIddFile->version());
+  EXPECT_TRUE(textIddFile->objects() == cachedIddFile->objects());
+}
@@ -0,0 +1,275 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_IDF_HANDLETABLE_HPP
+#define UTILITIES_IDF_HANDLETABLE_HPP
+
+#include "Handle.hpp"
+
+#include <QUuid>
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** Associative container from non-null Handle to T with the subset of the std::map interface
+   *  used by Workspace_Impl. Entries are stored in a dense vector in insertion order, which is
+   *  also the iteration order, and are found through an open addressing (linear probing) index
+   *  of entry slots, so a lookup hashes the handle once rather than walking a tree of nodes.
+   *
+   *  Erased entries leave a hole that iteration skips, holes are squeezed out the next time the
+   *  table grows. Inserting invalidates all iterators, erasing only invalidates the erased one.
+   *  Const member functions do not modify the table and may be called from several threads. */
+  template<class T>
+  class HandleTable {
+   public:
+
+    typedef std::pair<Handle, T> value_type;
+
+    typedef std::vector<value_type> Entries;
+
+    template<class EntriesType, class ValueType>
+    class basic_iterator : public std::iterator<std::forward_iterator_tag, ValueType> {
+     public:
+      basic_iterator() : m_entries(nullptr), m_index(0) {}
+
+      basic_iterator(EntriesType* entries, size_t index)
+        : m_entries(entries), m_index(index)
+      {
+        skipHoles();
+      }
+
+      // iterator to const_iterator
+      template<class OtherEntriesType, class OtherValueType>
+      basic_iterator(const basic_iterator<OtherEntriesType, OtherValueType>& other)
+        : m_entries(other.entries()), m_index(other.index())
+      {}
+
+      ValueType& operator*() const { return (*m_entries)[m_index]; }
+
+      ValueType* operator->() const { return &(*m_entries)[m_index]; }
+
+      basic_iterator& operator++() {
+        ++m_index;
+        skipHoles();
+        return *this;
+      }
+
+      basic_iterator operator++(int) {
+        basic_iterator result(*this);
+        ++(*this);
+        return result;
+      }
+
+      template<class OtherEntriesType, class OtherValueType>
+      bool operator==(const basic_iterator<OtherEntriesType, OtherValueType>& other) const {
+        return (m_index == other.index());
+      }
+
+      template<class OtherEntriesType, class OtherValueType>
+      bool operator!=(const basic_iterator<OtherEntriesType, OtherValueType>& other) const {
+        return (m_index != other.index());
+      }
+
+      EntriesType* entries() const { return m_entries; }
+
+      size_t index() const { return m_index; }
+
+     private:
+      void skipHoles() {
+        while ((m_index < m_entries->size()) && (*m_entries)[m_index].first.isNull()) {
+          ++m_index;
+        }
+      }
+
+      EntriesType* m_entries;
+      size_t m_index;
+    };
+
+    typedef basic_iterator<Entries, value_type> iterator;
+    typedef basic_iterator<const Entries, const value_type> const_iterator;
+
+    HandleTable() : m_size(0), m_usedSlots(0) {}
+
+    size_t size() const { return m_size; }
+
+    bool empty() const { return (m_size == 0); }
+
+    iterator begin() { return iterator(&m_entries, 0); }
+
+    iterator end() { return iterator(&m_entries, m_entries.size()); }
+
+    const_iterator begin() const { return const_iterator(&m_entries, 0); }
+
+    const_iterator end() const { return const_iterator(&m_entries, m_entries.size()); }
+
+    iterator find(const Handle& handle) {
+      size_t slot = findSlot(handle);
+      if (slot == npos) { return end(); }
+      return iterator(&m_entries, m_slots[slot] - FirstEntry);
+    }
+
+    const_iterator find(const Handle& handle) const {
+      size_t slot = findSlot(handle);
+      if (slot == npos) { return end(); }
+      return const_iterator(&m_entries, m_slots[slot] - FirstEntry);
+    }
+
+    size_t count(const Handle& handle) const {
+      return (findSlot(handle) == npos) ? 0 : 1;
+    }
+
+    /** Inserts value unless its handle is already present. Returns an iterator to the entry for
+     *  the handle and whether value was inserted. */
+    std::pair<iterator, bool> insert(const value_type& value) {
+      iterator it = find(value.first);
+      if (it != end()) {
+        return std::make_pair(it, false);
+      }
+
+      if (m_slots.empty() || (2*(m_usedSlots + 1) > m_slots.size()) || (m_entries.size() > 2*m_size + 16)) {
+        rehash(m_size + 1);
+      }
+
+      size_t mask = m_slots.size() - 1;
+      size_t slot = hash(value.first) & mask;
+      while (m_slots[slot] >= FirstEntry) {
+        slot = (slot + 1) & mask;
+      }
+      if (m_slots[slot] == EmptySlot) {
+        ++m_usedSlots;
+      }
+      m_slots[slot] = static_cast<unsigned>(m_entries.size()) + FirstEntry;
+      m_entries.push_back(value);
+      ++m_size;
+
+      return std::make_pair(iterator(&m_entries, m_entries.size() - 1), true);
+    }
+
+    template<class InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+      for (; first != last; ++first) {
+        insert(value_type(first->first, first->second));
+      }
+    }
+
+    T& operator[](const Handle& handle) {
+      return insert(value_type(handle, T())).first->second;
+    }
+
+    void erase(iterator it) {
+      size_t slot = findSlot(it->first);
+      if (slot == npos) { return; }
+      m_slots[slot] = ErasedSlot;
+      m_entries[it.index()] = value_type();
+      --m_size;
+    }
+
+    size_t erase(const Handle& handle) {
+      iterator it = find(handle);
+      if (it == end()) { return 0; }
+      erase(it);
+      return 1;
+    }
+
+    void clear() {
+      m_entries.clear();
+      m_slots.clear();
+      m_size = 0;
+      m_usedSlots = 0;
+    }
+
+    void swap(HandleTable& other) {
+      m_entries.swap(other.m_entries);
+      m_slots.swap(other.m_slots);
+      std::swap(m_size, other.m_size);
+      std::swap(m_usedSlots, other.m_usedSlots);
+    }
+
+   private:
+
+    // slot states, otherwise a slot holds entry index + FirstEntry
+    enum SlotState { EmptySlot = 0, ErasedSlot = 1, FirstEntry = 2 };
+
+    static const size_t npos = static_cast<size_t>(-1);
+
+    static size_t hash(const Handle& handle) {
+      return qHash(handle);
+    }
+
+    size_t findSlot(const Handle& handle) const {
+      if (m_slots.empty() || handle.isNull()) {
+        return npos;
+      }
+      size_t mask = m_slots.size() - 1;
+      size_t slot = hash(handle) & mask;
+      while (m_slots[slot] != EmptySlot) {
+        if ((m_slots[slot] >= FirstEntry) && (m_entries[m_slots[slot] - FirstEntry].first == handle)) {
+          return slot;
+        }
+        slot = (slot + 1) & mask;
+      }
+      return npos;
+    }
+
+    // squeeze holes out of m_entries and rebuild the index with room for n entries at a load
+    // factor of at most one quarter
+    void rehash(size_t n) {
+      Entries entries;
+      entries.reserve(n);
+      for (value_type& entry : m_entries) {
+        if (!entry.first.isNull()) {
+          entries.push_back(value_type());
+          entries.back().first = entry.first;
+          std::swap(entries.back().second, entry.second);
+        }
+      }
+      m_entries.swap(entries);
+
+      size_t numSlots = 16;
+      while (numSlots < 4*n) {
+        numSlots *= 2;
+      }
+      m_slots.assign(numSlots, EmptySlot);
+      m_usedSlots = 0;
+
+      size_t mask = numSlots - 1;
+      for (size_t i = 0; i < m_entries.size(); ++i) {
+        size_t slot = hash(m_entries[i].first) & mask;
+        while (m_slots[slot] != EmptySlot) {
+          slot = (slot + 1) & mask;
+        }
+        m_slots[slot] = static_cast<unsigned>(i) + FirstEntry;
+        ++m_usedSlots;
+      }
+    }
+
+    Entries m_entries;
+    std::vector<unsigned> m_slots;
+    size_t m_size;
+    size_t m_usedSlots;
+  };
+
+} // detail
+} // openstudio
+
+#endif // UTILITIES_IDF_HANDLETABLE_HPP
@@ -20,6 +20,7 @@
 #include "IdfFile.hpp"
 #include <utilities/idf/IdfObject_Impl.hpp> // needed for serialization
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include <utilities/idd/IddObject_Impl.hpp> // needed for serialization
@@ -42,10 +43,11 @@
 #include <boost/regex.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
-#include <boost/iostreams/filter/newline.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
+
+#include <QFile>
 
 #include <sstream>
+#include <iterator>
 
 namespace openstudio {
 
@@ -389,13 +391,19 @@ OptionalIdfFile IdfFile::load(const path& p,
   }
 
   // try to open file and parse
-  boost::filesystem::ifstream inFile(wp);
-  if (inFile) {
-    try {
-      return load(inFile, iddFileType, progressBar);
+  IdfFile result(iddFileType);
+  // remove initial version object
+  if (OptionalIdfObject vo = result.versionObject()) {
+    result.removeObject(*vo);
+  }
+  try {
+    if (result.m_load(wp, progressBar)) {
+      // check for it again here
+      result.addVersionObject();
+      return result;
     }
-    catch (...) { return boost::none; }
   }
+  catch (...) {}
 
   return boost::none;
 }
@@ -405,13 +413,19 @@ OptionalIdfFile IdfFile::load(const path& p, const IddFile& iddFile, ProgressBar
   path wp = completePathToFile(p,path(),"idf",false);
 
   // try to open file and parse
-  boost::filesystem::ifstream inFile(wp);
-  if (inFile) {
-    try {
-      return load(inFile, iddFile, progressBar);
+  IdfFile result(iddFile);
+  // remove initial version object
+  if (OptionalIdfObject vo = result.versionObject()) {
+    result.removeObject(*vo);
+  }
+  try {
+    if (result.m_load(wp, progressBar)) {
+      // check for it again here
+      result.addVersionObject();
+      return result;
     }
-    catch (...) { return boost::none; }
   }
+  catch (...) {}
 
   return boost::none;
 }
@@ -435,15 +449,24 @@ boost::optional<VersionString> IdfFile::loadVersionOnly(std::istream& is) {
 boost::optional<VersionString> IdfFile::loadVersionOnly(const path& p) {
   boost::optional<VersionString> result;
   path wp = completePathToFile(p,path(),"idf",false);
-  boost::filesystem::ifstream inFile(wp);
-  if (inFile) {
-    try {
-      return loadVersionOnly(inFile);
-    }
-    catch (...) { 
+  IddFile catchallIdd = IddFile::catchallIddFile();
+  IdfFile idf(catchallIdd);
+  OS_ASSERT(!idf.versionObject());
+  try {
+    if (!idf.m_load(wp,nullptr,true)) {
       return result;
     }
   }
+  catch (...) {
+    return result;
+  }
+  if (OptionalIdfObject oVersionObject = idf.versionObject()) {
+    unsigned n = oVersionObject->numFields();
+    std::string versionString = oVersionObject->getString(n - 1,true).get();
+    if (!versionString.empty()) {
+      result = VersionString(versionString);
+    }
+  }
   return result;
 }
 
@@ -523,57 +546,69 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
 // SERIALIZATION
 
 bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
+  // read the whole stream, then tokenize it in place
+  std::string text((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  return m_load(text.data(), text.size(), progressBar, versionOnly);
+}
+
+bool IdfFile::m_load(const openstudio::path& p, ProgressBar* progressBar, bool versionOnly) {
+  QFile file(toQString(p));
+  if (!file.open(QIODevice::ReadOnly)) {
+    return false;
+  }
+
+  qint64 size = file.size();
+  if (size == 0) {
+    return m_load(nullptr, 0, progressBar, versionOnly);
+  }
+
+  // tokenize the file directly from a memory map, if possible
+  if (uchar* data = file.map(0, size)) {
+    bool result = m_load(reinterpret_cast<const char*>(data), static_cast<std::size_t>(size), progressBar, versionOnly);
+    file.unmap(data);
+    return result;
+  }
+
+  file.close();
+  boost::filesystem::ifstream inFile(p);
+  if (!inFile) {
+    return false;
+  }
+  return m_load(inFile, progressBar, versionOnly);
+}
+
+bool IdfFile::m_load(const char* data, std::size_t size, ProgressBar* progressBar, bool versionOnly) {
 
   int lineNum = 0;        // Idf line number
   int objectNum = 0;      // number of objects, first is #1
-  std::string line;       // temp string to help with reading
-  boost::smatch matches;  // matches to regular expressions
+  boost::string_ref buffer(data, size); // text not yet read
+  boost::string_ref line; // current line, points into buffer
   std::string comment;    // keep running comment
   bool firstBlock = true; // to capture first comment block as the header
 
+  // progress is reported in KB, so files over 2 GB do not overflow the progress bar's int range
+  const std::size_t progressUnit = 1024;
   if (progressBar){
-    is.seekg(0, std::ios_base::end);
-    int streamsize = static_cast<int>(is.tellg());
     progressBar->setMinimum(0);
-    progressBar->setMaximum(streamsize);
-    is.seekg(0, std::ios_base::beg);
+    progressBar->setMaximum(static_cast<int>((size + progressUnit - 1) / progressUnit));
   }
 
-
-  // Use a boost filter to make sure that no matter what line endings come in,
-  // they are converted to what is expected by the current os
-  boost::iostreams::filtering_istream filt;
-
-//#ifdef _POSIX_VERSION
-  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::posix));
-//#else
-//  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::dos));
-//#endif
-  filt.push(is);
-
-  // read the file line by line using regexes
-  while(std::getline(filt, line)){
-    
-    if (line == "\r")
-    {
-      // This is not a real line at all, just the vestiges from the 
-      // previous windows formatted line being parsed on unix, skip it,
-      // don't even count it
-      continue;
-    }
+  // read the text line by line. getLine accepts any combination of line endings.
+  while(idfTokenizer::getLine(buffer, line)){
 
     ++lineNum;
 
     if (progressBar){
-      int current = static_cast<int>(is.tellg());
+      int current = static_cast<int>((size - buffer.size()) / progressUnit);
       progressBar->setValue(current);
     }
 
-    if (boost::regex_match(line, idfRegex::commentOnlyLine())){
+    if (idfTokenizer::isCommentOnlyLine(line)){
       // continue comment
-      comment += (line + idfRegex::newLinestring());
+      comment.append(line.data(), line.size());
+      comment += idfRegex::newLinestring();
     }
-    else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())){
+    else if (idfTokenizer::isWhitespaceOnlyLine(line)){
       // end comment
       boost::trim(comment);
 
@@ -620,16 +655,17 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
       // peek at the object type and name for indexing in map
       std::string objectType;
 
-      if (boost::regex_search(line, matches, idfRegex::line())){
-        objectType = std::string(matches[1].first, matches[1].second); boost::trim(objectType);
+      idfTokenizer::LineMatch match;
+      if (idfTokenizer::searchLine(line, match)){
+        objectType = idfTokenizer::trim(match.field).to_string();
       }else{
         // can't figure out the object's type
         if (!versionOnly) {
-          LOG(Warn, "Unrecognizable object type '" + line + "'. Defaulting to 'Catchall'.");
+          LOG(Warn, "Unrecognizable object type '" << line << "'. Defaulting to 'Catchall'.");
         }
         objectType = "Catchall";
       }
-      if (boost::regex_match(objectType,iddRegex::versionObjectName())) {
+      if (idfTokenizer::isVersionObjectName(objectType)) {
         isVersion = true;
       }
 
@@ -646,24 +682,27 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
       else { OS_ASSERT(iddObject->type() != IddObjectType::Catchall); }
 
       // put the text for this object in a new string with a newline
-      std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
+      std::string text(comment + idfRegex::newLinestring());
+      text.append(line.data(), line.size());
+      text += idfRegex::newLinestring();
       comment = "";
 
         // check if this line also matches closing line object
-      if (boost::regex_match(line, idfRegex::objectEnd())){
+      if (idfTokenizer::isObjectEnd(line)){
         foundEndLine = true;
       }
 
       // continue reading until we have seen the entire object
       // last line will be thrown away, requires empty line between objects in Idf
-      while((!foundEndLine) && (std::getline(filt, line))){
+      while((!foundEndLine) && (idfTokenizer::getLine(buffer, line))){
         ++lineNum;
 
         // add line to text, include newline separator
-        text += (line + idfRegex::newLinestring());
+        text.append(line.data(), line.size());
+        text += idfRegex::newLinestring();
 
         // check if we have found the last field
-        if (boost::regex_match(line, idfRegex::objectEnd())){
+        if (idfTokenizer::isObjectEnd(line)){
             foundEndLine = true;
         }
       }
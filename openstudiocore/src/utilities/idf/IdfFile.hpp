@@ -237,6 +237,12 @@ class UTILITIES_API IdfFile {
   /// private load function that uses m_iddFile and m_iddFileType initialized elsewhere
   bool m_load(std::istream& is, ProgressBar* progressBar=nullptr, bool versionOnly=false);
 
+  /// as above, but memory maps the file at p rather than reading it through a stream, if possible
+  bool m_load(const openstudio::path& p, ProgressBar* progressBar=nullptr, bool versionOnly=false);
+
+  /// tokenizes size characters of IDF text starting at data
+  bool m_load(const char* data, std::size_t size, ProgressBar* progressBar, bool versionOnly);
+
   // configure logging
   REGISTER_LOGGER("utilities.idf.IdfFile");
 };
@@ -22,6 +22,7 @@
 
 #include "IdfExtensibleGroup.hpp"
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddObject.hpp"
@@ -69,7 +70,8 @@ namespace detail {
     : m_comment(other.comment()), 
       m_iddObject(other.iddObject()),
       m_fields(other.fields()), 
-      m_fieldComments(other.fieldComments())
+      m_fieldComments(other.fieldComments()),
+      m_numericFields(other.m_numericFields)
   {
     if (keepHandle){
       OS_ASSERT(!other.handle().isNull());
@@ -103,6 +105,7 @@ namespace detail {
       }
     }
     resizeToMinFields();
+    updateNumericFields(0,numFields());
   }
 
   IdfObject_Impl::IdfObject_Impl(const IddObject& iddObject, bool fastName)
@@ -123,6 +126,7 @@ namespace detail {
       }
     }
     resizeToMinFields();
+    updateNumericFields(0,numFields());
   }
 
   IdfObject_Impl::IdfObject_Impl(const IddObject& iddObject, bool fastName, bool minimal)
@@ -144,6 +148,7 @@ namespace detail {
       m_fieldComments(fieldComments) 
   {
     resizeToMinFields();
+    updateNumericFields(0,numFields());
   }
 
   // GETTERS
@@ -252,6 +257,13 @@ namespace detail {
   boost::optional<double> IdfObject_Impl::getDouble(unsigned index, bool returnDefault) const
   {
     OptionalDouble result;
+    if (const NumericField* parsed = parsedNumericField(index,returnDefault)) {
+      if (parsed->state == NumericField::Numeric) {
+        result = parsed->value;
+      }
+      return result;
+    }
+
     OptionalString value = getString(index, returnDefault, false);
     if (value){
       if (!( istringEqual(*value,"") || 
@@ -278,6 +290,18 @@ namespace detail {
   boost::optional<unsigned> IdfObject_Impl::getUnsigned(unsigned index, bool returnDefault) const
   {
     OptionalUnsigned result;
+    if (const NumericField* parsed = parsedNumericField(index,returnDefault)) {
+      if (parsed->state == NumericField::Numeric) {
+        try {
+          result = boost::numeric_cast<unsigned>(parsed->value);
+        }
+        catch (const std::exception&) {
+          LOG(Error, "Could not convert '" << m_fields[index] << "' to unsigned");
+        }
+      }
+      return result;
+    }
+
     OptionalString value = getString(index, returnDefault, false);
     if (value){
       if (!( istringEqual(*value,"") || 
@@ -299,6 +323,18 @@ namespace detail {
   boost::optional<int> IdfObject_Impl::getInt(unsigned index, bool returnDefault) const
   {
     OptionalInt result;
+    if (const NumericField* parsed = parsedNumericField(index,returnDefault)) {
+      if (parsed->state == NumericField::Numeric) {
+        try {
+          result = boost::numeric_cast<int>(parsed->value);
+        }
+        catch (const std::exception&) {
+          LOG(Error, "Could not convert '" << m_fields[index] << "' to int");
+        }
+      }
+      return result;
+    }
+
     OptionalString value = getString(index, returnDefault, false);
     if (value){
       if (!( istringEqual(*value,"") || 
@@ -419,11 +455,14 @@ namespace detail {
       if (i < n) {
         std::string oldName = m_fields[i];
         m_fields[i] = newName;
+        updateNumericFields(i,i+1);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
+        nameChanged(oldName);
       } 
       else { 
         m_fields.push_back(newName);
         m_diffs.push_back(IdfObjectDiff(i, boost::none, newName));
+        nameChanged(boost::none);
       }
       return newName; // success!
     }
@@ -489,10 +528,7 @@ namespace detail {
         m_diffs.resize(diffSize);
 
         // resize fields
-        m_fields.resize(n);
-        if (m_fieldComments.size() > n) {
-          m_fieldComments.resize(n);
-        }
+        truncateFields(n);
         
         return false;
       }
@@ -500,6 +536,7 @@ namespace detail {
       OS_ASSERT(index < m_fields.size());
 
       m_fields[index] = value;
+      updateNumericFields(index,index+1);
       m_diffs.push_back(IdfObjectDiff(index, oldValue, value));
       return result;
     }
@@ -613,6 +650,7 @@ namespace detail {
         (m_iddObject.isExtensibleField(index) && (m_iddObject.properties().numExtensible == 1))) 
     {
       m_fields.push_back(value);
+      updateNumericFields(index,index+1);
       m_diffs.push_back(IdfObjectDiff(index, boost::none, value));
       return true;
     }
@@ -649,10 +687,7 @@ namespace detail {
         m_diffs.resize(diffSize);
 
         // resize the fields
-        m_fields.resize(n);
-        if (m_fieldComments.size() > n) {
-          m_fieldComments.resize(n);
-        }
+        truncateFields(n);
         return result;
       }
     }
@@ -679,10 +714,7 @@ namespace detail {
           m_diffs.resize(diffSize);
           
           // resize the fields
-          m_fields.resize(n);
-          if (m_fieldComments.size() > n){
-            m_fieldComments.resize(n);
-          }
+          truncateFields(n);
           return result;
         }
       }
@@ -1210,6 +1242,7 @@ namespace detail {
     try {
       idfObjectImpl.parse(text,true);
       idfObjectImpl.resizeToMinFields();
+      idfObjectImpl.updateNumericFields(0,idfObjectImpl.numFields());
     }
     catch (...) { return result; }
 
@@ -1227,6 +1260,7 @@ namespace detail {
     try {
       idfObjectImpl.parse(text,false);
       idfObjectImpl.resizeToMinFields();
+      idfObjectImpl.updateNumericFields(0,idfObjectImpl.numFields());
     }
     catch (...) { return result; }
 
@@ -1411,28 +1445,27 @@ namespace detail {
     std::string objectType;
 
     // cut down on this text as we parse
-    std::string parsedText(text);
+    boost::string_ref parsedText(text);
 
     // get preceding comments
-    boost::smatch matches;
-    while(boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())){
-      std::string comment(matches[1].first, matches[1].second); 
-      std::string otherText(matches[2].first, matches[2].second); boost::trim_left(otherText);
+    boost::string_ref comment, otherText;
+    while (idfTokenizer::isCommentOnlyLine(parsedText)) {
+      idfTokenizer::splitCommentOnlyLine(parsedText,comment,otherText);
 
       // append the comment
       if(!comment.empty()){
-        m_comment += "!" + comment + idfRegex::newLinestring();
+        m_comment += "!" + comment.to_string() + idfRegex::newLinestring();
       }
 
       // reduce the parsed text
-      parsedText = otherText;
+      parsedText = idfTokenizer::trimLeft(otherText);
     }
     
     // the first entry will be the object type
-    if (boost::regex_search(parsedText, matches, idfRegex::line())){
-      objectType = std::string(matches[1].first, matches[1].second); boost::trim(objectType);
-      std::string commentOrOtherText(matches[2].first, matches[2].second); boost::trim_left(commentOrOtherText);
-      std::string otherText(matches[3].first, matches[3].second);
+    idfTokenizer::LineMatch match;
+    if (idfTokenizer::searchLine(parsedText,match)){
+      objectType = idfTokenizer::trim(match.field).to_string();
+      boost::string_ref commentOrOtherText = idfTokenizer::trimLeft(match.afterSeparator);
 
       if (getIddFromFactory) {
         // find appropriate IddObject in IddFactory
@@ -1458,17 +1491,18 @@ namespace detail {
         }
       }
 
-      if (boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine()) ||
-          boost::regex_match(commentOrOtherText, commentRegex::whitespaceOnlyBlock())){
+      if (idfTokenizer::isCommentOnlyLine(commentOrOtherText) ||
+          idfTokenizer::isWhitespaceOnlyBlock(commentOrOtherText)){
 
         // set comment
-        m_comment += commentOrOtherText;
+        m_comment += commentOrOtherText.to_string();
 
         // reduce the parsed text
-        parsedText = otherText;
+        parsedText = match.remainder;
       }else{
-        // reduce the parsed text
-        parsedText = commentOrOtherText + otherText;
+        // reduce the parsed text, commentOrOtherText runs into match.remainder
+        parsedText = boost::string_ref(commentOrOtherText.data(),
+                                       commentOrOtherText.size() + match.remainder.size());
       }
 
     }
@@ -1477,17 +1511,16 @@ namespace detail {
     }
 
    // get trailing comments
-    while(boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())){
-      std::string comment(matches[1].first, matches[1].second); 
-      std::string otherText(matches[2].first, matches[2].second); boost::trim_left(otherText);
+    while (idfTokenizer::isCommentOnlyLine(parsedText)) {
+      idfTokenizer::splitCommentOnlyLine(parsedText,comment,otherText);
 
       // append the comment
       if(!comment.empty()){
-        m_comment += "!" + comment + idfRegex::newLinestring();
+        m_comment += "!" + comment.to_string() + idfRegex::newLinestring();
       }
 
       // reduce the parsed text
-      parsedText = otherText;
+      parsedText = idfTokenizer::trimLeft(otherText);
     }
 
     // remove trailing whitespace and new lines
@@ -1497,38 +1530,32 @@ namespace detail {
     parseFields(parsedText); 
   }
 
-  void IdfObject_Impl::parseFields(const std::string& text)
+  void IdfObject_Impl::parseFields(boost::string_ref text)
   {
-    // match variables
-    boost::match_results<std::string::const_iterator> matches;
-
     // cut down on this text as we parse
-    std::string::const_iterator start = text.begin ();
-    std::string::const_iterator stop = text.end ();
+    boost::string_ref parsedText(text);
     
     // current idd field index
     unsigned iddFieldIndex = 0;
 
     // parse all the fields
-    while (boost::regex_search(start, stop, matches, idfRegex::line())) {
-      std::string fieldText(matches[1].first, matches[1].second); 
-      boost::trim(fieldText);
-      std::string commentOrOtherText(matches[2].first, matches[2].second); 
-      boost::trim(commentOrOtherText);
+    idfTokenizer::LineMatch match;
+    while (idfTokenizer::searchLine(parsedText,match)) {
+      std::string fieldText = idfTokenizer::trim(match.field).to_string();
+      boost::string_ref commentOrOtherText = idfTokenizer::trim(match.afterSeparator);
 
       if (commentOrOtherText.empty() ||
-          boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine()))
+          idfTokenizer::isCommentOnlyLine(commentOrOtherText))
       {
         // reduce the text
-        start = matches[3].first;
-        stop = matches[3].second;
+        parsedText = match.remainder;
       } 
       else {
         // reduce the text; there may be multiple fields on this line
-        start = matches[2].first;
-        stop = matches[3].second;
+        parsedText = boost::string_ref(match.afterSeparator.data(),
+                                       match.afterSeparator.size() + match.remainder.size());
 
-        // matches[2] is not a comment
+        // match.afterSeparator is not a comment
         commentOrOtherText.clear();
       }
 
@@ -1542,11 +1569,10 @@ namespace detail {
 
         if (!commentOrOtherText.empty()) {
           // drop default comments
-          if (!boost::regex_match(commentOrOtherText,
-                                  commentRegex::editorCommentWhitespaceOnlyLine()))
+          if (!idfTokenizer::isEditorCommentWhitespaceOnlyLine(commentOrOtherText))
           {
             m_fieldComments.resize(m_fields.size());
-            m_fieldComments.back() = commentOrOtherText;
+            m_fieldComments.back() = commentOrOtherText.to_string();
           }
         }
 
@@ -1563,7 +1589,7 @@ namespace detail {
         LOG(Error, "IdfObject of type '" << m_iddObject.name() << "' " <<
           "cannot have field index of " << iddFieldIndex << ". " <<
           "Cutting off IdfObject field parsing here, with the following text " <<
-          "remaining: " << std::endl << fieldText << std::endl << std::string (start, stop));
+          "remaining: " << std::endl << fieldText << std::endl << parsedText);
         return;
       }
 
@@ -1571,8 +1597,7 @@ namespace detail {
       ++iddFieldIndex;
     } // while line matches
 
-    std::string unparsedText (start, stop);
-    boost::trim (unparsedText);
+    boost::string_ref unparsedText = idfTokenizer::trim(parsedText);
     if (!unparsedText.empty()) {
       LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: " 
         << std::endl << unparsedText);
@@ -1600,9 +1625,59 @@ namespace detail {
         }
       }
     }
+    updateNumericFields(0,numFields());
     return true;
   }
 
+  void IdfObject_Impl::updateNumericFields(unsigned begin, unsigned end) {
+    unsigned n = m_fields.size();
+    m_numericFields.resize(n);
+    for (unsigned index = begin; index < std::min(end,n); ++index) {
+      NumericField& numericField = m_numericFields[index];
+      numericField = NumericField();
+
+      OptionalIddField iddField = m_iddObject.getField(index);
+      if (!iddField) { continue; }
+      IddFieldType fieldType = iddField->properties().type;
+      if ((fieldType != IddFieldType::RealType) && (fieldType != IddFieldType::IntegerType)) {
+        continue;
+      }
+
+      const std::string& value = m_fields[index];
+      if (istringEqual(value,"") || 
+          istringEqual(value,"autosize") || 
+          istringEqual(value,"autocalculate"))
+      {
+        numericField.state = NumericField::Blank;
+        continue;
+      }
+
+      // leave unparseable text as Unparsed so the getters log the error on each call, as before
+      try {
+        numericField.value = boost::lexical_cast<double>(value);
+        numericField.state = NumericField::Numeric;
+      }
+      catch (const std::exception&) {}
+    }
+  }
+
+  const IdfObject_Impl::NumericField* IdfObject_Impl::parsedNumericField(unsigned index, 
+                                                                         bool returnDefault) const
+  {
+    if ((index >= m_fields.size()) || (index >= m_numericFields.size())) {
+      return nullptr;
+    }
+    const NumericField& result = m_numericFields[index];
+    if (result.state == NumericField::Unparsed) {
+      return nullptr;
+    }
+    // empty fields may resolve to the IDD default
+    if (returnDefault && m_fields[index].empty()) {
+      return nullptr;
+    }
+    return &result;
+  }
+
   UnsignedVector IdfObject_Impl::trimFieldIndices(const UnsignedVector& indices) const {
     unsigned n = m_fields.size(); // number of fields
     UnsignedVector result = indices;
@@ -1655,6 +1730,31 @@ namespace detail {
     return result;
   }
 
+  void IdfObject_Impl::nameChanged(const boost::optional<std::string>& oldName) {}
+
+  void IdfObject_Impl::truncateFields(unsigned n) {
+    if (n >= m_fields.size()) { return; }
+
+    boost::optional<std::string> oldName;
+    if (OptionalUnsigned nameIndex = m_iddObject.nameFieldIndex()) {
+      if ((*nameIndex >= n) && (*nameIndex < m_fields.size())) {
+        oldName = m_fields[*nameIndex];
+      }
+    }
+
+    m_fields.resize(n);
+    if (m_fieldComments.size() > n) {
+      m_fieldComments.resize(n);
+    }
+    if (m_numericFields.size() > n) {
+      m_numericFields.resize(n);
+    }
+
+    if (oldName) {
+      nameChanged(oldName);
+    }
+  }
+
   // QUERY HELPERS
 
 void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNames) const
@@ -29,6 +29,7 @@
 #include <utilities/core/Containers.hpp>
 
 #include <boost/optional.hpp>
+#include <boost/utility/string_ref.hpp>
 
 #include <QObject>
 #include <QUrl>
@@ -406,6 +407,16 @@ namespace detail {
     
     virtual boost::optional<double> getDoubleFromQuantity(unsigned index, const Quantity& q) const;
 
+    // SETTER HELPERS
+
+    /** Called after the name field is set or removed. oldName is the prior value of the name
+     *  field, if that field existed. */
+    virtual void nameChanged(const boost::optional<std::string>& oldName);
+
+    /** Drops all fields at or beyond index n, as when rolling back a failed edit, and reports
+     *  the loss of the name field through nameChanged. */
+    void truncateFields(unsigned n);
+
     // QUERY HELPERS
 
     virtual void populateValidityReport(ValidityReport& report, bool checkNames) const;
@@ -419,6 +430,23 @@ namespace detail {
     
    private:
 
+    // Parsed value of a real or integer field. Entries are filled in whenever field text is
+    // set, so the numeric getters never re-parse text and are safe to call concurrently.
+    struct NumericField {
+      // Unparsed: not a numeric IddField, or text that is not a number (getters fall back to
+      // converting the text, which logs the error). Blank: empty, autosize or autocalculate.
+      enum State { Unparsed, Blank, Numeric };
+
+      NumericField() : state(Unparsed), value(0.0) {}
+
+      State state;
+      double value;
+    };
+
+    // parallel to m_fields; may be shorter than m_fields, in which case the missing entries are
+    // treated as Unparsed
+    std::vector<NumericField> m_numericFields;
+
     IdfObject_Impl(){}
 
     // CONSTRUCTION HELPERS
@@ -436,13 +464,22 @@ namespace detail {
     void parse(const std::string& text, bool getIddFromFactory);
 
     // parse fields
-    void parseFields(const std::string& text);
+    void parseFields(boost::string_ref text);
 
     // GETTER AND SETTER HELPERS
 
     /** Set this object's IddObject to iddObject. */
     bool setIddObject(const IddObject& iddObject);
 
+    // Re-parse m_numericFields for indices [begin,end), and resize m_numericFields to match
+    // m_fields. Must be called whenever field text is set in place or the IddObject changes;
+    // appended fields that are missed only lose the fast path.
+    void updateNumericFields(unsigned begin, unsigned end);
+
+    // Returns the parsed entry for index if it can answer a numeric getter on its own, that is,
+    // if the field text has been parsed and the IDD default does not apply.
+    const NumericField* parsedNumericField(unsigned index, bool returnDefault) const;
+
     // remove any indices that are outside m_fields' range
     UnsignedVector trimFieldIndices(const UnsignedVector& indices) const;
 
@@ -0,0 +1,180 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "IdfTokenizer.hpp"
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  namespace {
+
+    // \s, and the characters removed by boost::trim
+    inline bool isSpace(char c) {
+      return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+    }
+
+    // \h
+    inline bool isBlank(char c) {
+      return (c == ' ') || (c == '\t');
+    }
+
+    // characters after which boost::regex considers a new line to start
+    inline bool isLineSeparator(char c) {
+      return (c == '\n') || (c == '\r') || (c == '\f');
+    }
+
+  }
+
+  boost::string_ref trimLeft(boost::string_ref text) {
+    std::size_t i = 0;
+    while ((i < text.size()) && isSpace(text[i])) { ++i; }
+    return text.substr(i);
+  }
+
+  boost::string_ref trimRight(boost::string_ref text) {
+    std::size_t n = text.size();
+    while ((n > 0) && isSpace(text[n - 1])) { --n; }
+    return text.substr(0, n);
+  }
+
+  boost::string_ref trim(boost::string_ref text) {
+    return trimRight(trimLeft(text));
+  }
+
+  bool getLine(boost::string_ref& buffer, boost::string_ref& line) {
+    if (buffer.empty()) {
+      return false;
+    }
+    std::size_t i = 0, n = buffer.size();
+    while ((i < n) && (buffer[i] != '\n') && (buffer[i] != '\r')) { ++i; }
+    line = buffer.substr(0, i);
+    if (i < n) {
+      if ((buffer[i] == '\r') && (i + 1 < n) && (buffer[i + 1] == '\n')) {
+        ++i;
+      }
+      ++i;
+    }
+    buffer.remove_prefix(i);
+    return true;
+  }
+
+  bool isCommentOnlyLine(boost::string_ref text) {
+    boost::string_ref rest = trimLeft(text);
+    return (!rest.empty()) && (rest[0] == '!');
+  }
+
+  bool isWhitespaceOnlyLine(boost::string_ref text) {
+    for (char c : text) {
+      if (!isBlank(c)) { return false; }
+    }
+    return true;
+  }
+
+  bool isWhitespaceOnlyBlock(boost::string_ref text) {
+    return trimLeft(text).empty();
+  }
+
+  bool isEditorCommentWhitespaceOnlyLine(boost::string_ref text) {
+    std::size_t i = 0;
+    while ((i < text.size()) && isBlank(text[i])) { ++i; }
+    boost::string_ref rest = text.substr(i);
+    if (rest.empty()) {
+      return true;
+    }
+    if (!rest.starts_with("!-")) {
+      return false;
+    }
+    for (char c : rest.substr(2)) {
+      if ((c == '\n') || (c == '\r') || (c == '\v')) { return false; }
+    }
+    return true;
+  }
+
+  bool isObjectEnd(boost::string_ref text) {
+    for (char c : text) {
+      if (c == ';') { return true; }
+      if (c == '!') { return false; }
+    }
+    return false;
+  }
+
+  bool isVersionObjectName(boost::string_ref text) {
+    std::size_t pos = text.find("ersion");
+    while (pos != boost::string_ref::npos) {
+      if ((pos > 0) && ((text[pos - 1] == 'v') || (text[pos - 1] == 'V'))) {
+        return true;
+      }
+      boost::string_ref rest = text.substr(pos + 1);
+      std::size_t next = rest.find("ersion");
+      pos = (next == boost::string_ref::npos) ? next : pos + 1 + next;
+    }
+    return false;
+  }
+
+  bool searchLine(boost::string_ref text, LineMatch& match) {
+    std::size_t n = text.size();
+    // each candidate match starts at the beginning of text or of a line
+    std::size_t start = 0;
+    while (true) {
+      std::size_t sep = start;
+      while ((sep < n) && (text[sep] != '!') && (text[sep] != ',') && (text[sep] != ';')) { ++sep; }
+      if (sep == n) {
+        return false;
+      }
+      if (text[sep] != '!') {
+        std::size_t lineEnd = text.substr(sep + 1).find('\n');
+        lineEnd = (lineEnd == boost::string_ref::npos) ? n : sep + 1 + lineEnd + 1;
+        match.field = text.substr(start, sep - start);
+        match.afterSeparator = text.substr(sep + 1, lineEnd - (sep + 1));
+        match.remainder = text.substr(lineEnd);
+        return true;
+      }
+      // comment reached before a separator, so no line starting at or before sep can match.
+      // move on to the next line start after the comment character.
+      start = sep + 1;
+      while ((start < n) &&
+             !(isLineSeparator(text[start - 1]) && !((text[start - 1] == '\r') && (text[start] == '\n'))))
+      {
+        ++start;
+      }
+      if (start == n) {
+        return false;
+      }
+    }
+  }
+
+  void splitCommentOnlyLine(boost::string_ref text,
+                            boost::string_ref& comment,
+                            boost::string_ref& remainder)
+  {
+    boost::string_ref rest = trimLeft(text);
+    rest.remove_prefix(1); // '!'
+    std::size_t lineEnd = rest.find('\n');
+    if (lineEnd == boost::string_ref::npos) {
+      comment = rest;
+      remainder = rest.substr(rest.size());
+    }
+    else {
+      comment = rest.substr(0, lineEnd);
+      remainder = rest.substr(lineEnd + 1);
+    }
+  }
+
+} // idfTokenizer
+} // openstudio
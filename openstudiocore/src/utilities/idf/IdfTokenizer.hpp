@@ -0,0 +1,86 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_IDF_IDFTOKENIZER_HPP
+#define UTILITIES_IDF_IDFTOKENIZER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <boost/utility/string_ref.hpp>
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  /** Hand-written scanners used to split IDF and OSM text into objects, fields and comments
+   *  without running regular expressions on every line. Each function gives the same answer as
+   *  the idfRegex or commentRegex expression named in its documentation. All functions operate on
+   *  views into a caller-owned buffer and do not allocate. */
+
+  /** Equivalent of boost::trim_left. */
+  UTILITIES_API boost::string_ref trimLeft(boost::string_ref text);
+
+  /** Equivalent of boost::trim_right. */
+  UTILITIES_API boost::string_ref trimRight(boost::string_ref text);
+
+  /** Equivalent of boost::trim. */
+  UTILITIES_API boost::string_ref trim(boost::string_ref text);
+
+  /** Extracts the next line from buffer, and removes it (and its line ending) from buffer. Lines
+   *  may end in "\n", "\r\n" or "\r". Returns false once buffer is empty. Equivalent to
+   *  std::getline on a stream filtered to posix line endings. */
+  UTILITIES_API bool getLine(boost::string_ref& buffer, boost::string_ref& line);
+
+  /** Equivalent of boost::regex_match(text, idfRegex::commentOnlyLine()). */
+  UTILITIES_API bool isCommentOnlyLine(boost::string_ref text);
+
+  /** Equivalent of boost::regex_match(text, commentRegex::whitespaceOnlyLine()). */
+  UTILITIES_API bool isWhitespaceOnlyLine(boost::string_ref text);
+
+  /** Equivalent of boost::regex_match(text, commentRegex::whitespaceOnlyBlock()). */
+  UTILITIES_API bool isWhitespaceOnlyBlock(boost::string_ref text);
+
+  /** Equivalent of boost::regex_match(text, commentRegex::editorCommentWhitespaceOnlyLine()). */
+  UTILITIES_API bool isEditorCommentWhitespaceOnlyLine(boost::string_ref text);
+
+  /** Equivalent of boost::regex_match(text, idfRegex::objectEnd()). */
+  UTILITIES_API bool isObjectEnd(boost::string_ref text);
+
+  /** Equivalent of boost::regex_match(text, iddRegex::versionObjectName()). */
+  UTILITIES_API bool isVersionObjectName(boost::string_ref text);
+
+  /** Result of searchLine. */
+  struct UTILITIES_API LineMatch {
+    boost::string_ref field;     // matches[1], before separator
+    boost::string_ref afterSeparator; // matches[2], after separator and through new line
+    boost::string_ref remainder; // matches[3], after new line
+  };
+
+  /** Equivalent of boost::regex_search(text, matches, idfRegex::line()). */
+  UTILITIES_API bool searchLine(boost::string_ref text, LineMatch& match);
+
+  /** Equivalent of boost::regex_search(text, matches, idfRegex::commentOnlyLine()) for text
+   *  that isCommentOnlyLine. comment is set to matches[1] and remainder to matches[2]. */
+  UTILITIES_API void splitCommentOnlyLine(boost::string_ref text,
+                                          boost::string_ref& comment,
+                                          boost::string_ref& remainder);
+
+} // idfTokenizer
+} // openstudio
+
+#endif // UTILITIES_IDF_IDFTOKENIZER_HPP
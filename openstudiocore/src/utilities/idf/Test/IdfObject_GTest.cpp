@@ -573,6 +573,59 @@ TEST_F(IdfFixture, IdfObject_IntFieldGetterWithReturnDefaultOption) {
   EXPECT_TRUE(object.getInt(5));
 }
 
+TEST_F(IdfFixture, IdfObject_NumericFieldsTrackText) {
+  std::stringstream text;
+  text << "Building," << std::endl
+       << "  MyBuilding," << std::endl
+       << "  15.5," << std::endl
+       << "  City," << std::endl
+       << "  ," << std::endl          // default .04
+       << "  0.4," << std::endl
+       << "  FullExterior," << std::endl
+       << "  25;";
+  OptionalIdfObject oObj = IdfObject::load(text.str());
+  ASSERT_TRUE(oObj);
+  IdfObject object = *oObj;
+
+  // parsed on load
+  ASSERT_TRUE(object.getDouble(1));
+  EXPECT_DOUBLE_EQ(15.5,object.getDouble(1).get());
+  EXPECT_EQ(25,object.getInt(6).get());
+  EXPECT_EQ(25u,object.getUnsigned(6).get());
+  EXPECT_FALSE(object.getDouble(3));
+  ASSERT_TRUE(object.getDouble(3,true));
+  EXPECT_DOUBLE_EQ(0.04,object.getDouble(3,true).get());
+
+  // follows every kind of set
+  EXPECT_TRUE(object.setDouble(1,-30.0));
+  EXPECT_DOUBLE_EQ(-30.0,object.getDouble(1).get());
+  EXPECT_TRUE(object.setString(1,"not a number"));
+  EXPECT_FALSE(object.getDouble(1));
+  EXPECT_TRUE(object.setString(1,""));
+  EXPECT_FALSE(object.getDouble(1));
+  EXPECT_DOUBLE_EQ(0.0,object.getDouble(1,true).get());
+  EXPECT_TRUE(object.setInt(6,-3));
+  EXPECT_EQ(-3,object.getInt(6).get());
+  EXPECT_FALSE(object.getUnsigned(6));
+
+  // copies carry their values, and diverge independently
+  IdfObject copy = object.clone();
+  EXPECT_EQ(-3,copy.getInt(6).get());
+  EXPECT_TRUE(copy.setInt(6,7));
+  EXPECT_EQ(7,copy.getInt(6).get());
+  EXPECT_EQ(-3,object.getInt(6).get());
+
+  // popped and re-pushed fields do not see stale values
+  IdfObject surface(IddObjectType::BuildingSurface_Detailed);
+  unsigned index = surface.iddObject().numFields();
+  EXPECT_FALSE(surface.pushExtensibleGroup(StringVector(3u,"1.5")).empty());
+  EXPECT_DOUBLE_EQ(1.5,surface.getDouble(index).get());
+  EXPECT_FALSE(surface.popExtensibleGroup().empty());
+  EXPECT_FALSE(surface.getDouble(index));
+  EXPECT_FALSE(surface.pushExtensibleGroup(StringVector(3u,"4")).empty());
+  EXPECT_DOUBLE_EQ(4.0,surface.getDouble(index).get());
+}
+
 TEST_F(IdfFixture, IdfObject_FieldSettingWithHiddenPushes) {
   // SHOULD BE VALID
   std::stringstream text;
@@ -0,0 +1,144 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+
+#include "../IdfTokenizer.hpp"
+#include "../IdfRegex.hpp"
+#include "../IdfFile.hpp"
+#include "../../idd/CommentRegex.hpp"
+#include "../../idd/IddRegex.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <sstream>
+
+using namespace openstudio;
+
+namespace {
+
+  std::vector<std::string> tokenizerTestStrings() {
+    std::vector<std::string> result;
+    result.push_back("");
+    result.push_back("   ");
+    result.push_back(" \t ");
+    result.push_back("\n\n");
+    result.push_back("! A comment");
+    result.push_back("   !- Name");
+    result.push_back("!-");
+    result.push_back("!- Name\r");
+    result.push_back("Zone,");
+    result.push_back("  Zone,  !- a comment");
+    result.push_back("  Zone 1;  !- Name");
+    result.push_back("  Zone 1;  ! Name");
+    result.push_back("Version,8.3;");
+    result.push_back("OS:Version,");
+    result.push_back("  {af63d539-6e16-4fd1-a10e-dafe3793373b}, !- Handle\n  8.3.0;   !- Version Identifier\n");
+    result.push_back("a, b, c;");
+    result.push_back("a ! b, c;");
+    result.push_back("a ! b, c;\nd, e;\n");
+    result.push_back("a ! b\r\nc, d");
+    result.push_back("a ! b\rc, d");
+    result.push_back("a ! b\fc; d");
+    result.push_back("! comment\n  ! comment 2\nZone,\n  Zone 1;  !- Name\n");
+    result.push_back("; !- Name\n");
+    result.push_back("x VERSION y");
+    result.push_back("versio");
+    return result;
+  }
+
+}
+
+TEST_F(IdfFixture, IdfTokenizer_MatchesRegexes)
+{
+  for (const std::string& text : tokenizerTestStrings()) {
+    SCOPED_TRACE(text);
+
+    EXPECT_EQ(boost::regex_match(text, idfRegex::commentOnlyLine()),
+              idfTokenizer::isCommentOnlyLine(text));
+    EXPECT_EQ(boost::regex_match(text, idfRegex::objectEnd()),
+              idfTokenizer::isObjectEnd(text));
+    EXPECT_EQ(boost::regex_match(text, commentRegex::whitespaceOnlyLine()),
+              idfTokenizer::isWhitespaceOnlyLine(text));
+    EXPECT_EQ(boost::regex_match(text, commentRegex::whitespaceOnlyBlock()),
+              idfTokenizer::isWhitespaceOnlyBlock(text));
+    EXPECT_EQ(boost::regex_match(text, commentRegex::editorCommentWhitespaceOnlyLine()),
+              idfTokenizer::isEditorCommentWhitespaceOnlyLine(text));
+    EXPECT_EQ(boost::regex_match(text, iddRegex::versionObjectName()),
+              idfTokenizer::isVersionObjectName(text));
+
+    boost::smatch matches;
+    idfTokenizer::LineMatch match;
+    bool found = boost::regex_search(text, matches, idfRegex::line());
+    ASSERT_EQ(found, idfTokenizer::searchLine(text, match));
+    if (found) {
+      EXPECT_EQ(std::string(matches[1].first, matches[1].second), match.field.to_string());
+      EXPECT_EQ(std::string(matches[2].first, matches[2].second), match.afterSeparator.to_string());
+      EXPECT_EQ(std::string(matches[3].first, matches[3].second), match.remainder.to_string());
+    }
+
+    if (idfTokenizer::isCommentOnlyLine(text)) {
+      ASSERT_TRUE(boost::regex_search(text, matches, idfRegex::commentOnlyLine()));
+      boost::string_ref comment, remainder;
+      idfTokenizer::splitCommentOnlyLine(text, comment, remainder);
+      EXPECT_EQ(std::string(matches[1].first, matches[1].second), comment.to_string());
+      EXPECT_EQ(std::string(matches[2].first, matches[2].second), remainder.to_string());
+    }
+
+    EXPECT_EQ(boost::trim_copy(text), idfTokenizer::trim(text).to_string());
+  }
+}
+
+TEST_F(IdfFixture, IdfTokenizer_GetLine)
+{
+  boost::string_ref buffer("a\nb\r\nc\rd\n\ne");
+  boost::string_ref line;
+  std::vector<std::string> lines;
+  while (idfTokenizer::getLine(buffer, line)) {
+    lines.push_back(line.to_string());
+  }
+  ASSERT_EQ(6u, lines.size());
+  EXPECT_EQ("a", lines[0]);
+  EXPECT_EQ("b", lines[1]);
+  EXPECT_EQ("c", lines[2]);
+  EXPECT_EQ("d", lines[3]);
+  EXPECT_EQ("", lines[4]);
+  EXPECT_EQ("e", lines[5]);
+}
+
+TEST_F(IdfFixture, IdfTokenizer_LineEndings)
+{
+  std::string text("! header\n\nZone,\n  Zone 1;  !- Name\n\n! comment\nZone,\n  Zone 2,  ! custom comment\n  0;\n");
+  std::stringstream unixStream(text);
+  OptionalIdfFile unixFile = IdfFile::load(unixStream, IddFileType::EnergyPlus);
+  ASSERT_TRUE(unixFile);
+
+  std::string dosText = boost::replace_all_copy(text, "\n", "\r\n");
+  std::stringstream dosStream(dosText);
+  OptionalIdfFile dosFile = IdfFile::load(dosStream, IddFileType::EnergyPlus);
+  ASSERT_TRUE(dosFile);
+
+  std::stringstream unixPrinted, dosPrinted;
+  unixFile->print(unixPrinted);
+  dosFile->print(dosPrinted);
+  EXPECT_EQ(unixPrinted.str(), dosPrinted.str());
+  EXPECT_EQ("! header", unixFile->header());
+  EXPECT_EQ(2u, unixFile->getObjectsByType(IddObjectType::Zone).size());
+}
@@ -20,6 +20,8 @@
 #include <gtest/gtest.h>
 #include "IdfFixture.hpp"
 #include "../WorkspaceWatcher.hpp"
+#include "../WorkspaceObjectWatcher.hpp"
+#include "../WorkspaceEditSession.hpp"
 #include "../Workspace.hpp"
 #include "../WorkspaceObject.hpp"
 #include "../IdfExtensibleGroup.hpp"
@@ -91,3 +93,74 @@ TEST_F(IdfFixture,WorkspaceWatcher_RemoveObjects)
   EXPECT_TRUE(result[0].handle().isNull());
 }
 
+class WorkspaceChangeCounter : public WorkspaceWatcher {
+ public:
+  WorkspaceChangeCounter(const Workspace& workspace)
+    : WorkspaceWatcher(workspace), numChanges(0)
+  {}
+
+  virtual void onChangeWorkspace() override {
+    ++numChanges;
+  }
+
+  unsigned numChanges;
+};
+
+TEST_F(IdfFixture,WorkspaceWatcher_EditSession)
+{
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::vector<WorkspaceObject> lights;
+  for (unsigned i = 0; i < 10; ++i) {
+    OptionalWorkspaceObject owo = workspace.addObject(IdfObject(IddObjectType::Lights));
+    ASSERT_TRUE(owo);
+    lights.push_back(*owo);
+  }
+
+  WorkspaceChangeCounter counter(workspace);
+  WorkspaceObjectWatcher objectWatcher(lights[0]);
+
+  // without a session every edit is signaled
+  EXPECT_TRUE(lights[0].setDouble(4, 100.0));
+  EXPECT_TRUE(lights[0].setDouble(4, 200.0));
+  EXPECT_EQ(2u, counter.numChanges);
+  EXPECT_TRUE(objectWatcher.dataChanged());
+  counter.numChanges = 0;
+  counter.clearState();
+  objectWatcher.clearState();
+
+  {
+    WorkspaceEditSession session(workspace);
+    EXPECT_TRUE(session.active());
+    {
+      // nested sessions only emit when the outermost one ends
+      WorkspaceEditSession nested(workspace);
+      for (WorkspaceObject& object : lights) {
+        EXPECT_TRUE(object.setName("Lights " + toString(object.handle())));
+        EXPECT_TRUE(object.setDouble(4, 300.0));
+      }
+    }
+    EXPECT_EQ(0u, counter.numChanges);
+    EXPECT_FALSE(counter.dirty());
+    EXPECT_FALSE(objectWatcher.dirty());
+
+    // removals are still signaled right away, the removed object's changes are dropped
+    EXPECT_TRUE(workspace.removeObject(lights.back().handle()));
+    EXPECT_TRUE(counter.objectRemoved());
+    EXPECT_EQ(0u, counter.numChanges);
+  }
+  EXPECT_EQ(1u, counter.numChanges);
+  EXPECT_TRUE(counter.dirty());
+  EXPECT_TRUE(objectWatcher.dirty());
+  EXPECT_TRUE(objectWatcher.dataChanged());
+  counter.numChanges = 0;
+
+  // ending early
+  WorkspaceEditSession session(workspace);
+  EXPECT_TRUE(lights[0].setDouble(4, 400.0));
+  EXPECT_EQ(0u, counter.numChanges);
+  session.end();
+  EXPECT_FALSE(session.active());
+  EXPECT_EQ(1u, counter.numChanges);
+  session.end();
+  EXPECT_EQ(1u, counter.numChanges);
+}
@@ -2094,3 +2094,140 @@ TEST_F(IdfFixture, Workspace_GetObjectsByNameUUID)
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", true).size());
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", false).size());
 }
+
+TEST_F(IdfFixture, Workspace_NameIndex)
+{
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  for (unsigned i = 0; i < 10; ++i) {
+    ASSERT_TRUE(ws.addObject(IdfObject(IddObjectType::Zone)));
+  }
+  EXPECT_EQ("Zone 11", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 11", ws.nextName(IddObjectType::Zone, true));
+
+  // lookups are case insensitive
+  OptionalWorkspaceObject zone = ws.getObjectByTypeAndName(IddObjectType::Zone, "zONE 5");
+  ASSERT_TRUE(zone);
+  EXPECT_EQ("Zone 5", zone->name().get());
+  EXPECT_EQ(1u, ws.getObjectsByName("ZONE 5").size());
+  EXPECT_EQ(10u, ws.getObjectsByName("zone", false).size());
+  EXPECT_EQ(10u, ws.getObjectsByTypeAndName(IddObjectType::Zone, "ZONE").size());
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Lights, "Zone 5"));
+
+  // renaming through setString is tracked
+  EXPECT_TRUE(zone->setString(ZoneFields::Name, "Core Zone"));
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Zone 5"));
+  EXPECT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "core zone"));
+  EXPECT_EQ(9u, ws.getObjectsByName("Zone", false).size());
+  EXPECT_EQ("Zone 11", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 5", ws.nextName(IddObjectType::Zone, true));
+
+  // removal is tracked
+  OptionalWorkspaceObject zone10 = ws.getObjectByTypeAndName(IddObjectType::Zone, "Zone 10");
+  ASSERT_TRUE(zone10);
+  EXPECT_TRUE(zone10->remove());
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Zone 10"));
+  EXPECT_EQ(8u, ws.getObjectsByName("Zone", false).size());
+  EXPECT_EQ("Zone 10", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 5", ws.nextName(IddObjectType::Zone, true));
+
+  // non-type-specific series
+  EXPECT_EQ("Core Zone 1", ws.nextName("Core Zone", false));
+  EXPECT_EQ("zone 10", ws.nextName("zone 3", false));
+
+  // swapped workspaces keep their indices
+  Workspace other(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  ws.swap(other);
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone", false).size());
+  EXPECT_EQ(8u, other.getObjectsByName("Zone", false).size());
+  zone = other.getObjectByTypeAndName(IddObjectType::Zone, "Core Zone");
+  ASSERT_TRUE(zone);
+  EXPECT_TRUE(zone->setName("Zone 20"));
+  EXPECT_TRUE(other.getObjectByTypeAndName(IddObjectType::Zone, "Zone 20"));
+  EXPECT_FALSE(other.getObjectByTypeAndName(IddObjectType::Zone, "Core Zone"));
+  EXPECT_EQ("Zone 21", other.nextName(IddObjectType::Zone, false));
+}
+
+TEST_F(IdfFixture, Workspace_HandleTables)
+{
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  std::vector<Handle> zoneHandles;
+  for (unsigned i = 0; i < 1000; ++i) {
+    OptionalWorkspaceObject zone = ws.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    zoneHandles.push_back(zone->handle());
+  }
+
+  // objects of a type are returned in the order they were added
+  WorkspaceObjectVector zones = ws.getObjectsByType(IddObjectType::Zone);
+  ASSERT_EQ(1000u, zones.size());
+  for (unsigned i = 0; i < 1000; ++i) {
+    EXPECT_EQ(zoneHandles[i], zones[i].handle());
+  }
+
+  // remove every other zone
+  std::vector<Handle> removedHandles;
+  std::vector<Handle> keptHandles;
+  for (unsigned i = 0; i < 1000; ++i) {
+    if (i % 2 == 0) {
+      removedHandles.push_back(zoneHandles[i]);
+    }else{
+      keptHandles.push_back(zoneHandles[i]);
+    }
+  }
+  EXPECT_TRUE(ws.removeObjects(removedHandles));
+  EXPECT_EQ(500u, ws.numObjectsOfType(IddObjectType::Zone));
+  for (const Handle& handle : removedHandles) {
+    EXPECT_FALSE(ws.isMember(handle));
+    EXPECT_FALSE(ws.getObject(handle));
+  }
+  for (const Handle& handle : keptHandles) {
+    EXPECT_TRUE(ws.isMember(handle));
+    EXPECT_TRUE(ws.getObject(handle));
+  }
+
+  // holes left by removal are skipped and reused without changing the order
+  for (unsigned i = 0; i < 1000; ++i) {
+    OptionalWorkspaceObject zone = ws.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    keptHandles.push_back(zone->handle());
+  }
+  zones = ws.getObjectsByType(IddObjectType::Zone);
+  ASSERT_EQ(keptHandles.size(), zones.size());
+  for (unsigned i = 0, n = keptHandles.size(); i < n; ++i) {
+    EXPECT_EQ(keptHandles[i], zones[i].handle());
+  }
+  EXPECT_EQ(keptHandles.size(), ws.getObjectsByReference("ZoneNames").size());
+}
+
+TEST_F(IdfFixture, Workspace_NameIndex_FailedEdit)
+{
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  // object without a name field
+  OptionalIdfObject oObj = IdfObject::load("Zone;");
+  ASSERT_TRUE(oObj);
+  ASSERT_EQ(0u, oObj->numFields());
+  OptionalWorkspaceObject zone = ws.addObject(*oObj);
+  ASSERT_TRUE(zone);
+  EXPECT_FALSE(zone->name());
+
+  // hidden pushing adds an empty name field, which must be dropped when the edit fails
+  EXPECT_FALSE(zone->setInt(ZoneFields::Multiplier, 0));
+  EXPECT_EQ(0u, zone->numFields());
+  EXPECT_FALSE(zone->name());
+  EXPECT_TRUE(ws.getObjectsByName("").empty());
+  EXPECT_TRUE(ws.getObjectsByTypeAndName(IddObjectType::Zone, "").empty());
+
+  EXPECT_TRUE(zone->setInt(ZoneFields::Multiplier, 2));
+  ASSERT_TRUE(zone->name());
+  EXPECT_EQ(1u, ws.getObjectsByName("").size());
+  EXPECT_TRUE(zone->setName("Core Zone"));
+  EXPECT_TRUE(ws.getObjectsByName("").empty());
+  EXPECT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Core Zone"));
+
+  // failed edits leave an existing name alone
+  EXPECT_FALSE(zone->setInt(ZoneFields::Type, 0));
+  EXPECT_EQ(1u, ws.getObjectsByName("core zone").size());
+}
@@ -53,6 +53,20 @@ namespace openstudio {
 
 namespace detail {
 
+  namespace {
+
+    // Key used by the Workspace_Impl name index. Two names have the same key if and only if they
+    // are istringEqual.
+    std::string nameIndexKey(const std::string& name) {
+      std::string result(name);
+      for (char& c : result) {
+        c = static_cast<char>(toupper(c));
+      }
+      return result;
+    }
+
+  }
+
   // CONSTRUCTORS
 
   Workspace_Impl::Workspace_Impl(StrictnessLevel level,IddFileType iddFileType) :
@@ -60,7 +74,10 @@ namespace detail {
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_editSessionDepth(0),
+      m_flushingEditSession(false),
+      m_changePending(false)
   {}
 
   Workspace_Impl::Workspace_Impl(const IdfFile& idfFile,
@@ -70,7 +87,10 @@ namespace detail {
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_editSessionDepth(0),
+      m_flushingEditSession(false),
+      m_changePending(false)
   {}
 
   Workspace_Impl::Workspace_Impl(const Workspace_Impl& other,bool keepHandles) :
@@ -79,7 +99,10 @@ namespace detail {
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+    m_editSessionDepth(0),
+    m_flushingEditSession(false),
+    m_changePending(false)
   {
     // m_workspaceObjectOrder
     OptionalIddObjectTypeVector iddOrderVector = other.order().iddOrder();
@@ -101,7 +124,10 @@ namespace detail {
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_editSessionDepth(0),
+      m_flushingEditSession(false),
+      m_changePending(false)
   {
     // m_workspaceObjectOrder
     OptionalIddObjectTypeVector iddOrderVector = other.order().iddOrder();
@@ -161,21 +187,31 @@ namespace detail {
     m_fastNaming = otherImpl->m_fastNaming;
     otherImpl->m_fastNaming = tfn;
 
-    WorkspaceObjectMap twop = m_workspaceObjectMap;
-    m_workspaceObjectMap = otherImpl->m_workspaceObjectMap;
-    otherImpl->m_workspaceObjectMap = twop;
+    m_workspaceObjectMap.swap(otherImpl->m_workspaceObjectMap);
 
     WorkspaceObjectOrder twoo = m_workspaceObjectOrder;
     m_workspaceObjectOrder = otherImpl->m_workspaceObjectOrder;
     otherImpl->m_workspaceObjectOrder = twoo;
 
-    IddObjectTypeMap tiotm = m_iddObjectTypeMap;
-    m_iddObjectTypeMap = otherImpl->m_iddObjectTypeMap;
-    otherImpl->m_iddObjectTypeMap = tiotm;
+    m_iddObjectTypeMap.swap(otherImpl->m_iddObjectTypeMap);
+
+    m_idfReferencesMap.swap(otherImpl->m_idfReferencesMap);
 
-    IdfReferencesMap tirm = m_idfReferencesMap;
-    m_idfReferencesMap = otherImpl->m_idfReferencesMap;
-    otherImpl->m_idfReferencesMap = tirm;
+    NameIndex tni = m_nameIndex;
+    m_nameIndex = otherImpl->m_nameIndex;
+    otherImpl->m_nameIndex = tni;
+
+    IddObjectTypeNameIndex tiotni = m_iddObjectTypeNameIndex;
+    m_iddObjectTypeNameIndex = otherImpl->m_iddObjectTypeNameIndex;
+    otherImpl->m_iddObjectTypeNameIndex = tiotni;
+
+    // objects report name changes to the workspace that now holds them
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      p.second->m_workspace = this;
+    }
+    for (const WorkspaceObjectMap::value_type& p : otherImpl->m_workspaceObjectMap) {
+      p.second->m_workspace = otherImpl.get();
+    }
   }
 
   // GETTERS
@@ -333,27 +369,10 @@ namespace detail {
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByName(const std::string& name,
                                                                 bool exactMatch) const
   {
-    WorkspaceObjectVector result;
     if (exactMatch) {
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
-        if (OptionalString candidate = p.second->name()) {
-          if (istringEqual(*candidate,name)) {
-            result.push_back(WorkspaceObject(p.second));
-          }
-        }
-      }
-    }
-    else {
-      std::string baseName = getBaseName(name);
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
-        if (OptionalString candidate = p.second->name()) {
-          if (baseNamesMatch(baseName, *candidate)) {
-            result.push_back(WorkspaceObject(p.second));
-          }
-        }
-      }
+      return getObjectsFromNameIndex(m_nameIndex.names,nameIndexKey(name));
     }
-    return result;
+    return getObjectsFromNameIndex(m_nameIndex.baseNames,nameIndexKey(getBaseName(name)));
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByType(IddObjectType objectType) const {
@@ -380,29 +399,21 @@ namespace detail {
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(
       IddObjectType objectType,const std::string& name) const
   {
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate,name)) {
-        return object;
-      }
-    }
-    return boost::none;
+    auto iotniLoc = m_iddObjectTypeNameIndex.find(objectType);
+    if (iotniLoc == m_iddObjectTypeNameIndex.end()) { return boost::none; }
+    auto loc = iotniLoc->second.names.find(nameIndexKey(name));
+    if (loc == iotniLoc->second.names.end()) { return boost::none; }
+    OS_ASSERT(!loc->second.empty());
+    return getObject(*(loc->second.begin()));
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByTypeAndName(
       IddObjectType objectType,
       const std::string& name) const
   {
-    WorkspaceObjectVector result;
-    std::string baseName = getBaseName(name);
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      if (OptionalString candidate = object.name()) {
-        if (baseNamesMatch(baseName, *candidate)) {
-          result.push_back(object);
-        }
-      }
-    }
-    return result;
+    auto iotniLoc = m_iddObjectTypeNameIndex.find(objectType);
+    if (iotniLoc == m_iddObjectTypeNameIndex.end()) { return WorkspaceObjectVector(); }
+    return getObjectsFromNameIndex(iotniLoc->second.baseNames,nameIndexKey(getBaseName(name)));
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByReference(
@@ -600,6 +611,7 @@ namespace detail {
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(),ptr));
       insertIntoIddObjectTypeMap(ptr);
       insertIntoIdfReferencesMap(ptr);
+      insertIntoNameIndex(ptr);
       emit progressValue(++i);
     }
 
@@ -1495,7 +1507,7 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr,sources,removedHandles);
-      emit onChange();
+      change();
       return true;
     }
     else {
@@ -1527,7 +1539,7 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData,sources,handles);
-      emit onChange();
+      change();
       return true;
     }
     else {
@@ -1604,6 +1616,25 @@ namespace detail {
     }
   }
 
+  void Workspace_Impl::updateNameIndex(const WorkspaceObject_Impl& object,
+                                       const boost::optional<std::string>& oldName)
+  {
+    auto womIt = m_workspaceObjectMap.find(object.handle());
+    if ((womIt == m_workspaceObjectMap.end()) || (womIt->second.get() != &object)) {
+      // not (yet) in this workspace, will be indexed on insertion
+      return;
+    }
+    IddObjectType type = object.iddObject().type();
+    if (oldName) {
+      removeFromNameIndex(m_nameIndex,object.handle(),*oldName);
+      removeFromNameIndex(m_iddObjectTypeNameIndex[type],object.handle(),*oldName);
+    }
+    if (OptionalString newName = object.name()) {
+      addToNameIndex(m_nameIndex,object.handle(),*newName);
+      addToNameIndex(m_iddObjectTypeNameIndex[type],object.handle(),*newName);
+    }
+  }
+
   void Workspace_Impl::setFastNaming(bool fastNaming)
   {
     m_fastNaming = fastNaming;
@@ -1629,6 +1660,52 @@ namespace detail {
     return m_workspaceObjectOrder.sort(handles);
   }
 
+  // EDIT SESSIONS
+
+  void Workspace_Impl::beginEditSession() {
+    ++m_editSessionDepth;
+  }
+
+  void Workspace_Impl::endEditSession() {
+    OS_ASSERT(m_editSessionDepth > 0);
+    --m_editSessionDepth;
+    if (m_editSessionDepth > 0) {
+      return;
+    }
+
+    // each changed object emits its accumulated diffs once, objects removed since are skipped.
+    // change() only records workspace level changes until all objects are done.
+    bool wasFlushing = m_flushingEditSession;
+    m_flushingEditSession = true;
+
+    HandleTable<bool> deferredChanges;
+    deferredChanges.swap(m_deferredChanges);
+    for (const auto& deferredChange : deferredChanges) {
+      auto it = m_workspaceObjectMap.find(deferredChange.first);
+      if (it != m_workspaceObjectMap.end()) {
+        it->second->emitChangeSignals();
+      }
+    }
+
+    m_flushingEditSession = wasFlushing;
+    if (!m_flushingEditSession && m_changePending) {
+      m_changePending = false;
+      emit onChange();
+    }
+  }
+
+  bool Workspace_Impl::inEditSession() const {
+    return (m_editSessionDepth > 0);
+  }
+
+  bool Workspace_Impl::deferChangeSignals(const Handle& handle) {
+    if (m_editSessionDepth == 0) {
+      return false;
+    }
+    m_deferredChanges.insert(HandleTable<bool>::value_type(handle, true));
+    return true;
+  }
+
   // QUERIES
 
   unsigned Workspace_Impl::numObjects() const {
@@ -1681,8 +1758,7 @@ namespace detail {
       return toString(createUUID());
     }
 
-    WorkspaceObjectVector objectsInSeries = getObjectsByName(name,false);
-    return constructNextName(name,objectsInSeries,fillIn);
+    return constructNextName(name,m_nameIndex,fillIn);
   }
 
   std::string Workspace_Impl::nextName(const IddObjectType& iddObjectType, bool fillIn) const {
@@ -1695,8 +1771,11 @@ namespace detail {
       return std::string();
     }
     std::string name = iddObjectNameToIdfObjectName(iddObject->name());
-    WorkspaceObjectVector objectsInSeries = getObjectsByTypeAndName(iddObjectType,name);
-    return constructNextName(name,objectsInSeries,fillIn);
+    auto iotniLoc = m_iddObjectTypeNameIndex.find(iddObjectType);
+    if (iotniLoc == m_iddObjectTypeNameIndex.end()) {
+      return constructNextName(name,NameIndex(),fillIn);
+    }
+    return constructNextName(name,iotniLoc->second,fillIn);
   }
 
   bool Workspace_Impl::isValid() const {
@@ -1950,6 +2029,21 @@ namespace detail {
     return objectName;
   }
 
+  std::vector<WorkspaceObject> Workspace_Impl::getObjectsFromNameIndex(
+      const NameHandlesMap& index, const std::string& key) const
+  {
+    WorkspaceObjectVector result;
+    auto loc = index.find(key);
+    if (loc == index.end()) { return result; }
+    result.reserve(loc->second.size());
+    for (const Handle& handle : loc->second) {
+      auto womIt = m_workspaceObjectMap.find(handle);
+      OS_ASSERT(womIt != m_workspaceObjectMap.end());
+      result.push_back(WorkspaceObject(womIt->second));
+    }
+    return result;
+  }
+
   boost::optional<WorkspaceObject> Workspace_Impl::getEquivalentObject(
       const IdfObject& other) const
   {
@@ -2028,6 +2122,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(ptr);
 
+    // NameIndex
+    insertIntoNameIndex(ptr);
+
     return true;
   }
 
@@ -2051,6 +2148,71 @@ namespace detail {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+
+  void Workspace_Impl::insertIntoNameIndex(
+      const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
+  {
+    if (OptionalString name = objectImplPtr->name()) {
+      addToNameIndex(m_nameIndex,objectImplPtr->handle(),*name);
+      addToNameIndex(m_iddObjectTypeNameIndex[objectImplPtr->iddObject().type()],
+                     objectImplPtr->handle(),
+                     *name);
+    }
+  }
+
+  void Workspace_Impl::removeFromNameIndex(
+      const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
+  {
+    if (OptionalString name = objectImplPtr->name()) {
+      removeFromNameIndex(m_nameIndex,objectImplPtr->handle(),*name);
+      auto iotniLoc = m_iddObjectTypeNameIndex.find(objectImplPtr->iddObject().type());
+      if (iotniLoc != m_iddObjectTypeNameIndex.end()) {
+        removeFromNameIndex(iotniLoc->second,objectImplPtr->handle(),*name);
+      }
+    }
+  }
+
+  void Workspace_Impl::addToNameIndex(NameIndex& index,
+                                      const Handle& handle,
+                                      const std::string& name) const
+  {
+    std::string baseKey = nameIndexKey(getBaseName(name));
+    index.names[nameIndexKey(name)].insert(handle);
+    index.baseNames[baseKey].insert(handle);
+    if (boost::optional<int> suffix = getNameSuffix(name)) {
+      ++(index.suffixes[baseKey][*suffix]);
+    }
+  }
+
+  void Workspace_Impl::removeFromNameIndex(NameIndex& index,
+                                           const Handle& handle,
+                                           const std::string& name) const
+  {
+    std::string baseKey = nameIndexKey(getBaseName(name));
+
+    auto nLoc = index.names.find(nameIndexKey(name));
+    if (nLoc == index.names.end() || (nLoc->second.erase(handle) == 0)) {
+      // handle was not indexed under name
+      return;
+    }
+    if (nLoc->second.empty()) { index.names.erase(nLoc); }
+
+    auto bnLoc = index.baseNames.find(baseKey);
+    OS_ASSERT(bnLoc != index.baseNames.end());
+    bnLoc->second.erase(handle);
+    if (bnLoc->second.empty()) { index.baseNames.erase(bnLoc); }
+
+    if (boost::optional<int> suffix = getNameSuffix(name)) {
+      auto sLoc = index.suffixes.find(baseKey);
+      OS_ASSERT(sLoc != index.suffixes.end());
+      auto countLoc = sLoc->second.find(*suffix);
+      OS_ASSERT(countLoc != sLoc->second.end());
+      if (--(countLoc->second) == 0) {
+        sLoc->second.erase(countLoc);
+        if (sLoc->second.empty()) { index.suffixes.erase(sLoc); }
+      }
+    }
+  }
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2261,6 +2423,9 @@ namespace detail {
       m_workspaceObjectOrder.erase(handle);
     }
 
+    // NameIndex
+    removeFromNameIndex(objectImplPtr);
+
     // WorkspaceObjectMap
     auto womIt = m_workspaceObjectMap.find(handle);
     m_workspaceObjectMap.erase(womIt);
@@ -2305,7 +2470,7 @@ namespace detail {
     connect(object.getImpl<WorkspaceObject_Impl>().get(), &WorkspaceObject_Impl::onChange, this, &Workspace_Impl::change);
     emit addWorkspaceObject(object, object.iddObject().type(), object.handle());
     emit addWorkspaceObject(object.getImpl<WorkspaceObject_Impl>(), object.iddObject().type(), object.handle());
-    emit onChange();
+    change();
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2323,6 +2488,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(savedObject.objectImplPtr);
 
+    // NameIndex
+    insertIntoNameIndex(savedObject.objectImplPtr);
+
     // Fix Pointers
     savedObject.objectImplPtr->restorePointers();
 
@@ -2504,36 +2672,35 @@ namespace detail {
   // QUERIES
 
   std::string Workspace_Impl::constructNextName(const std::string& objectName,
-                                                const std::vector<WorkspaceObject>& objectsInTheSeries,
+                                                const NameIndex& index,
                                                 bool fillIn) const
   {
-    vector<int> takenValues;
-    for (const WorkspaceObject& object : objectsInTheSeries) {
-      if (boost::optional<int> takenSuffix = getNameSuffix(*(object.name()))) {
-        takenValues.push_back(*takenSuffix);
-      }
-    }
-    std::sort(takenValues.begin(), takenValues.end());
-    takenValues.erase(std::unique(takenValues.begin(), takenValues.end()), takenValues.end());
+    std::string baseName = getBaseName(objectName);
 
     int suffix(1);
-    if (fillIn) {
-      for (int usedSuffix : takenValues) {
-        if (usedSuffix == suffix) {
-          ++suffix;
-        }
-        else {
-          break;
-        }
+    auto loc = index.suffixes.find(nameIndexKey(baseName));
+    if (loc != index.suffixes.end()) {
+      // sorted, unique suffixes in use
+      const std::map<int,unsigned>& takenValues = loc->second;
+      OS_ASSERT(!takenValues.empty());
+      int largest = takenValues.rbegin()->first;
+      if (!fillIn || ((takenValues.begin()->first == 1) && (largest == int(takenValues.size())))) {
+        // no holes to fill in
+        suffix = largest + 1;
       }
-    }
-    else {
-      if (!takenValues.empty()) {
-        suffix = *(takenValues.rbegin()) + 1;
+      else {
+        for (const std::pair<const int,unsigned>& usedSuffix : takenValues) {
+          if (usedSuffix.first == suffix) {
+            ++suffix;
+          }
+          else {
+            break;
+          }
+        }
       }
     }
 
-    return getBaseName(objectName) + ' ' + boost::lexical_cast<std::string>(suffix);
+    return baseName + ' ' + boost::lexical_cast<std::string>(suffix);
   }
 
   std::vector< std::vector<WorkspaceObject> > Workspace_Impl::nameConflicts(
@@ -2605,6 +2772,10 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    if ((m_editSessionDepth > 0) || m_flushingEditSession) {
+      m_changePending = true;
+      return;
+    }
     emit onChange();
   }
 
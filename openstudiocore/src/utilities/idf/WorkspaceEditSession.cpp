@@ -0,0 +1,51 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "WorkspaceEditSession.hpp"
+#include "Workspace.hpp"
+#include "Workspace_Impl.hpp"
+
+namespace openstudio {
+
+WorkspaceEditSession::WorkspaceEditSession(const Workspace& workspace)
+  : m_impl(workspace.getImpl<detail::Workspace_Impl>())
+{
+  m_impl->beginEditSession();
+}
+
+WorkspaceEditSession::~WorkspaceEditSession()
+{
+  end();
+}
+
+void WorkspaceEditSession::end()
+{
+  if (m_impl) {
+    std::shared_ptr<detail::Workspace_Impl> impl;
+    impl.swap(m_impl);
+    impl->endEditSession();
+  }
+}
+
+bool WorkspaceEditSession::active() const
+{
+  return static_cast<bool>(m_impl);
+}
+
+} // openstudio
@@ -0,0 +1,76 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_IDF_WORKSPACEEDITSESSION_HPP
+#define UTILITIES_IDF_WORKSPACEEDITSESSION_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <memory>
+
+namespace openstudio {
+
+class Workspace;
+
+namespace detail {
+  class Workspace_Impl;
+}
+
+/** WorkspaceEditSession batches the change signals of a Workspace (or Model) for its lifetime.
+ *  While a session is open, objects that change keep their diffs instead of emitting
+ *  onChange, onDataChange, onNameChange and onRelationshipChange. When the outermost session
+ *  ends, each object that changed emits its signals once and the Workspace emits onChange once.
+ *  Objects still clear their own caches as soon as they change, see
+ *  WorkspaceObject_Impl::onInvalidateCaches, so reads within the session are up to date.
+ *  Signals for adding and removing objects are not deferred, so watchers still see objects
+ *  while they are in the Workspace. Sessions may be nested.
+ *
+ *  \code
+ *  {
+ *    WorkspaceEditSession session(model);
+ *    for (Surface surface : model.getModelObjects<Surface>()) {
+ *      surface.setName(...);
+ *    }
+ *  } // signals are emitted here
+ *  \endcode */
+class UTILITIES_API WorkspaceEditSession {
+ public:
+
+  explicit WorkspaceEditSession(const Workspace& workspace);
+
+  /** Ends the session if it was not ended already. */
+  ~WorkspaceEditSession();
+
+  /** Ends the session early. */
+  void end();
+
+  /** Returns true until the session ends. */
+  bool active() const;
+
+ private:
+
+  WorkspaceEditSession(const WorkspaceEditSession& other);
+  WorkspaceEditSession& operator=(const WorkspaceEditSession& other);
+
+  std::shared_ptr<detail::Workspace_Impl> m_impl;
+};
+
+} // openstudio
+
+#endif // UTILITIES_IDF_WORKSPACEEDITSESSION_HPP
@@ -907,6 +907,14 @@ namespace detail {
       return;
     }
 
+    // caches are cleared right away, reads later in an edit session must not see stale values
+    emit onInvalidateCaches();
+
+    // during an edit session the diffs accumulate and the signals are emitted when it ends
+    if (m_workspace && m_initialized && m_workspace->deferChangeSignals(m_handle)){
+      return;
+    }
+
     bool nameChange = false;
     bool dataChange = false;
 
@@ -1047,6 +1055,12 @@ namespace detail {
     }
   }
 
+  void WorkspaceObject_Impl::nameChanged(const boost::optional<std::string>& oldName) {
+    if (!m_handle.isNull() && m_workspace) {
+      m_workspace->updateNameIndex(*this,oldName);
+    }
+  }
+
   // PRIVATE
 
   // SETTERS
@@ -1123,6 +1137,24 @@ namespace detail {
     while (popResult && (numFields() > n)) {
       popResult = popField();
     }
+
+    // popField stops at minFields, but an object that started out shorter than that must still
+    // get its original fields back, and the name index must forget any name pushed in the interim
+    if (numFields() > n) {
+      for (unsigned index = n, N = numFields(); index < N; ++index) {
+        if (canBeSource(index)) {
+          OS_ASSERT(m_sourceData);
+          if (getIteratorAtFieldIndex<SourceData>(m_sourceData->pointers,index) !=
+              m_sourceData->pointers.end())
+          {
+            nullifyPointer(index);
+            auto fpIt = getIteratorAtFieldIndex<SourceData>(m_sourceData->pointers,index);
+            m_sourceData->pointers.erase(fpIt);
+          }
+        }
+      }
+      truncateFields(n);
+    }
   }
 
   bool WorkspaceObject_Impl::popField() {
@@ -1132,11 +1164,16 @@ namespace detail {
     // last field must be nonextensible, and final size must satisfy minimum number of fields
     if ((index >= minFields()) && (numExtensibleGroups() == 0)) {
       // delete field
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], boost::none));
+      std::string oldValue = m_fields[index];
+      m_diffs.push_back(IdfObjectDiff(index, oldValue, boost::none));
       m_fields.pop_back();
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
       }
+      OptionalUnsigned nameIndex = iddObject().nameFieldIndex();
+      if (nameIndex && (index == *nameIndex)) {
+        nameChanged(oldValue);
+      }
     } else {
       return false;
     }
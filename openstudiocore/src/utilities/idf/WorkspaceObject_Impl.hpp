@@ -287,6 +287,11 @@ namespace detail {
      *  access any methods of this object as it is invalid. */
     void onRemoveFromWorkspace(Handle handle) const;
 
+    /** Emitted whenever this object changes, before onChange. Unlike onChange it is not deferred
+     *  by a WorkspaceEditSession, so caches of values computed from this object should be
+     *  cleared here. */
+    void onInvalidateCaches() const;
+
    protected:
 
     friend class Workspace_Impl;
@@ -311,6 +316,9 @@ namespace detail {
      *  objects. */
     void restorePointers();
 
+    /** Keeps the Workspace_Impl name index in sync with this object's name. */
+    virtual void nameChanged(const boost::optional<std::string>& oldName);
+
     // QUERY HELPERS
 
     virtual void populateValidityReport(ValidityReport& report,bool checkNames) const;
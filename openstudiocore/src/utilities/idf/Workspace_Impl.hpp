@@ -26,6 +26,7 @@
 #include <utilities/idf/WorkspaceObjectOrder.hpp>
 #include <utilities/idf/ValidityEnums.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
+#include <utilities/idf/HandleTable.hpp>
 
 #include <utilities/idd/IddFileAndFactoryWrapper.hpp>
 
@@ -38,6 +39,7 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <unordered_map>
 
 namespace openstudio {
 
@@ -338,6 +340,11 @@ namespace detail {
                                    unsigned index,
                                    const WorkspaceObject& targetObject);
 
+    /** Update the name index after the name field of object changed from oldName. Called by
+     *  WorkspaceObject_Impl; does nothing if object is not (yet) in this Workspace. */
+    void updateNameIndex(const WorkspaceObject_Impl& object,
+                         const boost::optional<std::string>& oldName);
+
     /** Setting fast naming to true reduces the time taken to create names by using a UUID as the name.
      *   This UUID is not the same as the object's handle.
      */
@@ -363,6 +370,26 @@ namespace detail {
     /** Sort the handles. */
     std::vector<Handle> sort(const std::vector<Handle>& handles) const;
 
+    //@}
+    /** @name Edit Sessions */
+    //@{
+
+    /** Starts deferring change signals, see WorkspaceEditSession. Sessions may be nested. */
+    void beginEditSession();
+
+    /** Ends the innermost edit session. When the outermost session ends, each object changed
+     *  during the session emits its change signals once, then this workspace emits onChange once
+     *  if anything changed. */
+    void endEditSession();
+
+    /** Returns true if an edit session is open. */
+    bool inEditSession() const;
+
+    /** Called by an object in this workspace before it emits its change signals. Returns true if
+     *  the signals are deferred to the end of the edit session, in which case the object keeps
+     *  its diffs until then. */
+    bool deferChangeSignals(const Handle& handle);
+
     //@}
     /** @name Queries */
     //@{
@@ -485,7 +512,8 @@ namespace detail {
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper; // IDD file to be used for validity checking
     bool m_fastNaming;
 
-    typedef std::map<Handle, std::shared_ptr<WorkspaceObject_Impl> > WorkspaceObjectMap;
+    // hash table of objects identified by UUID, iterates in insertion order
+    typedef HandleTable<std::shared_ptr<WorkspaceObject_Impl> > WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
 
     // object for ordering objects in the collection.
@@ -499,6 +527,26 @@ namespace detail {
     typedef std::map<std::string, WorkspaceObjectMap> IdfReferencesMap; // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // case-insensitive name index, keyed by upper-cased names. handle sets keep lookups in a
+    // deterministic (handle) order.
+    typedef std::unordered_map<std::string, std::set<Handle> > NameHandlesMap;
+    struct NameIndex {
+      NameHandlesMap names;     // full name -> objects
+      NameHandlesMap baseNames; // name with any integer suffix removed -> objects
+      std::unordered_map<std::string, std::map<int,unsigned> > suffixes; // base name -> suffix counts
+    };
+    NameIndex m_nameIndex;
+
+    // name index per IddObjectType
+    typedef std::map<IddObjectType, NameIndex> IddObjectTypeNameIndex;
+    IddObjectTypeNameIndex m_iddObjectTypeNameIndex;
+
+    // edit session state, objects with deferred change signals are kept in the order they changed
+    unsigned m_editSessionDepth;
+    bool m_flushingEditSession;
+    bool m_changePending;
+    HandleTable<bool> m_deferredChanges;
+
     // data object for undos
     struct SavedWorkspaceObject {
       Handle                   handle;
@@ -525,6 +573,10 @@ namespace detail {
 
     boost::optional<WorkspaceObject> getEquivalentObject(const IdfObject& other) const;
 
+    // Returns the objects listed under key in index, in handle order.
+    std::vector<WorkspaceObject> getObjectsFromNameIndex(const NameHandlesMap& index,
+                                                         const std::string& key) const;
+
     // SETTERS
 
     // Replace m_iddFactoryWrapper if workspace remains valid.
@@ -539,6 +591,14 @@ namespace detail {
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    void insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void removeFromNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void addToNameIndex(NameIndex& index, const Handle& handle, const std::string& name) const;
+
+    void removeFromNameIndex(NameIndex& index, const Handle& handle, const std::string& name) const;
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other,
                                        const std::vector<unsigned>& toIgnore);
@@ -578,9 +638,10 @@ namespace detail {
 
     // QUERIES
 
-    /** Returns name with the next available integer suffix. */
+    /** Returns name with the next available integer suffix, as determined by the suffixes
+     *  recorded in index. */
     std::string constructNextName(const std::string& objectName,
-                                  const std::vector<WorkspaceObject>& objectsInTheSeries,
+                                  const NameIndex& index,
                                   bool fillIn) const;
 
     std::vector< std::vector<WorkspaceObject> > nameConflicts(
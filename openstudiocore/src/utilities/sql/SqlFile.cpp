@@ -1370,6 +1370,26 @@ SqlFileTimeSeriesQueryVector SqlFile::expandQuery(const SqlFileTimeSeriesQuery&
   return result;
 }
 
+std::vector<openstudio::OptionalTimeSeries> SqlFile::timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::pair<std::string, std::string> >& namesAndKeyValues)
+{
+  std::vector<openstudio::OptionalTimeSeries> result;
+  if (m_impl){
+    result = m_impl->timeSeries(envPeriod, reportingFrequency, namesAndKeyValues);
+  }else{
+    result.resize(namesAndKeyValues.size());
+  }
+  return result;
+}
+
+bool SqlFile::timeSeriesValues(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue, std::vector<double>& values)
+{
+  if (m_impl){
+    return m_impl->timeSeriesValues(envPeriod, reportingFrequency, timeSeriesName, keyValue, values);
+  }
+  values.clear();
+  return false;
+}
+
 TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   TimeSeriesVector result;
   if (m_impl) {
@@ -1663,6 +1683,26 @@ Matrix SqlFile::illuminanceMap(const int& hourlyReportIndex) const
   return result;
 }
 
+/// all hourly reports of the illuminance map
+IlluminanceMapSeries SqlFile::illuminanceMapSeries(const std::string& name) const
+{
+  IlluminanceMapSeries result;
+  if (m_impl){
+    result = m_impl->illuminanceMapSeries(name);
+  }
+  return result;
+}
+
+/// all hourly reports of the illuminance map
+IlluminanceMapSeries SqlFile::illuminanceMapSeries(const int& mapIndex) const
+{
+  IlluminanceMapSeries result;
+  if (m_impl){
+    result = m_impl->illuminanceMapSeries(mapIndex);
+  }
+  return result;
+}
+
 std::vector<SummaryData> SqlFile::getSummaryData() const
 {
   if (m_impl)
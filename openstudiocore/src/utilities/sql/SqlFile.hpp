@@ -30,6 +30,7 @@
 #include "../data/Matrix.hpp"
 #include "../data/DataEnums.hpp"
 #include "../data/EndUses.hpp"
+#include "../data/IlluminanceMapSeries.hpp"
 
 #include "../units/SIUnit.hpp"
 
@@ -684,6 +685,22 @@ class UTILITIES_API SqlFile {
                                          const std::string& timeSeriesName,
                                          const std::string& keyValue);
 
+  /** Returns the time series for each (timeSeriesName, keyValue) pair in namesAndKeyValues, in the same
+   *  order. Pairs not found for envPeriod and reportingFrequency give empty entries. Each report table is
+   *  read in one pass rather than once per series, and series reported at the same times share one
+   *  decoded time axis. */
+  std::vector<boost::optional<TimeSeries> > timeSeries(const std::string& envPeriod,
+                                                       const std::string& reportingFrequency,
+                                                       const std::vector<std::pair<std::string, std::string> >& namesAndKeyValues);
+
+  /** Reads the values of the time series matching timeSeriesName, keyValue, envPeriod, and reportingFrequency
+   *  into values, reusing its storage. Returns false if there is no such time series. */
+  bool timeSeriesValues(const std::string& envPeriod,
+                        const std::string& reportingFrequency,
+                        const std::string& timeSeriesName,
+                        const std::string& keyValue,
+                        std::vector<double>& values);
+
   /** Expands query to create a vector of all matching queries. The returned queries will have
    *  one environment period, one reporting frequency, and one time series name specified. The
    *  returned queries will also be "vetted". */
@@ -772,6 +789,14 @@ class UTILITIES_API SqlFile {
    *  value(i,j) is the illuminance at x(i), y(j) fills in x,y, illuminance*/
   void illuminanceMap(const int& hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const;
 
+  /** all hourly reports of the illuminance map, loaded with a single query
+   *  value(t,i,j) is the illuminance at x(i), y(j) at dateTimes()[t] */
+  IlluminanceMapSeries illuminanceMapSeries(const std::string& name) const;
+
+  /** all hourly reports of the illuminance map at mapIndex, loaded with a single query
+   *  value(t,i,j) is the illuminance at x(i), y(j) at dateTimes()[t] */
+  IlluminanceMapSeries illuminanceMapSeries(const int& mapIndex) const;
+
   /// Returns the summary data for each installlocation and fuel type found in report variables
   std::vector<SummaryData> getSummaryData() const;
 
@@ -29,6 +29,13 @@
 // These functions return via reference parameters - something we cannot support with SWIG
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(const std::string &, double &, double &);
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(int, double &, double &);
+%ignore openstudio::SqlFile::timeSeriesValues(const std::string &, const std::string &, const std::string &, const std::string &, std::vector<double> &);
+
+// IlluminanceMapSeries is not wrapped
+%ignore openstudio::SqlFile::illuminanceMapSeries;
+
+// vectors of optional time series are not wrapped
+%ignore openstudio::SqlFile::timeSeries(const std::string &, const std::string &, const std::vector<std::pair<std::string, std::string> > &);
 
 // create an instantiation of the optional classes
 %template(OptionalSqlFile) boost::optional<openstudio::SqlFile>;
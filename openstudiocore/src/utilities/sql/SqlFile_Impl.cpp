@@ -385,6 +385,9 @@ namespace openstudio{
 
     bool SqlFile_Impl::close()
     {
+      finalizeCachedStatements();
+      m_timeTables.clear();
+
       if (m_connectionOpen)
       {
         sqlite3_close(m_db);
@@ -1818,13 +1821,13 @@ namespace openstudio{
     {
 
       openstudio::TimeSeriesVector vec;
-      openstudio::OptionalTimeSeries ts;
 
-      std::vector<std::string> vecKeyValues = availableKeyValues(envPeriod, reportingFrequency, timeSeriesName);
-      std::vector<std::string>::iterator iter;
-      for (iter=vecKeyValues.begin();iter!=vecKeyValues.end();++iter)
-      {
-        ts = timeSeries(envPeriod, reportingFrequency, timeSeriesName, *iter);
+      std::vector<std::pair<std::string, std::string> > namesAndKeyValues;
+      for (const std::string& keyValue : availableKeyValues(envPeriod, reportingFrequency, timeSeriesName)) {
+        namesAndKeyValues.push_back(std::make_pair(timeSeriesName, keyValue));
+      }
+
+      for (const openstudio::OptionalTimeSeries& ts : timeSeries(envPeriod, reportingFrequency, namesAndKeyValues)) {
         if (ts){
           vec.push_back(*ts);
         }
@@ -2051,57 +2054,211 @@ namespace openstudio{
 
     std::vector<double> SqlFile_Impl::timeSeriesValues(const DataDictionaryItem& dataDictionary)
     {
+      std::vector<int> timeIndices;
       std::vector<double> stdValues;
+      readReportData(dataDictionary, timeIndices, stdValues);
 
-      if (m_db)
-      {
-        std::stringstream s;
-        s << "SELECT VariableValue FROM ";
-        s << dataDictionary.table;
-        // ensure that there are time indice values for variablevalues (slows from 0.094s to 0.125s)
-        s << " rvd INNER JOIN Time ti ON ti.TimeIndex = rvd.TimeIndex";
-        //    s << " INNER JOIN EnvironmentPeriods ep ON ti.EnvironmentPeriodIndex = ep.EnvironmentPeriodIndex";
-        if (dataDictionary.table == "ReportMeterData")
-        {
-          s << " WHERE rvd.ReportMeterDataDictionaryIndex=";
+      LOG(Debug, "Created Timeseries with " << stdValues.size() << " values");
+
+      return stdValues;
+    }
+
+    bool SqlFile_Impl::timeSeriesValues(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue, std::vector<double>& values)
+    {
+      values.clear();
+
+      std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+      DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type::iterator iEpRfNKv = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().find(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesName, keyValue));
+
+      if (iEpRfNKv == m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().end()) {
+        LOG(Debug,"Tuple: " << queryEnvPeriod << ", " << reportingFrequency << ", " << timeSeriesName << ", " << keyValue << " not found in data dictionary.");
+        return false;
+      }
+
+      openstudio::Vector cached = iEpRfNKv->timeSeries.values();
+      if (!cached.empty()) {
+        values.assign(cached.begin(), cached.end());
+        return true;
+      }
+
+      std::vector<int> timeIndices;
+      return readReportData(*iEpRfNKv, timeIndices, values);
+    }
+
+    sqlite3_stmt* SqlFile_Impl::cachedStatement(const std::string& t_stmt)
+    {
+      std::map<std::string, sqlite3_stmt*>::iterator it = m_cachedStatements.find(t_stmt);
+      if (it != m_cachedStatements.end()) {
+        sqlite3_reset(it->second);
+        sqlite3_clear_bindings(it->second);
+        return it->second;
+      }
+
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      int code = sqlite3_prepare_v2(m_db, t_stmt.c_str(), t_stmt.size(), &sqlStmtPtr, nullptr);
+      if ((code != SQLITE_OK) || !sqlStmtPtr) {
+        LOG(Error, "Error preparing statement: " << t_stmt << ", return code: " << code);
+        sqlite3_finalize(sqlStmtPtr);
+        return nullptr;
+      }
+
+      m_cachedStatements.insert(std::make_pair(t_stmt, sqlStmtPtr));
+      return sqlStmtPtr;
+    }
+
+    void SqlFile_Impl::finalizeCachedStatements()
+    {
+      for (auto& cached : m_cachedStatements) {
+        // must finalize to prevent memory leaks
+        sqlite3_finalize(cached.second);
+      }
+      m_cachedStatements.clear();
+    }
+
+    const SqlFile_Impl::TimeTable& SqlFile_Impl::timeTable(int envPeriodIndex)
+    {
+      std::map<int, TimeTable>::iterator it = m_timeTables.find(envPeriodIndex);
+      if (it != m_timeTables.end()) {
+        return it->second;
+      }
+
+      TimeTable& result = m_timeTables[envPeriodIndex];
+      if (m_db) {
+        sqlite3_stmt* sqlStmtPtr = cachedStatement("SELECT TimeIndex, Month, Day, Hour, Minute, Dst, Interval FROM Time WHERE EnvironmentPeriodIndex=?");
+        if (sqlStmtPtr) {
+          sqlite3_bind_int(sqlStmtPtr, 1, envPeriodIndex);
+          while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+            TimeTableRow row;
+            row.month = sqlite3_column_int(sqlStmtPtr, 1);
+            row.day = sqlite3_column_int(sqlStmtPtr, 2);
+            row.hour = sqlite3_column_int(sqlStmtPtr, 3);
+            row.minute = sqlite3_column_int(sqlStmtPtr, 4);
+            row.dst = sqlite3_column_int(sqlStmtPtr, 5);
+            row.interval = sqlite3_column_int(sqlStmtPtr, 6);
+            result.insert(std::make_pair(sqlite3_column_int(sqlStmtPtr, 0), row));
+          }
+          sqlite3_reset(sqlStmtPtr);
         }
-        else if (dataDictionary.table == "ReportVariableData")
-        {
-          s << " WHERE rvd.ReportVariableDataDictionaryIndex=";
+      }
+
+      LOG(Debug, "Decoded " << result.size() << " Time rows for environment period " << envPeriodIndex);
+
+      return result;
+    }
+
+    // return the column of table that refers to its data dictionary, or an empty string if table has no time series data
+    static std::string dataDictionaryIndexColumn(const std::string& table)
+    {
+      if (table == "ReportMeterData") {
+        return "ReportMeterDataDictionaryIndex";
+      } else if (table == "ReportVariableData") {
+        return "ReportVariableDataDictionaryIndex";
+      }
+      return std::string();
+    }
+
+    bool SqlFile_Impl::readReportData(const DataDictionaryItem& dataDictionary, std::vector<int>& timeIndices, std::vector<double>& values)
+    {
+      timeIndices.clear();
+      values.clear();
+
+      std::string column = dataDictionaryIndexColumn(dataDictionary.table);
+      if (!m_db || column.empty()) {
+        return false;
+      }
+
+      const TimeTable& times = timeTable(dataDictionary.envPeriodIndex);
+
+      // one statement per table, the Time join is replaced by the decoded Time table
+      sqlite3_stmt* sqlStmtPtr = cachedStatement("SELECT TimeIndex, VariableValue FROM " + dataDictionary.table + " WHERE " + column + "=?");
+      if (!sqlStmtPtr) {
+        return false;
+      }
+
+      sqlite3_bind_int(sqlStmtPtr, 1, dataDictionary.recordIndex);
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        int timeIndex = sqlite3_column_int(sqlStmtPtr, 0);
+        if (times.find(timeIndex) != times.end()) {
+          timeIndices.push_back(timeIndex);
+          values.push_back(sqlite3_column_double(sqlStmtPtr, 1));
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        //      s << " AND ep.EnvironmentName = ";
-        //      s << "'" << dataDictionary.envPeriod << "'";
-        s << " AND ti.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
-        // assume that timeindices.timeIndex are ordered from start to end
-        //      s << " ORDER BY ti.TimeIndex";
+      }
+      sqlite3_reset(sqlStmtPtr);
 
-        sqlite3_stmt* sqlStmtPtr;
+      return true;
+    }
 
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    SqlFile_Impl::TimeSeriesAxis SqlFile_Impl::timeSeriesAxis(const DataDictionaryItem& dataDictionary, const std::vector<int>& timeIndices)
+    {
+      TimeSeriesAxis axis;
+      axis.secondsFromFirstReport.reserve(timeIndices.size());
 
-        code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str();
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
-        while (code == SQLITE_ROW)
-        {
-          stdValues.push_back( sqlite3_column_double(sqlStmtPtr, 0) ); // values
+      boost::optional<unsigned> reportingIntervalMinutes;
 
-          code = sqlite3_step(sqlStmtPtr);
+      bool isIntervalTimeSeries = false;
+      try {
+        ReportingFrequency reportingFrequency(dataDictionary.reportingFrequency);
+        isIntervalTimeSeries = (reportingFrequency != ReportingFrequency::Detailed);
+      }catch(const std::exception&){
+      }
+
+      const TimeTable& times = timeTable(dataDictionary.envPeriodIndex);
+
+      long cumulativeSeconds = 0;
+
+      for (int timeIndex : timeIndices)
+      {
+        TimeTable::const_iterator it = times.find(timeIndex);
+        OS_ASSERT(it != times.end());
+
+        unsigned month = it->second.month;
+        unsigned day = it->second.day;
+        unsigned intervalMinutes = it->second.interval; // used for run periods
+
+        if (!axis.startDateTime){
+          if ((month==0) || (day==0)){
+            // gets called for RunPeriod reports, just returns the first date in the time table, not sure if this is right
+            axis.startDateTime = firstDateTime(false);
+          }else{
+            // DLM: potential leap year problem
+            axis.startDateTime = openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0,0,intervalMinutes,0));
+          }
+        }
+
+        axis.secondsFromFirstReport.push_back(cumulativeSeconds);
+
+        cumulativeSeconds += 60*intervalMinutes;
+
+        // check if this interval is same as the others
+        if (isIntervalTimeSeries && !reportingIntervalMinutes){
+          reportingIntervalMinutes = intervalMinutes;
+        }else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)){
+          isIntervalTimeSeries = false;
+          reportingIntervalMinutes.reset();
         }
-        sqlite3_finalize(sqlStmtPtr);
       }
 
-      LOG(Debug, "Created Timeseries with " << stdValues.size() << " values");
+      if (isIntervalTimeSeries){
+        axis.intervalMinutes = reportingIntervalMinutes;
+      }
 
-      return stdValues;
+      return axis;
     }
 
+    boost::optional<TimeSeries> SqlFile_Impl::makeTimeSeries(const TimeSeriesAxis& axis, const std::vector<double>& values, const std::string& units)
+    {
+      openstudio::OptionalTimeSeries ts;
+      if (axis.startDateTime && !axis.secondsFromFirstReport.empty()){
+        OS_ASSERT(axis.secondsFromFirstReport.size() == values.size());
+        if (axis.intervalMinutes){
+          openstudio::Time intervalTime(0,0,*axis.intervalMinutes,0);
+          ts = openstudio::TimeSeries(*axis.startDateTime, intervalTime, createVector(values), units);
+        }else{
+          ts = openstudio::TimeSeries(*axis.startDateTime, axis.secondsFromFirstReport, createVector(values), units);
+        }
+      }
+      return ts;
+    }
 
     openstudio::OptionalDate SqlFile_Impl::timeSeriesStartDate(const DataDictionaryItem& dataDictionary)
     {
@@ -2270,159 +2427,29 @@ namespace openstudio{
 
     openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary)
     {
-      openstudio::OptionalTimeSeries ts;
-      std::string units = dataDictionary.units;
-
-      boost::optional<openstudio::DateTime> startDateTime; 
-      std::vector<long> stdSecondsFromFirstReport;
-      stdSecondsFromFirstReport.reserve(8760);
-
+      std::vector<int> timeIndices;
       std::vector<double> stdValues;
-      stdValues.reserve(8760);
-      boost::optional<unsigned> reportingIntervalMinutes;
-
-      bool isIntervalTimeSeries = false;
-      try {
-        ReportingFrequency reportingFrequency(dataDictionary.reportingFrequency);
-        isIntervalTimeSeries = (reportingFrequency != ReportingFrequency::Detailed);
-      }catch(const std::exception&){
+      if (!readReportData(dataDictionary, timeIndices, stdValues)) {
+        return openstudio::OptionalTimeSeries();
       }
 
-      if (m_db) 
-      {
-        std::stringstream s;
-        s << "SELECT dt.VariableValue, Time.Month, Time.Day, Time.Hour, Time.Minute, Time.Interval FROM ";
-        s << dataDictionary.table;
-        s << " dt INNER JOIN Time ON Time.timeIndex = dt.TimeIndex";
-        s << " WHERE ";
-        if (dataDictionary.table == "ReportMeterData")
-        {
-          s << " dt.ReportMeterDataDictionaryIndex=";
-        }
-        else if (dataDictionary.table == "ReportVariableData")
-        {
-          s << " dt.ReportVariableDataDictionaryIndex=";
-        }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        s << " AND Time.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
-
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
-
-        code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str();
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
-
-        long cumulativeSeconds = 0;
-
-        while (code == SQLITE_ROW) 
-        {
-          double value = sqlite3_column_double(sqlStmtPtr, 0);
-          stdValues.push_back(value);
-
-          unsigned month = sqlite3_column_int(sqlStmtPtr, 1);
-          unsigned day = sqlite3_column_int(sqlStmtPtr, 2);
-          unsigned intervalMinutes = sqlite3_column_int(sqlStmtPtr, 5); // used for run periods
-
-          if (!startDateTime){
-            if ((month==0) || (day==0)){
-              // gets called for RunPeriod reports, just returns the first date in the time table, not sure if this is right
-              startDateTime = firstDateTime(false);
-            }else{
-              // DLM: potential leap year problem
-              startDateTime = openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0,0,intervalMinutes,0));
-            }
-          }
-
-          stdSecondsFromFirstReport.push_back(cumulativeSeconds);
-
-          cumulativeSeconds += 60*intervalMinutes;
-
-          // check if this interval is same as the others
-          if (isIntervalTimeSeries && !reportingIntervalMinutes){
-            reportingIntervalMinutes = intervalMinutes;
-          }else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)){
-            isIntervalTimeSeries = false;
-            reportingIntervalMinutes.reset();
-          }
-
-          // step to next row
-          code = sqlite3_step(sqlStmtPtr);
-        }
-
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
-
-        if (startDateTime && !stdSecondsFromFirstReport.empty()){
-          if (isIntervalTimeSeries){
-            openstudio::Time intervalTime(0,0,*reportingIntervalMinutes,0);
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*startDateTime, intervalTime, values, units);
-          }else{
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*startDateTime, stdSecondsFromFirstReport, values, units);
-          }
-        }
-      }
-
-      return ts;
+      return makeTimeSeries(timeSeriesAxis(dataDictionary, timeIndices), stdValues, dataDictionary.units);
     }
 
     openstudio::DateTimeVector SqlFile_Impl::dateTimeVec(const DataDictionaryItem& dataDictionary)
     {
       openstudio::DateTimeVector dateTimes;
 
-      if (m_db) {
-        std::stringstream s;
-        s << "SELECT Time.month, Time.day, Time.hour, Time.minute, Time.dst FROM ";
-        s << dataDictionary.table;
-        s << " dt INNER JOIN Time ON Time.timeIndex = dt.TimeIndex";
-        s << " WHERE ";
-        if (dataDictionary.table == "ReportMeterData")
-        {
-          s << " dt.ReportMeterDataDictionaryIndex=";
-        }
-        else if (dataDictionary.table == "ReportVariableData")
-        {
-          s << " dt.ReportVariableDataDictionaryIndex=";
-        }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        s << " AND Time.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
-
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
-
-        code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str();
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
-        while (code == SQLITE_ROW) {
-          unsigned month, day, hour, minute;//, simulationDay;
-          month = sqlite3_column_int(sqlStmtPtr, 0);
-          day = sqlite3_column_int(sqlStmtPtr, 1);
-          hour = sqlite3_column_int(sqlStmtPtr, 2);
-          minute = sqlite3_column_int(sqlStmtPtr, 3);
-
+      std::vector<int> timeIndices;
+      std::vector<double> values;
+      if (readReportData(dataDictionary, timeIndices, values)) {
+        const TimeTable& times = timeTable(dataDictionary.envPeriodIndex);
+        dateTimes.reserve(timeIndices.size());
+        for (int timeIndex : timeIndices) {
+          const TimeTableRow& row = times.find(timeIndex)->second;
           // DLM: potential leap year problem
-          openstudio::DateTime dateTime(openstudio::Date(monthOfYear(month),day), openstudio::Time(0,hour, minute, 0));
-          dateTimes.push_back(dateTime);
-
-          // step to next row
-          code = sqlite3_step(sqlStmtPtr);
+          dateTimes.push_back(openstudio::DateTime(openstudio::Date(monthOfYear(row.month),row.day), openstudio::Time(0,row.hour,row.minute,0)));
         }
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
       }
 
       return dateTimes;
@@ -2464,6 +2491,126 @@ namespace openstudio{
       return ts;
     }
 
+    std::vector<openstudio::OptionalTimeSeries> SqlFile_Impl::timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::pair<std::string, std::string> >& namesAndKeyValues)
+    {
+      typedef DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type DataDictionaryIndex;
+
+      struct PendingItem
+      {
+        DataDictionaryIndex::iterator item;
+        std::vector<size_t> positions;
+        std::vector<int> timeIndices;
+        std::vector<double> values;
+      };
+
+      std::vector<openstudio::OptionalTimeSeries> result(namesAndKeyValues.size());
+
+      std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+      DataDictionaryIndex& index = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+
+      // series that still have to be read, grouped by table and environment period, keyed by record index
+      std::map<std::pair<std::string, int>, std::map<int, PendingItem> > pending;
+      for (size_t i = 0; i < namesAndKeyValues.size(); ++i) {
+        DataDictionaryIndex::iterator iEpRfNKv = index.find(boost::make_tuple(queryEnvPeriod, reportingFrequency, namesAndKeyValues[i].first, namesAndKeyValues[i].second));
+        if (iEpRfNKv == index.end()) {
+          LOG(Debug,"Tuple: " << queryEnvPeriod << ", " << reportingFrequency << ", " << namesAndKeyValues[i].first << ", " << namesAndKeyValues[i].second << " not found in data dictionary.");
+        } else if (!iEpRfNKv->timeSeries.values().empty()) {
+          result[i] = iEpRfNKv->timeSeries;
+        } else if (!dataDictionaryIndexColumn(iEpRfNKv->table).empty()) {
+          PendingItem& pendingItem = pending[std::make_pair(iEpRfNKv->table, iEpRfNKv->envPeriodIndex)][iEpRfNKv->recordIndex];
+          pendingItem.item = iEpRfNKv;
+          pendingItem.positions.push_back(i);
+        }
+      }
+
+      if (pending.empty() || !m_db) {
+        return result;
+      }
+
+      // unused parameters are left unbound, NULL never matches so short chunks reuse the same statement
+      const unsigned chunkSize = 256;
+
+      for (auto& group : pending) {
+        const std::string& table = group.first.first;
+        const TimeTable& times = timeTable(group.first.second);
+
+        std::stringstream s;
+        s << "SELECT " << dataDictionaryIndexColumn(table) << ", TimeIndex, VariableValue FROM " << table;
+        s << " WHERE " << dataDictionaryIndexColumn(table) << " IN (?";
+        for (unsigned i = 1; i < chunkSize; ++i) {
+          s << ",?";
+        }
+        s << ")";
+
+        std::map<int, PendingItem>& items = group.second;
+        std::map<int, PendingItem>::iterator chunkBegin = items.begin();
+        while (chunkBegin != items.end()) {
+          sqlite3_stmt* sqlStmtPtr = cachedStatement(s.str());
+          if (!sqlStmtPtr) {
+            return result;
+          }
+
+          std::map<int, PendingItem>::iterator chunkEnd = chunkBegin;
+          for (unsigned i = 1; (i <= chunkSize) && (chunkEnd != items.end()); ++i, ++chunkEnd) {
+            sqlite3_bind_int(sqlStmtPtr, i, chunkEnd->first);
+          }
+
+          std::map<int, PendingItem>::iterator current = items.end();
+          while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+            int timeIndex = sqlite3_column_int(sqlStmtPtr, 1);
+            if (times.find(timeIndex) == times.end()) {
+              continue;
+            }
+            // rows of one record are usually adjacent
+            int recordIndex = sqlite3_column_int(sqlStmtPtr, 0);
+            if ((current == items.end()) || (current->first != recordIndex)) {
+              current = items.find(recordIndex);
+            }
+            current->second.timeIndices.push_back(timeIndex);
+            current->second.values.push_back(sqlite3_column_double(sqlStmtPtr, 2));
+          }
+          sqlite3_reset(sqlStmtPtr);
+
+          chunkBegin = chunkEnd;
+        }
+
+        // series reported at the same time indices share one decoded axis
+        std::vector<std::pair<const std::vector<int>*, TimeSeriesAxis> > axes;
+        for (auto& recordAndItem : items) {
+          PendingItem& pendingItem = recordAndItem.second;
+
+          const TimeSeriesAxis* axis = nullptr;
+          for (const auto& candidate : axes) {
+            if (*candidate.first == pendingItem.timeIndices) {
+              axis = &candidate.second;
+              break;
+            }
+          }
+          if (!axis) {
+            axes.push_back(std::make_pair(&pendingItem.timeIndices, timeSeriesAxis(*pendingItem.item, pendingItem.timeIndices)));
+            axis = &axes.back().second;
+          }
+
+          openstudio::OptionalTimeSeries ts = makeTimeSeries(*axis, pendingItem.values, pendingItem.item->units);
+          if (ts) {
+            for (size_t position : pendingItem.positions) {
+              result[position] = ts;
+            }
+
+            // lazy caching
+            DataDictionaryItem ddi = *pendingItem.item;
+            ddi.timeSeries = *ts;
+            index.replace(pendingItem.item, ddi);
+          }
+
+          // values are no longer needed, time indices may still back an axis
+          std::vector<double>().swap(pendingItem.values);
+        }
+      }
+
+      return result;
+    }
+
     SqlFileTimeSeriesQueryVector SqlFile_Impl::expandQuery(const SqlFileTimeSeriesQuery& query) {
 
       SqlFileTimeSeriesQueryVector result, temp1, temp2;
@@ -2719,8 +2866,11 @@ namespace openstudio{
       ReportingFrequency rf = *(wquery.reportingFrequency());
       std::string tsName = *(wquery.timeSeries().get().name());
       if (wquery.keyValues()) {
-        for (const std::string kvName : wquery.keyValues().get().names()) {
-          OptionalTimeSeries ots = timeSeries(envPeriod,rf.valueDescription(),tsName,kvName);
+        std::vector<std::pair<std::string, std::string> > namesAndKeyValues;
+        for (const std::string& kvName : wquery.keyValues().get().names()) {
+          namesAndKeyValues.push_back(std::make_pair(tsName, kvName));
+        }
+        for (const OptionalTimeSeries& ots : timeSeries(envPeriod,rf.valueDescription(),namesAndKeyValues)) {
           if (ots) { result.push_back(*ots); }
         }
       }
@@ -3447,6 +3597,79 @@ namespace openstudio{
       return illuminance;
     }
 
+    IlluminanceMapSeries SqlFile_Impl::illuminanceMapSeries(const std::string& name) const
+    {
+      // figure out map index
+      boost::optional<int> mapIndex = illuminanceMapIndex(name);
+
+      if (!mapIndex){
+        LOG(Error, "Unknown illuminance map '" << name << "'");
+        return IlluminanceMapSeries();
+      }
+
+      return illuminanceMapSeries(*mapIndex);
+    }
+
+    IlluminanceMapSeries SqlFile_Impl::illuminanceMapSeries(const int& mapIndex) const
+    {
+      std::vector< std::pair<int, DateTime> > reportIndicesDates = illuminanceMapHourlyReportIndicesDates(mapIndex);
+      if (reportIndicesDates.empty()){
+        return IlluminanceMapSeries();
+      }
+
+      // the grid is the same for every hourly report of a map
+      int firstReportIndex = reportIndicesDates.front().first;
+      IlluminanceMapSeries result(illuminanceMapX(firstReportIndex), illuminanceMapY(firstReportIndex));
+      unsigned numPoints = result.numPoints();
+
+      result.reserve(reportIndicesDates.size());
+      std::map<int, unsigned> timeIndices;
+      for (const auto& reportIndexDate : reportIndicesDates){
+        timeIndices[reportIndexDate.first] = result.numDateTimes();
+        result.append(reportIndexDate.second);
+      }
+
+      std::stringstream statement;
+      statement << "select d.HourlyReportIndex, d.Illuminance from daylightmaphourlydata d " <<
+        "inner join daylightmaphourlyreports r on d.HourlyReportIndex=r.HourlyReportIndex " <<
+        "where r.MapNumber=" << mapIndex << " order by d.HourlyReportIndex asc, d.X asc, d.Y asc";
+
+      sqlite3_stmt* sqlStmtPtr;
+
+      int currentReportIndex = firstReportIndex;
+      float* values = result.values(timeIndices[firstReportIndex]);
+      unsigned p = 0;
+
+      int code = sqlite3_prepare_v2(m_db, statement.str().c_str(),-1,&sqlStmtPtr,nullptr);
+      code = sqlite3_step(sqlStmtPtr);
+      while (code == SQLITE_ROW)
+      {
+        int reportIndex = sqlite3_column_int(sqlStmtPtr,0);
+        if (reportIndex != currentReportIndex){
+          currentReportIndex = reportIndex;
+          values = result.values(timeIndices[reportIndex]);
+          p = 0;
+        }
+
+        if (p < numPoints){
+          values[p] = static_cast<float>(sqlite3_column_double(sqlStmtPtr,1));
+          ++p;
+        }else if (p == numPoints){
+          LOG(Error, "Too much illuminance map data retrieved at time index " << reportIndex <<
+              " for map index " << mapIndex << ".  Size is " << result.x().size() << "x" << result.y().size());
+          ++p;
+        }
+
+        // step to next row
+        code = sqlite3_step(sqlStmtPtr);
+      }
+
+      /// must finalize to prevent memory leaks
+      sqlite3_finalize(sqlStmtPtr);
+
+      return result;
+    }
+
     // find the illuminance map index by name
     boost::optional<int> SqlFile_Impl::illuminanceMapIndex(const std::string& name) const
     {
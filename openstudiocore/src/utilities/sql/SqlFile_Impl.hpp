@@ -30,10 +30,13 @@
 #include "../data/EndUses.hpp"
 #include "../core/Optional.hpp"
 #include "../data/Matrix.hpp"
+#include "../data/IlluminanceMapSeries.hpp"
 
 #include <boost/optional.hpp>
 
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // forward declaration
@@ -631,6 +634,12 @@ namespace openstudio{
       // this could be used to get "Mean Air Temperature" for a particular zone
       boost::optional<TimeSeries> timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue);
 
+      // return the timeseries for each (timeSeriesName, keyValue) pair, in order, reading each report table in one pass
+      std::vector<boost::optional<TimeSeries> > timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::pair<std::string, std::string> >& namesAndKeyValues);
+
+      // read the values of a single timeseries into values, reusing its storage; returns false if not found
+      bool timeSeriesValues(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue, std::vector<double>& values);
+
       /** Expands query to create a vector of all matching queries. The returned queries will have
        *  one environment period, one reporting frequency, and one time series name specified. The
        *  returned queries will also be "vetted". */
@@ -730,6 +739,14 @@ namespace openstudio{
       /// value(i,j) is the illuminance at x(i), y(j) - returns x, y and illuminance
       void illuminanceMap(const int& hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const  ;
 
+      /// all hourly reports of the illuminance map
+      /// value(t,i,j) is the illuminance at x(i), y(j) at dateTimes()[t]
+      IlluminanceMapSeries illuminanceMapSeries(const std::string& name) const;
+
+      /// all hourly reports of the illuminance map at mapIndex
+      /// value(t,i,j) is the illuminance at x(i), y(j) at dateTimes()[t]
+      IlluminanceMapSeries illuminanceMapSeries(const int& mapIndex) const;
+
       // execute a statement and return the first (if any) value as a double
       boost::optional<double> execAndReturnFirstDouble(const std::string& statement) const;
 
@@ -809,6 +826,39 @@ namespace openstudio{
 
       bool isValidConnection();
 
+      // decoded row of the Time table
+      struct TimeTableRow
+      {
+        int month;
+        int day;
+        int hour;
+        int minute;
+        int dst;
+        int interval;
+      };
+      typedef std::unordered_map<int, TimeTableRow> TimeTable;
+
+      // time axis built from a sequence of time indices, shared by all series reported at those indices
+      struct TimeSeriesAxis
+      {
+        boost::optional<DateTime> startDateTime;
+        std::vector<long> secondsFromFirstReport;
+        boost::optional<unsigned> intervalMinutes;
+      };
+
+      // return a prepared statement for t_stmt, preparing it on first use; bindings are cleared on reuse
+      sqlite3_stmt* cachedStatement(const std::string& t_stmt);
+      void finalizeCachedStatements();
+
+      // return the decoded Time table rows of an environment period, keyed by TimeIndex
+      const TimeTable& timeTable(int envPeriodIndex);
+
+      // read the time indices and values of dataDictionary, skipping rows outside of its environment period
+      bool readReportData(const DataDictionaryItem& dataDictionary, std::vector<int>& timeIndices, std::vector<double>& values);
+
+      TimeSeriesAxis timeSeriesAxis(const DataDictionaryItem& dataDictionary, const std::vector<int>& timeIndices);
+      static boost::optional<TimeSeries> makeTimeSeries(const TimeSeriesAxis& axis, const std::vector<double>& values, const std::string& units);
+
       void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
       openstudio::path m_path;
@@ -819,6 +869,9 @@ namespace openstudio{
 
       bool m_supportedVersion;
 
+      std::map<std::string, sqlite3_stmt*> m_cachedStatements;
+      std::map<int, TimeTable> m_timeTables;
+
       REGISTER_LOGGER("openstudio.energyplus.SqlFile");
     };
 
@@ -204,6 +204,48 @@ TEST_F(IlluminanceMapFixture, IlluminanceMapPlotSeriesOpt)
   sqlFile.illuminanceMap(illuminanceMapReportIndicesDates[0].first,x,y,illuminance);
 }
 
+TEST_F(IlluminanceMapFixture, IlluminanceMapSeries)
+{
+  const std::string& mapName = "CLASSROOM ILLUMINANCE MAP";
+
+  IlluminanceMapSeries series = sqlFile.illuminanceMapSeries(mapName);
+  ASSERT_EQ(4760u, series.numDateTimes());
+  ASSERT_EQ(9u, series.x().size());
+  ASSERT_EQ(9u, series.y().size());
+
+  std::vector< std::pair<int, DateTime> > illuminanceMapReportIndicesDates = sqlFile.illuminanceMapHourlyReportIndicesDates(mapName);
+  ASSERT_EQ(illuminanceMapReportIndicesDates.size(), series.numDateTimes());
+
+  // spot check against maps loaded one at a time
+  for (unsigned t = 0; t < series.numDateTimes(); t += 500){
+    EXPECT_EQ(illuminanceMapReportIndicesDates[t].second, series.dateTimes()[t]);
+    Matrix expected = sqlFile.illuminanceMap(illuminanceMapReportIndicesDates[t].first);
+    Matrix map = series.illuminanceMap(t);
+    ASSERT_EQ(expected.size1(), map.size1());
+    ASSERT_EQ(expected.size2(), map.size2());
+    for (unsigned i = 0; i < map.size1(); ++i){
+      for (unsigned j = 0; j < map.size2(); ++j){
+        EXPECT_FLOAT_EQ(expected(i,j), map(i,j));
+      }
+    }
+  }
+
+  Matrix minimum = series.minimum();
+  Matrix maximum = series.maximum();
+  double minValue = minimum(0,0);
+  double maxValue = maximum(0,0);
+  for (unsigned i = 0; i < 9; ++i){
+    for (unsigned j = 0; j < 9; ++j){
+      minValue = std::min(minValue, minimum(i,j));
+      maxValue = std::max(maxValue, maximum(i,j));
+    }
+  }
+  EXPECT_EQ(0, minValue);
+  EXPECT_EQ(3648, maxValue);
+
+  EXPECT_EQ(0u, sqlFile.illuminanceMapSeries("NOT A MAP").numDateTimes());
+}
+
 TEST_F(IlluminanceMapFixture, IlluminanceMapMatrixBaseline)
 {
   Application::instance().application(true);
@@ -114,6 +114,52 @@ TEST_F(SqlFileFixture, TimeSeriesValues)
   EXPECT_DOUBLE_EQ(ts->outOfRangeValue(), ts->value(DateTime(Date(MonthOfYear::Dec, 31), Time(0,24,0,1))));
 }
 
+TEST_F(SqlFileFixture, TimeSeriesBulk)
+{
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+
+  std::vector<std::pair<std::string, std::string> > namesAndKeyValues;
+  namesAndKeyValues.push_back(std::make_pair("Site Outdoor Air Drybulb Temperature", "Environment"));
+  namesAndKeyValues.push_back(std::make_pair("NotAVariable:Facility", ""));
+  namesAndKeyValues.push_back(std::make_pair("Electricity:Facility", ""));
+  namesAndKeyValues.push_back(std::make_pair("Gas:Facility", ""));
+
+  std::vector<openstudio::OptionalTimeSeries> bulk = sqlFile.timeSeries(availableEnvPeriods[0], "Hourly", namesAndKeyValues);
+  ASSERT_EQ(namesAndKeyValues.size(), bulk.size());
+  ASSERT_TRUE(bulk[0]);
+  EXPECT_FALSE(bulk[1]);
+  ASSERT_TRUE(bulk[2]);
+  ASSERT_TRUE(bulk[3]);
+
+  ASSERT_EQ(static_cast<unsigned>(8760), bulk[0]->values().size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1), Time(0,1,0,0)), bulk[0]->firstReportDateTime());
+  EXPECT_DOUBLE_EQ(-8.2625, bulk[0]->values()[0]);
+  EXPECT_DOUBLE_EQ(-5.6875, bulk[0]->values()[8759]);
+
+  // meters and variables reported hourly share the same time axis
+  EXPECT_EQ(bulk[0]->firstReportDateTime(), bulk[2]->firstReportDateTime());
+  ASSERT_EQ(bulk[0]->daysFromFirstReport().size(), bulk[2]->daysFromFirstReport().size());
+  EXPECT_DOUBLE_EQ(bulk[0]->daysFromFirstReport()[8759], bulk[2]->daysFromFirstReport()[8759]);
+
+  // values read into a caller owned buffer match the series
+  std::vector<double> values;
+  values.reserve(8760);
+  EXPECT_TRUE(sqlFile.timeSeriesValues(availableEnvPeriods[0], "Hourly", "Gas:Facility", "", values));
+  ASSERT_EQ(bulk[3]->values().size(), values.size());
+  for (unsigned i = 0; i < values.size(); ++i) {
+    EXPECT_DOUBLE_EQ(bulk[3]->values()[i], values[i]);
+  }
+  EXPECT_FALSE(sqlFile.timeSeriesValues(availableEnvPeriods[0], "Hourly", "NotAVariable:Facility", "", values));
+  EXPECT_TRUE(values.empty());
+
+  // single series agree with the bulk results
+  openstudio::OptionalTimeSeries ts = sqlFile.timeSeries(availableEnvPeriods[0], "Hourly", "Electricity:Facility", "");
+  ASSERT_TRUE(ts);
+  ASSERT_EQ(bulk[2]->values().size(), ts->values().size());
+  EXPECT_DOUBLE_EQ(bulk[2]->values()[100], ts->values()[100]);
+}
+
 TEST_F(SqlFileFixture, TimeSeriesCount)
 {
   std::vector<std::string> availableTimeSeries = sqlFile.availableTimeSeries();